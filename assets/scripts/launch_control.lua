@@ -0,0 +1,40 @@
+--[[
+    Launch Control Script
+
+    Runs modules/launch_control.lua on its own, for vehicles that want
+    launch control without the freestyle assists. Options come from the
+    vehicle JSON with the module's defaults:
+        lc_enabled, lc_max_speed, lc_slip_threshold, lc_min_throttle
+
+    The native "launch_control" script reads the same options.
+]]
+
+local lc = require("modules/launch_control")
+
+-- Booleans are stored as 0.0 or 1.0 in JSON
+local function get_config(ctx, key, default)
+    if ctx.config and ctx.config[key] ~= nil then
+        if type(default) == "boolean" then
+            return ctx.config[key] ~= 0
+        end
+        return ctx.config[key]
+    end
+    return default
+end
+
+-- Apply configuration on first update for this entity
+local function apply_config(ctx)
+    if ctx.state.config_applied then return end
+
+    ctx.state.lc_enabled = get_config(ctx, "lc_enabled", lc.enabled)
+    ctx.state.lc_max_speed = get_config(ctx, "lc_max_speed", lc.max_speed)
+    ctx.state.lc_slip_threshold = get_config(ctx, "lc_slip_threshold", lc.slip_threshold)
+    ctx.state.lc_min_throttle = get_config(ctx, "lc_min_throttle", lc.min_throttle)
+
+    ctx.state.config_applied = true
+end
+
+function update(ctx)
+    apply_config(ctx)
+    lc.update(ctx)
+end
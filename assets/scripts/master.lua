@@ -16,6 +16,10 @@
     - master.update(vehicle_id, ctx)
     - master.detach_script(vehicle_id, script_name)
     - master.reload_all()
+    - master.reload_changed(paths) -> count   (only instances depending on paths)
+
+    Hot reload state: a script may define save_state(ctx) -> value and
+    restore_state(ctx, value) to carry its own state across reload_changed.
 
     Turn/Test API (delegates to turn_executor script if attached):
     - master.start_turn(vehicle_id, maneuver_type, direction, options)
@@ -24,6 +28,11 @@
     - master.start_test_sequence(vehicle_id, sequence_name, options)
     - master.stop_test_sequence()
     - master.is_test_running()
+
+    Provided by C++ (script cost and instruction budget):
+    - reflex_cost_slot(vehicle_id, script_name, chunk) -> slot
+    - reflex_release_cost_slot(slot)
+    - reflex_run_script(slot, fn, ctx) -> ok, err   (pcall, timed and budgeted)
 ]]
 
 local master = {}
@@ -32,6 +41,52 @@ local master = {}
 -- Each script_data = { env, update_fn, init_fn, destroy_fn, script_path, config, name }
 local vehicles = {}
 
+-- Timed, budgeted pcall from C++; plain pcall when run without the engine
+local run_script = reflex_run_script or function(slot, fn, ctx) return pcall(fn, ctx) end
+
+-- Dependency tracking for incremental reload:
+-- module_files[name] = file the module was loaded from
+-- module_deps[name]  = { [module] = true } modules it required while loading
+-- A script instance keeps the modules its chunk and init() required in .deps
+local module_files = {}
+local module_deps = {}
+local require_stack = {}  -- Dependency sets of the chunks currently loading
+
+-- File require(name) loads, following package.path
+local function find_module_file(name)
+    local file_name = name:gsub("%.", "/")
+    for template in package.path:gmatch("[^;]+") do
+        local path = template:gsub("%?", file_name)
+        local f = io.open(path, "r")
+        if f then
+            f:close()
+            return path
+        end
+    end
+    return nil
+end
+
+-- require() that records who depends on which module
+local base_require = require
+function require(name)
+    local top = require_stack[#require_stack]
+    if top then top[name] = true end
+
+    if package.loaded[name] ~= nil then
+        return package.loaded[name]
+    end
+
+    local deps = {}
+    require_stack[#require_stack + 1] = deps
+    local ok, result = pcall(base_require, name)
+    require_stack[#require_stack] = nil
+    if not ok then error(result, 2) end
+
+    module_files[name] = find_module_file(name) or false
+    module_deps[name] = deps
+    return result
+end
+
 -- Create isolated environment for a script instance
 local function create_script_env()
     local env = {}
@@ -59,14 +114,8 @@ end
 function master.attach_script(vehicle_id, script_name, script_path, config)
     local vehicle = get_vehicle(vehicle_id)
 
-    -- Check if this script name is already attached
-    if vehicle.scripts[script_name] then
-        print(string.format("[Master] Vehicle %d already has '%s', replacing", vehicle_id, script_name))
-        master.detach_script(vehicle_id, script_name)
-    end
-
-    -- Load the script file
-    local chunk, err = loadfile(script_path)
+    -- Load the script file (compiled once, shared through the C++ bytecode cache)
+    local chunk, err = (reflex_loadfile or loadfile)(script_path)
     if not chunk then
         print(string.format("[Master] Failed to load '%s': %s", script_path, tostring(err)))
         return false
@@ -78,7 +127,10 @@ function master.attach_script(vehicle_id, script_name, script_path, config)
 
     -- Set environment and execute
     setfenv(chunk, env)
+    local deps = {}
+    require_stack[#require_stack + 1] = deps
     local ok, err = pcall(chunk)
+    require_stack[#require_stack] = nil
     if not ok then
         print(string.format("[Master] Error executing '%s': %s", script_path, tostring(err)))
         return false
@@ -90,6 +142,12 @@ function master.attach_script(vehicle_id, script_name, script_path, config)
         return false
     end
 
+    -- Replace an existing instance only once the new one loaded
+    if vehicle.scripts[script_name] then
+        print(string.format("[Master] Vehicle %d already has '%s', replacing", vehicle_id, script_name))
+        master.detach_script(vehicle_id, script_name)
+    end
+
     -- Store script data
     vehicle.scripts[script_name] = {
         name = script_name,
@@ -99,6 +157,8 @@ function master.attach_script(vehicle_id, script_name, script_path, config)
         destroy_fn = env.destroy,
         script_path = script_path,
         config = config or {},
+        cost_slot = reflex_cost_slot and reflex_cost_slot(vehicle_id, script_name, chunk) or -1,
+        deps = deps,
     }
 
     print(string.format("[Master] Attached '%s' to vehicle %d", script_name, vehicle_id))
@@ -110,7 +170,9 @@ function master.attach_script(vehicle_id, script_name, script_path, config)
             config = config or {},
             state = vehicle.state,
         }
+        require_stack[#require_stack + 1] = deps
         local ok, err = pcall(env.init, init_ctx)
+        require_stack[#require_stack] = nil
         if not ok then
             print(string.format("[Master] init() error for %s on vehicle %d: %s", script_name, vehicle_id, tostring(err)))
         end
@@ -136,6 +198,10 @@ function master.detach_script(vehicle_id, script_name)
         end
     end
 
+    if reflex_release_cost_slot then
+        reflex_release_cost_slot(script.cost_slot)
+    end
+
     vehicle.scripts[script_name] = nil
     print(string.format("[Master] Detached '%s' from vehicle %d", script_name, vehicle_id))
 end
@@ -169,7 +235,7 @@ function master.update(vehicle_id, ctx)
     for script_name, script in pairs(vehicle.scripts) do
         ctx.config = script.config
 
-        local ok, err = pcall(script.update_fn, ctx)
+        local ok, err = run_script(script.cost_slot, script.update_fn, ctx)
         if not ok then
             print(string.format("[Master] update() error for %s on vehicle %d: %s",
                 script_name, vehicle_id, tostring(err)))
@@ -177,6 +243,16 @@ function master.update(vehicle_id, ctx)
     end
 end
 
+-- Update every vehicle in one call from C++ (ctxs[1..count], one per vehicle).
+-- Scripts write their outputs into each ctx.controls as with update().
+function master.update_all(ctxs, count)
+    local update = master.update
+    for i = 1, count do
+        local ctx = ctxs[i]
+        update(ctx.id, ctx)
+    end
+end
+
 -- ============================================================================
 -- TURN-BASED MANEUVER CONTROL (delegates to turn_executor script)
 -- ============================================================================
@@ -449,6 +525,101 @@ function master.reload_all()
     return success
 end
 
+-- Reload one instance in place, keeping vehicle state and (if the script
+-- opts in with save_state/restore_state) the script's own state
+local function reload_instance(vehicle_id, script)
+    local vehicle = vehicles[vehicle_id]
+    local state_ctx = { id = vehicle_id, state = vehicle.state }
+
+    local saved
+    if script.env.save_state then
+        local ok, result = pcall(script.env.save_state, state_ctx)
+        if ok then
+            saved = result
+        else
+            print(string.format("[Master] save_state() error for %s: %s", script.name, tostring(result)))
+        end
+    end
+
+    if not master.attach_script(vehicle_id, script.name, script.script_path, script.config) then
+        return false  -- Old instance stays attached
+    end
+
+    local fresh = vehicle.scripts[script.name]
+    if saved ~= nil and fresh.env.restore_state then
+        local ok, err = pcall(fresh.env.restore_state, state_ctx, saved)
+        if not ok then
+            print(string.format("[Master] restore_state() error for %s: %s", script.name, tostring(err)))
+        end
+    end
+    return true
+end
+
+-- Reload only what depends on the changed files: instances whose script is
+-- one of paths, or that use a module loaded from one (directly or through
+-- other modules). Returns the number of instances reloaded.
+function master.reload_changed(paths)
+    local changed = {}
+    for _, path in ipairs(paths) do changed[path] = true end
+
+    -- Modules from changed files, then every module that required a stale one
+    local stale = {}
+    for name, file in pairs(module_files) do
+        if file and changed[file] then stale[name] = true end
+    end
+    local grew = true
+    while grew do
+        grew = false
+        for name, deps in pairs(module_deps) do
+            if not stale[name] then
+                for dep in pairs(deps) do
+                    if stale[dep] then
+                        stale[name] = true
+                        grew = true
+                        break
+                    end
+                end
+            end
+        end
+    end
+    for name in pairs(stale) do
+        package.loaded[name] = nil
+        module_files[name] = nil
+        module_deps[name] = nil
+        print(string.format("[Master] Module changed: %s", name))
+    end
+
+    local reloads = {}
+    for vehicle_id, vehicle in pairs(vehicles) do
+        for _, script in pairs(vehicle.scripts) do
+            local hit = changed[script.script_path]
+            if not hit then
+                for dep in pairs(script.deps) do
+                    if stale[dep] then
+                        hit = true
+                        break
+                    end
+                end
+            end
+            if hit then
+                reloads[#reloads + 1] = { vehicle_id = vehicle_id, script = script }
+            end
+        end
+    end
+
+    local success = 0
+    for _, r in ipairs(reloads) do
+        if reload_instance(r.vehicle_id, r.script) then
+            success = success + 1
+        end
+    end
+
+    if #reloads > 0 then
+        print(string.format("[Master] Reloaded %d/%d changed scripts", success, #reloads))
+    end
+    return success
+end
+
 function master.get_vehicle_count()
     local count = 0
     for _ in pairs(vehicles) do count = count + 1 end
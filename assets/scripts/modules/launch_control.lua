@@ -8,11 +8,17 @@
     Usage:
         local lc = require("modules/launch_control")
         lc.update(ctx)
+
+    Per-entity config (set by parent script in ctx.state):
+        ctx.state.lc_enabled         - Enable/disable launch control
+        ctx.state.lc_max_speed       - Disable above this speed (m/s)
+        ctx.state.lc_slip_threshold  - Slip that triggers throttle cut
+        ctx.state.lc_min_throttle    - Minimum throttle
 ]]
 
 local lc = {}
 
--- Configuration
+-- Default configuration (used if not set in ctx.state)
 lc.max_speed = 15.0          -- m/s (~34 mph) - disable above this speed
 lc.slip_threshold = 0.5      -- 50% slip triggers throttle cut
 lc.min_throttle = 0.3        -- Minimum throttle (30%) - never cut below this
@@ -22,14 +28,21 @@ lc.enabled = false           -- Disabled for TEST C
 lc.logged = false
 
 function lc.update(ctx)
-    if not lc.enabled then return end
+    -- Check if launch control is enabled for this entity
+    local enabled = ctx.state.lc_enabled
+    if enabled == nil then enabled = lc.enabled end
+    if not enabled then return end
+
+    local max_speed = ctx.state.lc_max_speed or lc.max_speed
+    local slip_threshold = ctx.state.lc_slip_threshold or lc.slip_threshold
+    local min_throttle = ctx.state.lc_min_throttle or lc.min_throttle
 
     local controls = ctx.controls
     local telemetry = ctx.telemetry
     local speed = telemetry.speed_ms or 0
 
     -- Only active at low speeds
-    if speed > lc.max_speed then
+    if speed > max_speed then
         return
     end
 
@@ -49,16 +62,16 @@ function lc.update(ctx)
     end
 
     -- If slip is excessive, reduce throttle
-    if max_slip > lc.slip_threshold then
+    if max_slip > slip_threshold then
         -- Proportional reduction: more slip = less throttle
         -- At 100% slip -> min_throttle, at threshold -> full throttle
-        local slip_excess = (max_slip - lc.slip_threshold) / (1.0 - lc.slip_threshold)
+        local slip_excess = (max_slip - slip_threshold) / (1.0 - slip_threshold)
         slip_excess = math.min(slip_excess, 1.0)
 
-        local throttle_mult = 1.0 - (slip_excess * (1.0 - lc.min_throttle))
+        local throttle_mult = 1.0 - (slip_excess * (1.0 - min_throttle))
         local new_throttle = throttle * throttle_mult
 
-        controls.throttle = math.max(new_throttle, lc.min_throttle)
+        controls.throttle = math.max(new_throttle, min_throttle)
 
         -- One-time log
         if not lc.logged then
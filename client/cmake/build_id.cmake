@@ -0,0 +1,26 @@
+# Build id for the config cache (src/game/config_cache.h)
+# Run at build time: cmake -DSOURCE_DIR=<src> -DOUTPUT=<header> -P build_id.cmake
+# Hashes every source under SOURCE_DIR, so any code change (loader defaults,
+# unit conversions, handling rules) gives a new id and old blobs miss. The
+# header is only rewritten when the id changes.
+
+file(GLOB_RECURSE sources "${SOURCE_DIR}/*.cpp" "${SOURCE_DIR}/*.h")
+list(SORT sources)
+
+set(manifest "")
+foreach(source ${sources})
+    file(SHA1 "${source}" source_hash)
+    file(RELATIVE_PATH source_name "${SOURCE_DIR}" "${source}")
+    string(APPEND manifest "${source_name} ${source_hash}\n")
+endforeach()
+string(SHA1 build_id "${manifest}")
+string(SUBSTRING "${build_id}" 0 16 build_id)
+
+set(content "// Generated by cmake/build_id.cmake - do not edit\n#define ARENA_BUILD_ID \"${build_id}\"\n")
+set(previous "")
+if(EXISTS "${OUTPUT}")
+    file(READ "${OUTPUT}" previous)
+endif()
+if(NOT previous STREQUAL content)
+    file(WRITE "${OUTPUT}" "${content}")
+endif()
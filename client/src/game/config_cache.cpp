@@ -0,0 +1,190 @@
+/*
+ * Baked Config Cache Implementation
+ */
+
+#include "config_cache.h"
+#include "build_id.h"  // ARENA_BUILD_ID, generated by cmake/build_id.cmake
+
+#include <stdio.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <thread>
+
+static const char CONFIG_CACHE_MAGIC[8] = "ARNBAKE";
+
+static std::mutex s_mutex;
+static std::string s_dir;  // Empty = disabled
+static std::atomic<uint32_t> s_hits{0};
+static std::atomic<uint32_t> s_baked{0};
+static std::atomic<uint32_t> s_rejected{0};
+static std::atomic<uint32_t> s_tmp_counter{0};
+
+static std::string blob_path(const char* kind, uint64_t key) {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (s_dir.empty()) return std::string();
+
+    char name[96];
+    snprintf(name, sizeof(name), "%s-%016llx.bin", kind, (unsigned long long)key);
+    return s_dir + "/" + name;
+}
+
+// Map and check a blob (no hit counting; callers decide if it is usable)
+static bool open_blob(const char* kind, uint64_t key, ConfigBlob* blob) {
+    memset(blob, 0, sizeof(*blob));
+    std::string path = blob_path(kind, key);
+    if (path.empty() || !mapped_file_open(&blob->file, path.c_str())) return false;
+
+    ConfigCacheHeader header;
+    bool valid = blob->file.size >= sizeof(header);
+    if (valid) {
+        memcpy(&header, blob->file.data, sizeof(header));
+        valid = memcmp(header.magic, CONFIG_CACHE_MAGIC, sizeof(header.magic)) == 0 &&
+                header.version == CONFIG_CACHE_VERSION &&
+                header.pointer_size == sizeof(void*) &&
+                header.key == key &&
+                header.payload_size == blob->file.size - sizeof(header);
+    }
+    if (!valid) {
+        // Truncated or foreign file: the next bake overwrites it
+        fprintf(stderr, "[ConfigCache] Ignoring invalid blob %s\n", path.c_str());
+        s_rejected++;
+        mapped_file_close(&blob->file);
+        return false;
+    }
+
+    blob->payload = blob->file.data + sizeof(header);
+    blob->payload_size = (size_t)header.payload_size;
+    return true;
+}
+
+extern "C" {
+
+bool config_cache_init(const char* dir) {
+    std::lock_guard<std::mutex> lock(s_mutex);
+
+    s_dir.clear();
+    if (!dir || !dir[0]) return true;
+
+    std::error_code ec;
+    std::filesystem::create_directories(dir, ec);
+    if (ec) {
+        fprintf(stderr, "[ConfigCache] Cannot create '%s' (%s), loading JSON only\n",
+                dir, ec.message().c_str());
+        return false;
+    }
+    s_dir = dir;
+    return true;
+}
+
+bool config_cache_enabled(void) {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    return !s_dir.empty();
+}
+
+// FNV-1a 64
+uint64_t config_cache_hash(uint64_t key, const void* data, size_t size) {
+    const unsigned char* p = (const unsigned char*)data;
+    for (size_t i = 0; i < size; i++) {
+        key ^= p[i];
+        key *= 1099511628211ull;
+    }
+    return key;
+}
+
+uint64_t config_cache_key(const char* kind, size_t struct_size) {
+    uint64_t key = 14695981039346656037ull;
+    uint32_t header[3] = { CONFIG_CACHE_VERSION, (uint32_t)sizeof(void*), (uint32_t)struct_size };
+    key = config_cache_hash(key, header, sizeof(header));
+    // Blobs hold the output of the resolving code, so a rebuild with any
+    // source change must not reuse them
+    key = config_cache_hash(key, ARENA_BUILD_ID, sizeof(ARENA_BUILD_ID));
+    return config_cache_hash(key, kind, strlen(kind) + 1);
+}
+
+bool config_cache_hash_file(uint64_t* key, const char* path) {
+    MappedFile mf;
+    if (!mapped_file_open(&mf, path)) return false;
+
+    uint64_t size = mf.size;
+    *key = config_cache_hash(*key, &size, sizeof(size));  // Separates consecutive files
+    *key = config_cache_hash(*key, mf.data, mf.size);
+    mapped_file_close(&mf);
+    return true;
+}
+
+bool config_cache_open(const char* kind, uint64_t key, ConfigBlob* blob) {
+    if (!open_blob(kind, key, blob)) return false;
+    s_hits++;
+    return true;
+}
+
+void config_cache_close(ConfigBlob* blob) {
+    if (!blob) return;
+    mapped_file_close(&blob->file);
+    memset(blob, 0, sizeof(*blob));
+}
+
+bool config_cache_load(const char* kind, uint64_t key, void* out, size_t size) {
+    ConfigBlob blob;
+    if (!open_blob(kind, key, &blob)) return false;
+
+    bool ok = blob.payload_size == size;
+    if (ok) {
+        memcpy(out, blob.payload, size);
+        s_hits++;
+    } else {
+        s_rejected++;
+    }
+    config_cache_close(&blob);
+    return ok;
+}
+
+bool config_cache_store(const char* kind, uint64_t key, const void* data, size_t size) {
+    std::string path = blob_path(kind, key);
+    if (path.empty()) return false;
+
+    ConfigCacheHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, CONFIG_CACHE_MAGIC, sizeof(header.magic));
+    header.version = CONFIG_CACHE_VERSION;
+    header.pointer_size = (uint32_t)sizeof(void*);
+    header.key = key;
+    header.payload_size = size;
+
+    // Unique temp name: other threads and processes may bake the same blob
+    char suffix[64];
+    uint64_t stamp = (uint64_t)std::chrono::steady_clock::now().time_since_epoch().count();
+    stamp ^= (uint64_t)std::hash<std::thread::id>()(std::this_thread::get_id());
+    snprintf(suffix, sizeof(suffix), ".%llx-%u.tmp",
+             (unsigned long long)stamp, (unsigned)s_tmp_counter++);
+    std::string tmp = path + suffix;
+
+    FILE* f = fopen(tmp.c_str(), "wb");
+    if (!f) return false;
+    bool ok = fwrite(&header, sizeof(header), 1, f) == 1 &&
+              (size == 0 || fwrite(data, 1, size, f) == size);
+    ok = (fclose(f) == 0) && ok;
+
+    std::error_code ec;
+    if (ok) std::filesystem::rename(tmp, path, ec);
+    if (!ok || ec) {
+        std::filesystem::remove(tmp, ec);
+        return false;
+    }
+    s_baked++;
+    return true;
+}
+
+ConfigCacheStats config_cache_get_stats(void) {
+    ConfigCacheStats stats;
+    stats.hits = s_hits.load();
+    stats.baked = s_baked.load();
+    stats.rejected = s_rejected.load();
+    return stats;
+}
+
+} // extern "C"
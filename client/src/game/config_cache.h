@@ -0,0 +1,86 @@
+/*
+ * Baked Config Cache
+ * Binary snapshots of fully resolved config structs (equipment tables,
+ * VehicleJSON, SceneJSON, physics mode, friction curve) and of parsed OBJ
+ * meshes (obj_loader.cpp).
+ *
+ * The loaders bake a blob after a successful JSON load and map it on later
+ * runs instead of parsing and validating again. Blobs are keyed by a hash of
+ * the source JSON bytes (and of whatever else the result depends on, e.g.
+ * vehicles include the equipment hash), the struct size, CONFIG_CACHE_VERSION
+ * and the build id (a hash of the code, see cmake/build_id.cmake), so an
+ * edited file, a rebuilt struct layout, changed loader code or a format bump
+ * simply misses and falls back to JSON. Meshes are keyed by path, mtime and
+ * size instead, so a hit never reads the OBJ.
+ *
+ * Disabled until config_cache_init is given a directory. Once initialized,
+ * lookups and stores are safe from any thread.
+ *
+ * Blob file: <dir>/<kind>-<key>.bin = ConfigCacheHeader + payload, written
+ * to a temp file and renamed so a reader never sees half a blob.
+ */
+
+#ifndef CONFIG_CACHE_H
+#define CONFIG_CACHE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "../util/mapped_file.h"
+
+// Bump when the blob format changes (code changes already change the build id)
+#define CONFIG_CACHE_VERSION 1
+
+typedef struct {
+    char magic[8];          // "ARNBAKE"
+    uint32_t version;       // CONFIG_CACHE_VERSION
+    uint32_t pointer_size;
+    uint64_t key;
+    uint64_t payload_size;
+} ConfigCacheHeader;
+
+// A mapped blob; payload points just past the header (8-byte aligned)
+typedef struct {
+    MappedFile file;
+    const void* payload;
+    size_t payload_size;
+} ConfigBlob;
+
+typedef struct {
+    uint32_t hits;          // Loaded from a blob
+    uint32_t baked;         // Parsed from JSON and written
+    uint32_t rejected;      // Blob present but unusable (replaced on bake)
+} ConfigCacheStats;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Store blobs in dir (created if missing). NULL or "" disables the cache.
+bool config_cache_init(const char* dir);
+bool config_cache_enabled(void);
+
+// Key building: start from the kind and struct size, then mix in sources
+uint64_t config_cache_key(const char* kind, size_t struct_size);
+uint64_t config_cache_hash(uint64_t key, const void* data, size_t size);
+
+// Mix a file's contents into *key. False if it cannot be read.
+bool config_cache_hash_file(uint64_t* key, const char* path);
+
+// Map the blob for key. False (and nothing to close) on a miss.
+bool config_cache_open(const char* kind, uint64_t key, ConfigBlob* blob);
+void config_cache_close(ConfigBlob* blob);
+
+// Copy a fixed-size blob into out. False on a miss or size mismatch.
+bool config_cache_load(const char* kind, uint64_t key, void* out, size_t size);
+
+// Bake data as the blob for key
+bool config_cache_store(const char* kind, uint64_t key, const void* data, size_t size);
+
+ConfigCacheStats config_cache_get_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CONFIG_CACHE_H
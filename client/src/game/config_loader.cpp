@@ -3,64 +3,28 @@
  */
 
 #include "config_loader.h"
+#include "config_cache.h"
 #include "equipment_loader.h"
 #include "handling.h"
-#include "../vendor/cJSON.h"
+#include "../util/json_reader.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
-#ifdef _WIN32
-#include <direct.h>
-#define getcwd _getcwd
-#else
-#include <unistd.h>
-#endif
-
-// Read entire file into memory
-static char* read_file(const char* filepath) {
-    FILE* f = fopen(filepath, "rb");
-    if (!f) {
-        // Print current working directory for debugging
-        char cwd[1024];
-        if (getcwd(cwd, sizeof(cwd)) != NULL) {
-            fprintf(stderr, "CWD: %s\n", cwd);
-        }
-        fprintf(stderr, "Failed to open: %s\n", filepath);
-        return NULL;
-    }
-
-    fseek(f, 0, SEEK_END);
-    long size = ftell(f);
-    fseek(f, 0, SEEK_SET);
-
-    char* buffer = (char*)malloc(size + 1);
-    if (!buffer) {
-        fclose(f);
-        return NULL;
-    }
-
-    fread(buffer, 1, size, f);
-    buffer[size] = '\0';
-    fclose(f);
-    return buffer;
-}
-
 // Helper: get float from JSON object
-static float json_get_float(cJSON* obj, const char* key, float def) {
-    cJSON* item = cJSON_GetObjectItem(obj, key);
-    if (item && cJSON_IsNumber(item)) {
-        return (float)item->valuedouble;
+static float json_get_float(JsonValue obj, const char* key, float def) {
+    JsonValue item = json_field(obj, key);
+    if (json_is_number(item)) {
+        return (float)json_number(item);
     }
     return def;
 }
 
 // Helper: get string from JSON object
-static void json_get_string(cJSON* obj, const char* key, char* out, int maxlen, const char* def) {
-    cJSON* item = cJSON_GetObjectItem(obj, key);
-    if (item && cJSON_IsString(item)) {
-        strncpy(out, item->valuestring, maxlen - 1);
-        out[maxlen - 1] = '\0';
+static void json_get_string(JsonValue obj, const char* key, char* out, int maxlen, const char* def) {
+    JsonValue item = json_field(obj, key);
+    if (json_is_string(item)) {
+        json_string(item, out, (size_t)maxlen);
     } else {
         strncpy(out, def, maxlen - 1);
         out[maxlen - 1] = '\0';
@@ -68,13 +32,13 @@ static void json_get_string(cJSON* obj, const char* key, char* out, int maxlen,
 }
 
 // Helper: get Vec3 from JSON array [x, y, z]
-static Vec3 json_get_vec3(cJSON* obj, const char* key, Vec3 def) {
-    cJSON* arr = cJSON_GetObjectItem(obj, key);
-    if (arr && cJSON_IsArray(arr) && cJSON_GetArraySize(arr) >= 3) {
+static Vec3 json_get_vec3(JsonValue obj, const char* key, Vec3 def) {
+    JsonValue arr = json_field(obj, key);
+    if (json_is_array(arr) && json_count(arr) >= 3) {
         return vec3(
-            (float)cJSON_GetArrayItem(arr, 0)->valuedouble,
-            (float)cJSON_GetArrayItem(arr, 1)->valuedouble,
-            (float)cJSON_GetArrayItem(arr, 2)->valuedouble
+            (float)json_number(json_index(arr, 0)),
+            (float)json_number(json_index(arr, 1)),
+            (float)json_number(json_index(arr, 2))
         );
     }
     return def;
@@ -103,21 +67,21 @@ static int wheel_id_to_index(const char* id) {
 }
 
 // Helper: get bool from JSON
-static bool json_get_bool(cJSON* obj, const char* key, bool def) {
-    cJSON* item = cJSON_GetObjectItem(obj, key);
-    if (item && cJSON_IsBool(item)) {
-        return cJSON_IsTrue(item);
+static bool json_get_bool(JsonValue obj, const char* key, bool def) {
+    JsonValue item = json_field(obj, key);
+    if (json_is_bool(item)) {
+        return json_is_true(item);
     }
     return def;
 }
 
 // Helper: parse Vec3 from array directly
-static Vec3 json_array_to_vec3(cJSON* arr, Vec3 def) {
-    if (arr && cJSON_IsArray(arr) && cJSON_GetArraySize(arr) >= 3) {
+static Vec3 json_array_to_vec3(JsonValue arr, Vec3 def) {
+    if (json_is_array(arr) && json_count(arr) >= 3) {
         return vec3(
-            (float)cJSON_GetArrayItem(arr, 0)->valuedouble,
-            (float)cJSON_GetArrayItem(arr, 1)->valuedouble,
-            (float)cJSON_GetArrayItem(arr, 2)->valuedouble
+            (float)json_number(json_index(arr, 0)),
+            (float)json_number(json_index(arr, 1)),
+            (float)json_number(json_index(arr, 2))
         );
     }
     return def;
@@ -225,6 +189,7 @@ static bool validate_vehicle_config(const VehicleJSON* v, const char* filepath)
 // Parsed tire config (from vehicle JSON tires array)
 typedef struct {
     char id[32];
+    uint32_t id_hash;       // equipment_id_hash, checked before strcmp
     char type[64];
     char modifiers[4][64];
     int modifier_count;
@@ -232,41 +197,43 @@ typedef struct {
     float width;
     // Which wheel IDs this tire applies to (new format)
     char wheel_ids[MAX_WHEEL_MOUNTS][16];
+    uint32_t wheel_hashes[MAX_WHEEL_MOUNTS];
     int wheel_count;
 } ParsedTireConfig;
 
-static ParsedTireConfig s_parsed_tires[16];
-static int s_parsed_tire_count = 0;
+// Per thread: vehicle configs may load in parallel (startup job graph)
+static thread_local ParsedTireConfig s_parsed_tires[16];
+static thread_local int s_parsed_tire_count = 0;
 
 // Parse tires array
-static void parse_tires_array(cJSON* tires_arr) {
+static void parse_tires_array(JsonValue tires_arr) {
     s_parsed_tire_count = 0;
-    cJSON* t;
-    cJSON_ArrayForEach(t, tires_arr) {
+    JsonValue t;
+    JSON_FOR_EACH(t, tires_arr) {
         if (s_parsed_tire_count >= 16) break;
         ParsedTireConfig* tire = &s_parsed_tires[s_parsed_tire_count];
 
         json_get_string(t, "id", tire->id, 32, "");
+        tire->id_hash = equipment_id_hash(tire->id);
         json_get_string(t, "type", tire->type, 64, "tire_standard");
 
         // Parse modifiers array
         tire->modifier_count = 0;
-        cJSON* mods = cJSON_GetObjectItem(t, "modifiers");
-        if (mods && cJSON_IsArray(mods)) {
-            cJSON* m;
-            cJSON_ArrayForEach(m, mods) {
+        JsonValue mods = json_field(t, "modifiers");
+        if (json_is_array(mods)) {
+            JsonValue m;
+            JSON_FOR_EACH(m, mods) {
                 if (tire->modifier_count >= 4) break;
-                if (cJSON_IsString(m)) {
-                    strncpy(tire->modifiers[tire->modifier_count], m->valuestring, 63);
-                    tire->modifiers[tire->modifier_count][63] = '\0';
+                if (json_is_string(m)) {
+                    json_string(m, tire->modifiers[tire->modifier_count], 64);
                     tire->modifier_count++;
                 }
             }
         }
 
         // Parse size
-        cJSON* size = cJSON_GetObjectItem(t, "size");
-        if (size) {
+        JsonValue size = json_field(t, "size");
+        if (json_is_object(size)) {
             tire->radius = json_get_float(size, "radius", 0.35f);
             tire->width = json_get_float(size, "width", 0.2f);
         } else {
@@ -276,14 +243,14 @@ static void parse_tires_array(cJSON* tires_arr) {
 
         // Parse wheels array (which wheel positions this tire applies to)
         tire->wheel_count = 0;
-        cJSON* wheels_arr = cJSON_GetObjectItem(t, "wheels");
-        if (wheels_arr && cJSON_IsArray(wheels_arr)) {
-            cJSON* wid;
-            cJSON_ArrayForEach(wid, wheels_arr) {
+        JsonValue wheels_arr = json_field(t, "wheels");
+        if (json_is_array(wheels_arr)) {
+            JsonValue wid;
+            JSON_FOR_EACH(wid, wheels_arr) {
                 if (tire->wheel_count >= MAX_WHEEL_MOUNTS) break;
-                if (cJSON_IsString(wid)) {
-                    strncpy(tire->wheel_ids[tire->wheel_count], wid->valuestring, 15);
-                    tire->wheel_ids[tire->wheel_count][15] = '\0';
+                if (json_is_string(wid)) {
+                    json_string(wid, tire->wheel_ids[tire->wheel_count], 16);
+                    tire->wheel_hashes[tire->wheel_count] = equipment_id_hash(tire->wheel_ids[tire->wheel_count]);
                     tire->wheel_count++;
                 }
             }
@@ -295,8 +262,9 @@ static void parse_tires_array(cJSON* tires_arr) {
 
 // Find parsed tire by tire ID (e.g., "front_tires")
 static ParsedTireConfig* find_parsed_tire(const char* id) {
+    uint32_t hash = equipment_id_hash(id);
     for (int i = 0; i < s_parsed_tire_count; i++) {
-        if (strcmp(s_parsed_tires[i].id, id) == 0) {
+        if (s_parsed_tires[i].id_hash == hash && strcmp(s_parsed_tires[i].id, id) == 0) {
             return &s_parsed_tires[i];
         }
     }
@@ -305,9 +273,11 @@ static ParsedTireConfig* find_parsed_tire(const char* id) {
 
 // Find parsed tire that applies to a given wheel ID (e.g., "FL")
 static ParsedTireConfig* find_tire_for_wheel(const char* wheel_id) {
+    uint32_t hash = equipment_id_hash(wheel_id);
     for (int i = 0; i < s_parsed_tire_count; i++) {
         for (int w = 0; w < s_parsed_tires[i].wheel_count; w++) {
-            if (strcmp(s_parsed_tires[i].wheel_ids[w], wheel_id) == 0) {
+            if (s_parsed_tires[i].wheel_hashes[w] == hash &&
+                strcmp(s_parsed_tires[i].wheel_ids[w], wheel_id) == 0) {
                 return &s_parsed_tires[i];
             }
         }
@@ -333,32 +303,34 @@ static WheelSide infer_wheel_side(float z_pos) {
     return WHEEL_SIDE_CENTER;
 }
 
-static void parse_wheels(cJSON* wheels_arr, VehicleJSON* out) {
+static void parse_wheels(JsonValue wheels_arr, VehicleJSON* out) {
     out->wheel_count = 0;
-    cJSON* w;
-    cJSON_ArrayForEach(w, wheels_arr) {
+    JsonValue w;
+    JSON_FOR_EACH(w, wheels_arr) {
         if (out->wheel_count >= MAX_WHEELS) break;
 
         WheelDef* wheel = &out->wheels[out->wheel_count];
         json_get_string(w, "id", wheel->id, 16, "W");
-        wheel->position = json_array_to_vec3(cJSON_GetObjectItem(w, "position"), vec3(0, 0, 0));
+        wheel->position = json_array_to_vec3(json_field(w, "position"), vec3(0, 0, 0));
 
         // Initialize semantic fields
         wheel->axle_index = -1;  // Will be populated after axle parsing
 
         // Parse or infer wheel side
-        cJSON* side_item = cJSON_GetObjectItem(w, "side");
-        if (side_item && cJSON_IsString(side_item)) {
-            wheel->side = parse_wheel_side(side_item->valuestring);
+        JsonValue side_item = json_field(w, "side");
+        if (json_is_string(side_item)) {
+            char side[16];
+            wheel->side = parse_wheel_side(json_string(side_item, side, sizeof(side)));
         } else {
             // Infer from Z position (JSON coords: positive Z = left)
             wheel->side = infer_wheel_side(wheel->position.z);
         }
 
         // Check for tire reference
-        cJSON* tire_ref = cJSON_GetObjectItem(w, "tire");
-        if (tire_ref && cJSON_IsString(tire_ref)) {
-            ParsedTireConfig* tire = find_parsed_tire(tire_ref->valuestring);
+        JsonValue tire_ref = json_field(w, "tire");
+        if (json_is_string(tire_ref)) {
+            char tire_id[32];
+            ParsedTireConfig* tire = find_parsed_tire(json_string(tire_ref, tire_id, sizeof(tire_id)));
             if (tire) {
                 wheel->radius = tire->radius;
                 wheel->width = tire->width;
@@ -405,25 +377,24 @@ static AxlePosition infer_axle_position(const char* name, int axle_index, int to
 }
 
 // Parse axles array (with per-axle suspension/brakes support)
-static void parse_axles(cJSON* axles_arr, VehicleJSON* out, int* hc_suspension_out) {
+static void parse_axles(JsonValue axles_arr, VehicleJSON* out, int* hc_suspension_out) {
     out->axle_count = 0;
     int best_suspension_hc = 0;  // Track best suspension HC found
 
     // First pass: count axles
     int total_axles = 0;
-    cJSON* a_count;
-    cJSON_ArrayForEach(a_count, axles_arr) { total_axles++; }
+    JsonValue a_count;
+    JSON_FOR_EACH(a_count, axles_arr) { total_axles++; }
 
-    cJSON* a;
-    cJSON_ArrayForEach(a, axles_arr) {
+    JsonValue a;
+    JSON_FOR_EACH(a, axles_arr) {
         if (out->axle_count >= MAX_AXLES) break;
 
         AxleDef* axle = &out->axles[out->axle_count];
         // Try "id" first, then "name" for backwards compatibility
-        cJSON* id_item = cJSON_GetObjectItem(a, "id");
-        if (id_item && cJSON_IsString(id_item)) {
-            strncpy(axle->name, id_item->valuestring, MAX_NAME_LENGTH - 1);
-            axle->name[MAX_NAME_LENGTH - 1] = '\0';
+        JsonValue id_item = json_field(a, "id");
+        if (json_is_string(id_item)) {
+            json_string(id_item, axle->name, MAX_NAME_LENGTH);
         } else {
             json_get_string(a, "name", axle->name, MAX_NAME_LENGTH, "axle");
         }
@@ -432,27 +403,30 @@ static void parse_axles(cJSON* axles_arr, VehicleJSON* out, int* hc_suspension_o
         axle->max_steer_angle = json_get_float(a, "max_steer_angle", 0.6f);
 
         // Parse semantic fields: position and handbrake
-        cJSON* pos_item = cJSON_GetObjectItem(a, "position");
-        if (pos_item && cJSON_IsString(pos_item)) {
-            axle->position = parse_axle_position(pos_item->valuestring);
+        JsonValue pos_item = json_field(a, "position");
+        if (json_is_string(pos_item)) {
+            char position[16];
+            axle->position = parse_axle_position(json_string(pos_item, position, sizeof(position)));
         } else {
             axle->position = infer_axle_position(axle->name, out->axle_count, total_axles);
         }
 
         // Handbrake: explicit or default to rear axle
-        cJSON* handbrake_item = cJSON_GetObjectItem(a, "handbrake");
-        if (handbrake_item && cJSON_IsBool(handbrake_item)) {
-            axle->has_handbrake = cJSON_IsTrue(handbrake_item);
+        JsonValue handbrake_item = json_field(a, "handbrake");
+        if (json_is_bool(handbrake_item)) {
+            axle->has_handbrake = json_is_true(handbrake_item);
         } else {
             // Default: handbrake on rear axle
             axle->has_handbrake = (axle->position == AXLE_POSITION_REAR);
         }
 
         // Parse per-axle suspension (can be string ID or object)
-        cJSON* axle_susp = cJSON_GetObjectItem(a, "suspension");
-        if (axle_susp && cJSON_IsString(axle_susp)) {
+        JsonValue axle_susp = json_field(a, "suspension");
+        if (json_is_string(axle_susp)) {
             // New format: suspension is an equipment ID string
-            const SuspensionEquipment* susp = equipment_find_suspension(axle_susp->valuestring);
+            char susp_id[MAX_EQUIPMENT_ID];
+            json_string(axle_susp, susp_id, sizeof(susp_id));
+            const SuspensionEquipment* susp = equipment_find_suspension(susp_id);
             if (susp) {
                 axle->has_suspension = true;
                 axle->suspension_frequency = susp->frequency;
@@ -463,10 +437,10 @@ static void parse_axles(cJSON* axles_arr, VehicleJSON* out, int* hc_suspension_o
                     best_suspension_hc = susp->hc_car;
                 }
             } else {
-                fprintf(stderr, "Warning: Suspension '%s' not found, using defaults\n", axle_susp->valuestring);
+                fprintf(stderr, "Warning: Suspension '%s' not found, using defaults\n", susp_id);
                 axle->has_suspension = false;
             }
-        } else if (axle_susp && cJSON_IsObject(axle_susp)) {
+        } else if (json_is_object(axle_susp)) {
             // Legacy format: suspension is an object with values
             axle->has_suspension = true;
             axle->suspension_frequency = json_get_float(axle_susp, "frequency", out->defaults.suspension.frequency);
@@ -477,13 +451,15 @@ static void parse_axles(cJSON* axles_arr, VehicleJSON* out, int* hc_suspension_o
         }
 
         // Parse per-axle brakes (string ID)
-        cJSON* axle_brakes = cJSON_GetObjectItem(a, "brakes");
-        if (axle_brakes && cJSON_IsString(axle_brakes)) {
-            const BrakeEquipment* brk = equipment_find_brake(axle_brakes->valuestring);
+        JsonValue axle_brakes = json_field(a, "brakes");
+        if (json_is_string(axle_brakes)) {
+            char brake_id[MAX_EQUIPMENT_ID];
+            json_string(axle_brakes, brake_id, sizeof(brake_id));
+            const BrakeEquipment* brk = equipment_find_brake(brake_id);
             if (brk) {
                 axle->brake_force_multiplier = brk->brake_force_multiplier;
             } else {
-                fprintf(stderr, "Warning: Brakes '%s' not found, using default\n", axle_brakes->valuestring);
+                fprintf(stderr, "Warning: Brakes '%s' not found, using default\n", brake_id);
                 axle->brake_force_multiplier = 8.0f;
             }
         } else {
@@ -492,14 +468,13 @@ static void parse_axles(cJSON* axles_arr, VehicleJSON* out, int* hc_suspension_o
 
         // Parse wheel IDs array
         axle->wheel_count = 0;
-        cJSON* wheel_ids = cJSON_GetObjectItem(a, "wheels");
-        if (wheel_ids && cJSON_IsArray(wheel_ids)) {
-            cJSON* wid;
-            cJSON_ArrayForEach(wid, wheel_ids) {
+        JsonValue wheel_ids = json_field(a, "wheels");
+        if (json_is_array(wheel_ids)) {
+            JsonValue wid;
+            JSON_FOR_EACH(wid, wheel_ids) {
                 if (axle->wheel_count >= MAX_WHEELS_PER_AXLE) break;
-                if (cJSON_IsString(wid)) {
-                    strncpy(axle->wheel_ids[axle->wheel_count], wid->valuestring, 15);
-                    axle->wheel_ids[axle->wheel_count][15] = '\0';
+                if (json_is_string(wid)) {
+                    json_string(wid, axle->wheel_ids[axle->wheel_count], 16);
                     axle->wheel_count++;
                 }
             }
@@ -513,7 +488,7 @@ static void parse_axles(cJSON* axles_arr, VehicleJSON* out, int* hc_suspension_o
     }
 }
 
-bool config_load_vehicle(const char* filepath, VehicleJSON* out) {
+static bool load_vehicle_json(const char* filepath, VehicleJSON* out) {
     *out = config_default_vehicle();
 
     // Track HC components for final calculation
@@ -521,29 +496,22 @@ bool config_load_vehicle(const char* filepath, VehicleJSON* out) {
     int hc_suspension = 0;   // From suspension type (e.g., improved = 2)
     int hc_tires = 0;        // From tire modifiers (e.g., radials +1)
 
-    char* json_str = read_file(filepath);
-    if (!json_str) {
-        fprintf(stderr, "ERROR: Vehicle config required but not found: %s\n", filepath);
+    JsonDoc doc;
+    if (!json_doc_open(&doc, filepath)) {
+        fprintf(stderr, "ERROR: Vehicle config required but not loaded: %s\n", filepath);
         fprintf(stderr, "       Game will use defaults but physics may be wrong!\n");
         return false;
     }
-
-    cJSON* root = cJSON_Parse(json_str);
-    free(json_str);
-
-    if (!root) {
-        fprintf(stderr, "JSON parse error in %s\n", filepath);
-        return false;
-    }
+    JsonValue root = doc.root;
 
     // Meta info
     char class_str[MAX_NAME_LENGTH];
     json_get_string(root, "class", class_str, MAX_NAME_LENGTH, "wheeled");
     out->vehicle_class = parse_vehicle_class(class_str);
 
-    cJSON* version_item = cJSON_GetObjectItem(root, "version");
-    if (version_item && cJSON_IsNumber(version_item)) {
-        out->version = version_item->valueint;
+    JsonValue version_item = json_field(root, "version");
+    if (json_is_number(version_item)) {
+        out->version = (int)json_number(version_item);
     }
 
     json_get_string(root, "name", out->name, MAX_NAME_LENGTH, "default");
@@ -553,22 +521,22 @@ bool config_load_vehicle(const char* filepath, VehicleJSON* out) {
 
     // Chassis - can be string ID or object with body reference
     const ChassisEquipment* chassis_equip = NULL;
-    cJSON* chassis = cJSON_GetObjectItem(root, "chassis");
-    if (chassis) {
-        const char* chassis_id = NULL;
+    JsonValue chassis = json_field(root, "chassis");
+    if (json_type(chassis) != JSON_MISSING) {
+        char chassis_id[MAX_EQUIPMENT_ID] = "";
 
-        if (cJSON_IsString(chassis)) {
+        if (json_is_string(chassis)) {
             // New format: direct string reference e.g., "chassis": "compact"
-            chassis_id = chassis->valuestring;
-        } else if (cJSON_IsObject(chassis)) {
+            json_string(chassis, chassis_id, sizeof(chassis_id));
+        } else if (json_is_object(chassis)) {
             // Legacy format: object with body field e.g., "chassis": { "body": "compact" }
-            cJSON* body_ref = cJSON_GetObjectItem(chassis, "body");
-            if (body_ref && cJSON_IsString(body_ref)) {
-                chassis_id = body_ref->valuestring;
+            JsonValue body_ref = json_field(chassis, "body");
+            if (json_is_string(body_ref)) {
+                json_string(body_ref, chassis_id, sizeof(chassis_id));
             }
         }
 
-        if (chassis_id) {
+        if (chassis_id[0] != '\0') {
             chassis_equip = equipment_find_chassis(chassis_id);
             if (chassis_equip) {
                 // Start with defaults from chassis equipment
@@ -595,7 +563,7 @@ bool config_load_vehicle(const char* filepath, VehicleJSON* out) {
             } else {
                 fprintf(stderr, "Warning: Chassis '%s' not found, using defaults\n", chassis_id);
             }
-        } else if (cJSON_IsObject(chassis)) {
+        } else if (json_is_object(chassis)) {
             // Legacy format: direct dimension values in object
             out->chassis_mass = json_get_float(chassis, "mass", out->chassis_mass);
             out->chassis_length = json_get_float(chassis, "length", out->chassis_length);
@@ -619,19 +587,19 @@ bool config_load_vehicle(const char* filepath, VehicleJSON* out) {
     }
 
     // Parse defaults block
-    cJSON* defaults = cJSON_GetObjectItem(root, "defaults");
-    if (defaults && cJSON_IsObject(defaults)) {
+    JsonValue defaults = json_field(root, "defaults");
+    if (json_is_object(defaults)) {
         // Parse defaults.wheel
-        cJSON* def_wheel = cJSON_GetObjectItem(defaults, "wheel");
-        if (def_wheel && cJSON_IsObject(def_wheel)) {
+        JsonValue def_wheel = json_field(defaults, "wheel");
+        if (json_is_object(def_wheel)) {
             out->defaults.wheel.radius = json_get_float(def_wheel, "radius", out->defaults.wheel.radius);
             out->defaults.wheel.width = json_get_float(def_wheel, "width", out->defaults.wheel.width);
             out->defaults.wheel.mass = json_get_float(def_wheel, "mass", out->defaults.wheel.mass);
             out->defaults.wheel.friction = json_get_float(def_wheel, "friction", out->defaults.wheel.friction);
         }
         // Parse defaults.suspension (Jolt style: frequency/damping)
-        cJSON* def_susp = cJSON_GetObjectItem(defaults, "suspension");
-        if (def_susp && cJSON_IsObject(def_susp)) {
+        JsonValue def_susp = json_field(defaults, "suspension");
+        if (json_is_object(def_susp)) {
             out->defaults.suspension.frequency = json_get_float(def_susp, "frequency", out->defaults.suspension.frequency);
             out->defaults.suspension.damping = json_get_float(def_susp, "damping", out->defaults.suspension.damping);
             out->defaults.suspension.travel = json_get_float(def_susp, "travel", out->defaults.suspension.travel);
@@ -639,14 +607,14 @@ bool config_load_vehicle(const char* filepath, VehicleJSON* out) {
     }
 
     // Parse tires array first (needed for wheel parsing)
-    cJSON* tires = cJSON_GetObjectItem(root, "tires");
-    if (tires && cJSON_IsArray(tires)) {
+    JsonValue tires = json_field(root, "tires");
+    if (json_is_array(tires)) {
         parse_tires_array(tires);
     }
 
     // Build wheels: new format uses chassis wheel_mounts + tires, legacy uses wheels array
-    cJSON* wheels = cJSON_GetObjectItem(root, "wheels");
-    if (wheels && cJSON_IsArray(wheels)) {
+    JsonValue wheels = json_field(root, "wheels");
+    if (json_is_array(wheels)) {
         // Legacy format: parse wheels array directly
         parse_wheels(wheels, out);
     } else if (chassis_equip && chassis_equip->wheel_mount_count > 0) {
@@ -702,8 +670,8 @@ bool config_load_vehicle(const char* filepath, VehicleJSON* out) {
     }
 
     // Parse axles array
-    cJSON* axles = cJSON_GetObjectItem(root, "axles");
-    if (axles && cJSON_IsArray(axles)) {
+    JsonValue axles = json_field(root, "axles");
+    if (json_is_array(axles)) {
         parse_axles(axles, out, &hc_suspension);
     }
 
@@ -746,17 +714,16 @@ bool config_load_vehicle(const char* filepath, VehicleJSON* out) {
 
     // ========== MATCHBOX CAR PHYSICS - Power Plant ==========
     // Read power_plant from drivetrain section (preferred) or top level (legacy)
-    cJSON* drivetrain_section = cJSON_GetObjectItem(root, "drivetrain");
-    cJSON* pp_ref = NULL;
-    if (drivetrain_section) {
-        pp_ref = cJSON_GetObjectItem(drivetrain_section, "power_plant");
-    }
-    if (!pp_ref) {
+    JsonValue drivetrain_section = json_field(root, "drivetrain");
+    JsonValue pp_ref = json_field(drivetrain_section, "power_plant");
+    if (json_type(pp_ref) == JSON_MISSING) {
         // Fallback to top-level for backwards compatibility
-        pp_ref = cJSON_GetObjectItem(root, "power_plant");
+        pp_ref = json_field(root, "power_plant");
     }
-    if (pp_ref && cJSON_IsString(pp_ref)) {
-        const PowerPlantEquipment* pp = equipment_find_power_plant(pp_ref->valuestring);
+    if (json_is_string(pp_ref)) {
+        char pp_id[MAX_EQUIPMENT_ID];
+        json_string(pp_ref, pp_id, sizeof(pp_id));
+        const PowerPlantEquipment* pp = equipment_find_power_plant(pp_id);
         if (pp) {
             // Add power plant weight to chassis mass
             out->chassis_mass += pp->weight_kg;
@@ -790,7 +757,7 @@ bool config_load_vehicle(const char* filepath, VehicleJSON* out) {
                    out->chassis_mass, weight_lbs, pp->horsepower / (out->chassis_mass / 1000.0f));
             printf("  Redline: %.0f RPM, Idle: %.0f RPM\n", pp->redline_rpm, pp->idle_rpm);
         } else {
-            fprintf(stderr, "Warning: Power plant '%s' not found\n", pp_ref->valuestring);
+            fprintf(stderr, "Warning: Power plant '%s' not found\n", pp_id);
         }
     } else {
         // No power plant - set defaults for testing
@@ -874,13 +841,15 @@ bool config_load_vehicle(const char* filepath, VehicleJSON* out) {
 
     // ========== DRIVETRAIN SECTION ==========
     // Parse drivetrain if present - overrides defaults (use drivetrain_section from above)
-    if (drivetrain_section) {
+    if (json_is_object(drivetrain_section)) {
         // Engine physics already set above from power plant lookup
 
         // Get gearbox from drivetrain
-        cJSON* gearbox_ref = cJSON_GetObjectItem(drivetrain_section, "gearbox");
-        if (gearbox_ref && cJSON_IsString(gearbox_ref)) {
-            const GearboxEquipment* gb = equipment_find_gearbox(gearbox_ref->valuestring);
+        JsonValue gearbox_ref = json_field(drivetrain_section, "gearbox");
+        if (json_is_string(gearbox_ref)) {
+            char gearbox_id[MAX_EQUIPMENT_ID];
+            json_string(gearbox_ref, gearbox_id, sizeof(gearbox_id));
+            const GearboxEquipment* gb = equipment_find_gearbox(gearbox_id);
             if (gb) {
                 out->physics.gear_count = gb->gear_count;
                 for (int g = 0; g < gb->gear_count && g < MAX_CONFIG_GEARS; g++) {
@@ -899,24 +868,24 @@ bool config_load_vehicle(const char* filepath, VehicleJSON* out) {
                 printf("  Drivetrain: %s (%.0f Nm, %d gears, diff=%.2f)\n",
                        gb->name, out->physics.engine_max_torque, gb->gear_count, gb->differential_ratio);
             } else {
-                fprintf(stderr, "Warning: Gearbox '%s' not found\n", gearbox_ref->valuestring);
+                fprintf(stderr, "Warning: Gearbox '%s' not found\n", gearbox_id);
             }
         }
 
         // Set driven wheels from driven_axles
-        cJSON* driven_axles = cJSON_GetObjectItem(drivetrain_section, "driven_axles");
-        if (driven_axles && cJSON_IsArray(driven_axles)) {
+        JsonValue driven_axles = json_field(drivetrain_section, "driven_axles");
+        if (json_is_array(driven_axles)) {
             // First clear all driven flags
             for (int i = 0; i < 4; i++) {
                 out->physics.wheel_driven[i] = false;
             }
             // Then set driven for each specified axle
-            cJSON* axle_id;
-            cJSON_ArrayForEach(axle_id, driven_axles) {
-                if (!cJSON_IsString(axle_id)) continue;
+            JsonValue axle_id;
+            JSON_FOR_EACH(axle_id, driven_axles) {
+                if (!json_is_string(axle_id)) continue;
                 // Find the axle and mark its wheels as driven
                 for (int a = 0; a < out->axle_count; a++) {
-                    if (strcmp(out->axles[a].name, axle_id->valuestring) == 0) {
+                    if (json_string_is(axle_id, out->axles[a].name)) {
                         for (int w = 0; w < out->axles[a].wheel_count; w++) {
                             int idx = wheel_id_to_index(out->axles[a].wheel_ids[w]);
                             if (idx >= 0 && idx < 4) {
@@ -981,33 +950,33 @@ bool config_load_vehicle(const char* filepath, VehicleJSON* out) {
 
     // ========== SCRIPTS SECTION ==========
     // Parse scripts array for driver assists, AI, etc.
-    cJSON* scripts = cJSON_GetObjectItem(root, "scripts");
+    JsonValue scripts = json_field(root, "scripts");
     out->script_count = 0;
-    if (scripts && cJSON_IsArray(scripts)) {
-        cJSON* script_item;
-        cJSON_ArrayForEach(script_item, scripts) {
+    if (json_is_array(scripts)) {
+        JsonValue script_item;
+        JSON_FOR_EACH(script_item, scripts) {
             if (out->script_count >= MAX_VEHICLE_SCRIPTS) break;
 
             VehicleScript* s = &out->scripts[out->script_count];
             json_get_string(script_item, "name", s->name, MAX_NAME_LENGTH, "unnamed");
             json_get_string(script_item, "path", s->path, MAX_SCRIPT_PATH, "");
             s->enabled = json_get_bool(script_item, "enabled", true);
+            s->native = json_get_bool(script_item, "native", false);
 
             // Parse options object
             s->option_count = 0;
-            cJSON* options = cJSON_GetObjectItem(script_item, "options");
-            if (options && cJSON_IsObject(options)) {
-                cJSON* opt;
-                cJSON_ArrayForEach(opt, options) {
+            JsonValue options = json_field(script_item, "options");
+            if (json_is_object(options)) {
+                JsonValue opt;
+                JSON_FOR_EACH(opt, options) {
                     if (s->option_count >= MAX_SCRIPT_OPTIONS) break;
-                    if (opt->string && (cJSON_IsNumber(opt) || cJSON_IsBool(opt))) {
+                    if (json_is_number(opt) || json_is_bool(opt)) {
                         ScriptOption* so = &s->options[s->option_count];
-                        strncpy(so->key, opt->string, 31);
-                        so->key[31] = '\0';
-                        if (cJSON_IsBool(opt)) {
-                            so->value = cJSON_IsTrue(opt) ? 1.0f : 0.0f;
+                        json_string(opt_iter.key, so->key, 32);
+                        if (json_is_bool(opt)) {
+                            so->value = json_is_true(opt) ? 1.0f : 0.0f;
                         } else {
-                            so->value = (float)opt->valuedouble;
+                            so->value = (float)json_number(opt);
                         }
                         s->option_count++;
                     }
@@ -1015,14 +984,15 @@ bool config_load_vehicle(const char* filepath, VehicleJSON* out) {
             }
 
             if (s->path[0] != '\0') {
-                printf("  Script: %s (%s, %s, %d options)\n",
-                       s->name, s->path, s->enabled ? "enabled" : "disabled", s->option_count);
+                printf("  Script: %s (%s, %s%s, %d options)\n",
+                       s->name, s->path, s->enabled ? "enabled" : "disabled",
+                       s->native ? ", native" : "", s->option_count);
                 out->script_count++;
             }
         }
     }
 
-    cJSON_Delete(root);
+    json_doc_close(&doc);
 
     // Validate that all required fields are present
     if (!validate_vehicle_config(out, filepath)) {
@@ -1045,6 +1015,22 @@ bool config_load_vehicle(const char* filepath, VehicleJSON* out) {
     return true;
 }
 
+bool config_load_vehicle(const char* filepath, VehicleJSON* out) {
+    // Equipment IDs are resolved into the struct, so the equipment is part of the key
+    uint64_t key = config_cache_key("vehicle", sizeof(VehicleJSON));
+    key = config_cache_hash(key, &g_equipment.source_hash, sizeof(g_equipment.source_hash));
+    bool cacheable = g_equipment.source_hash != 0 && config_cache_hash_file(&key, filepath);
+    if (cacheable && config_cache_load("vehicle", key, out, sizeof(*out))) {
+        printf("Loaded vehicle: %s (%d wheels, %d axles, baked)\n",
+               out->name, out->wheel_count, out->axle_count);
+        return true;
+    }
+
+    if (!load_vehicle_json(filepath, out)) return false;
+    if (cacheable) config_cache_store("vehicle", key, out, sizeof(*out));
+    return true;
+}
+
 VehicleConfig config_vehicle_to_physics(const VehicleJSON* json) {
     return json->physics;
 }
@@ -1076,6 +1062,7 @@ SceneJSON config_default_scene(void) {
 
     // Default obstacles
     s.obstacle_count = 5;
+    s.obstacles = (SceneObstacle*)calloc(s.obstacle_count, sizeof(SceneObstacle));
     strcpy(s.obstacles[0].type, "box");
     s.obstacles[0].position = vec3(0, 2.0f, 0);
     s.obstacles[0].size = vec3(5, 4, 5);
@@ -1094,29 +1081,22 @@ SceneJSON config_default_scene(void) {
     return s;
 }
 
-bool config_load_scene(const char* filepath, SceneJSON* out) {
+static bool load_scene_json(const char* filepath, SceneJSON* out) {
     *out = config_default_scene();
 
-    char* json_str = read_file(filepath);
-    if (!json_str) {
-        fprintf(stderr, "ERROR: Scene config required but not found: %s\n", filepath);
+    JsonDoc doc;
+    if (!json_doc_open(&doc, filepath)) {
+        fprintf(stderr, "ERROR: Scene config required but not loaded: %s\n", filepath);
         fprintf(stderr, "       Game will use defaults but layout may be wrong!\n");
         return false;
     }
-
-    cJSON* root = cJSON_Parse(json_str);
-    free(json_str);
-
-    if (!root) {
-        fprintf(stderr, "JSON parse error in %s\n", filepath);
-        return false;
-    }
+    JsonValue root = doc.root;
 
     json_get_string(root, "name", out->name, MAX_NAME_LENGTH, "default");
 
     // Arena
-    cJSON* arena = cJSON_GetObjectItem(root, "arena");
-    if (arena) {
+    JsonValue arena = json_field(root, "arena");
+    if (json_is_object(arena)) {
         out->arena.size = json_get_float(arena, "size", out->arena.size);
         out->arena.wall_height = json_get_float(arena, "wall_height", out->arena.wall_height);
         out->arena.wall_thickness = json_get_float(arena, "wall_thickness", out->arena.wall_thickness);
@@ -1124,23 +1104,23 @@ bool config_load_scene(const char* filepath, SceneJSON* out) {
     }
 
     // World physics (simplified for Jolt)
-    cJSON* world = cJSON_GetObjectItem(root, "world");
-    if (world) {
+    JsonValue world = json_field(root, "world");
+    if (json_is_object(world)) {
         out->world.gravity = json_get_float(world, "gravity", out->world.gravity);
 
-        cJSON* contact = cJSON_GetObjectItem(world, "contact");
-        if (contact) {
+        JsonValue contact = json_field(world, "contact");
+        if (json_is_object(contact)) {
             out->world.contact.friction = json_get_float(contact, "friction", out->world.contact.friction);
             out->world.contact.restitution = json_get_float(contact, "restitution", out->world.contact.restitution);
         }
     }
 
     // Vehicles
-    cJSON* vehicles = cJSON_GetObjectItem(root, "vehicles");
-    if (vehicles && cJSON_IsArray(vehicles)) {
+    JsonValue vehicles = json_field(root, "vehicles");
+    if (json_is_array(vehicles)) {
         out->vehicle_count = 0;
-        cJSON* v;
-        cJSON_ArrayForEach(v, vehicles) {
+        JsonValue v;
+        JSON_FOR_EACH(v, vehicles) {
             if (out->vehicle_count >= MAX_SCENE_VEHICLES) break;
 
             SceneVehicle* sv = &out->vehicles[out->vehicle_count];
@@ -1153,12 +1133,14 @@ bool config_load_scene(const char* filepath, SceneJSON* out) {
     }
 
     // Obstacles
-    cJSON* obstacles = cJSON_GetObjectItem(root, "obstacles");
-    if (obstacles && cJSON_IsArray(obstacles)) {
-        out->obstacle_count = 0;
-        cJSON* o;
-        cJSON_ArrayForEach(o, obstacles) {
-            if (out->obstacle_count >= MAX_SCENE_OBSTACLES) break;
+    JsonValue obstacles = json_field(root, "obstacles");
+    if (json_is_array(obstacles)) {
+        config_free_scene(out);
+        int capacity = json_count(obstacles);
+        out->obstacles = (SceneObstacle*)calloc(capacity > 0 ? capacity : 1, sizeof(SceneObstacle));
+        JsonValue o;
+        JSON_FOR_EACH(o, obstacles) {
+            if (!out->obstacles || out->obstacle_count >= capacity) break;
 
             SceneObstacle* so = &out->obstacles[out->obstacle_count];
             json_get_string(o, "type", so->type, MAX_NAME_LENGTH, "box");
@@ -1170,12 +1152,71 @@ bool config_load_scene(const char* filepath, SceneJSON* out) {
         }
     }
 
-    cJSON_Delete(root);
+    json_doc_close(&doc);
     printf("Loaded scene config: %s (%d vehicles, %d obstacles)\n",
            out->name, out->vehicle_count, out->obstacle_count);
     return true;
 }
 
+// Scene blob: the SceneJSON (obstacles pointer cleared) followed by the obstacles
+static bool scene_from_blob(const ConfigBlob* blob, SceneJSON* out) {
+    if (blob->payload_size < sizeof(SceneJSON)) return false;
+    SceneJSON scene;
+    memcpy(&scene, blob->payload, sizeof(scene));
+    if (scene.obstacle_count < 0 ||
+        blob->payload_size != sizeof(SceneJSON) + (size_t)scene.obstacle_count * sizeof(SceneObstacle)) {
+        return false;
+    }
+
+    scene.obstacles = (SceneObstacle*)calloc(scene.obstacle_count > 0 ? scene.obstacle_count : 1,
+                                             sizeof(SceneObstacle));
+    if (!scene.obstacles) return false;
+    memcpy(scene.obstacles, (const char*)blob->payload + sizeof(SceneJSON),
+           (size_t)scene.obstacle_count * sizeof(SceneObstacle));
+    *out = scene;
+    return true;
+}
+
+static void bake_scene(uint64_t key, const SceneJSON* scene) {
+    size_t obstacles_size = (size_t)scene->obstacle_count * sizeof(SceneObstacle);
+    char* buffer = (char*)malloc(sizeof(SceneJSON) + obstacles_size);
+    if (!buffer) return;
+
+    SceneJSON header = *scene;
+    header.obstacles = NULL;
+    memcpy(buffer, &header, sizeof(header));
+    if (obstacles_size > 0) memcpy(buffer + sizeof(SceneJSON), scene->obstacles, obstacles_size);
+    config_cache_store("scene", key, buffer, sizeof(SceneJSON) + obstacles_size);
+    free(buffer);
+}
+
+bool config_load_scene(const char* filepath, SceneJSON* out) {
+    uint64_t key = config_cache_key("scene", sizeof(SceneJSON));
+    uint32_t obstacle_size = (uint32_t)sizeof(SceneObstacle);
+    key = config_cache_hash(key, &obstacle_size, sizeof(obstacle_size));
+    bool cacheable = config_cache_enabled() && config_cache_hash_file(&key, filepath);
+    ConfigBlob blob;
+    if (cacheable && config_cache_open("scene", key, &blob)) {
+        bool loaded = scene_from_blob(&blob, out);
+        config_cache_close(&blob);
+        if (loaded) {
+            printf("Loaded scene config: %s (%d vehicles, %d obstacles, baked)\n",
+                   out->name, out->vehicle_count, out->obstacle_count);
+            return true;
+        }
+    }
+
+    if (!load_scene_json(filepath, out)) return false;
+    if (cacheable) bake_scene(key, out);
+    return true;
+}
+
+void config_free_scene(SceneJSON* scene) {
+    free(scene->obstacles);
+    scene->obstacles = NULL;
+    scene->obstacle_count = 0;
+}
+
 // ============================================================================
 // Physics Mode Loading
 // ============================================================================
@@ -1192,7 +1233,7 @@ static PhysicsMode s_active_physics_mode = {
     }
 };
 
-bool config_load_physics_mode(const char* filepath, PhysicsMode* out) {
+static bool load_physics_mode_json(const char* filepath, PhysicsMode* out) {
     // Set defaults (strict mode)
     memset(out, 0, sizeof(*out));
     strcpy(out->name, "Strict tabletop");
@@ -1206,39 +1247,31 @@ bool config_load_physics_mode(const char* filepath, PhysicsMode* out) {
     out->overrides.suspension.travel = 0.15f;
     out->overrides.override_suspension = false;  // Use suspension.json values (hot-reload with R)
 
-    char* json_str = read_file(filepath);
-    if (!json_str) {
-        fprintf(stderr, "Warning: Physics mode config not found: %s (using strict defaults)\n", filepath);
-        s_active_physics_mode = *out;
-        return false;
-    }
-
-    cJSON* root = cJSON_Parse(json_str);
-    free(json_str);
-
-    if (!root) {
-        fprintf(stderr, "JSON parse error in %s\n", filepath);
+    JsonDoc doc;
+    if (!json_doc_open(&doc, filepath)) {
+        fprintf(stderr, "Warning: Physics mode config not loaded: %s (using strict defaults)\n", filepath);
         s_active_physics_mode = *out;
         return false;
     }
+    JsonValue root = doc.root;
 
     // Get active mode name
     char active_mode[64] = "strict_car_wars";
     json_get_string(root, "active_mode", active_mode, 64, "strict_car_wars");
 
     // Parse modes
-    cJSON* modes = cJSON_GetObjectItem(root, "modes");
-    if (!modes) {
-        cJSON_Delete(root);
+    JsonValue modes = json_field(root, "modes");
+    if (!json_is_object(modes)) {
+        json_doc_close(&doc);
         s_active_physics_mode = *out;
         return false;
     }
 
     // Get the active mode config
-    cJSON* mode_config = cJSON_GetObjectItem(modes, active_mode);
-    if (!mode_config) {
+    JsonValue mode_config = json_field(modes, active_mode);
+    if (!json_is_object(mode_config)) {
         fprintf(stderr, "Warning: Physics mode '%s' not found, using strict defaults\n", active_mode);
-        cJSON_Delete(root);
+        json_doc_close(&doc);
         s_active_physics_mode = *out;
         return false;
     }
@@ -1255,11 +1288,11 @@ bool config_load_physics_mode(const char* filepath, PhysicsMode* out) {
     }
 
     // Parse overrides
-    cJSON* overrides = cJSON_GetObjectItem(mode_config, "overrides");
-    if (overrides) {
+    JsonValue overrides = json_field(mode_config, "overrides");
+    if (json_is_object(overrides)) {
         // Tire overrides
-        cJSON* tire = cJSON_GetObjectItem(overrides, "tire");
-        if (tire && cJSON_IsObject(tire)) {
+        JsonValue tire = json_field(overrides, "tire");
+        if (json_is_object(tire)) {
             out->overrides.override_tire = true;
             out->overrides.tire.mu = json_get_float(tire, "mu", 2.0f);
             out->overrides.tire.reference_radius = json_get_float(tire, "reference_radius", 0.35f);
@@ -1267,8 +1300,8 @@ bool config_load_physics_mode(const char* filepath, PhysicsMode* out) {
         }
 
         // Suspension overrides
-        cJSON* susp = cJSON_GetObjectItem(overrides, "suspension");
-        if (susp && cJSON_IsObject(susp)) {
+        JsonValue susp = json_field(overrides, "suspension");
+        if (json_is_object(susp)) {
             out->overrides.override_suspension = true;
             out->overrides.suspension.frequency = json_get_float(susp, "frequency", 3.0f);
             out->overrides.suspension.damping = json_get_float(susp, "damping", 0.8f);
@@ -1277,7 +1310,7 @@ bool config_load_physics_mode(const char* filepath, PhysicsMode* out) {
 
     }
 
-    cJSON_Delete(root);
+    json_doc_close(&doc);
 
     // Store as active mode
     s_active_physics_mode = *out;
@@ -1298,6 +1331,20 @@ bool config_load_physics_mode(const char* filepath, PhysicsMode* out) {
     return true;
 }
 
+bool config_load_physics_mode(const char* filepath, PhysicsMode* out) {
+    uint64_t key = config_cache_key("physics_mode", sizeof(PhysicsMode));
+    bool cacheable = config_cache_enabled() && config_cache_hash_file(&key, filepath);
+    if (cacheable && config_cache_load("physics_mode", key, out, sizeof(*out))) {
+        s_active_physics_mode = *out;
+        printf("Loaded physics mode: %s (baked)\n", out->name);
+        return true;
+    }
+
+    if (!load_physics_mode_json(filepath, out)) return false;
+    if (cacheable) config_cache_store("physics_mode", key, out, sizeof(*out));
+    return true;
+}
+
 const PhysicsMode* config_get_physics_mode(void) {
     return &s_active_physics_mode;
 }
@@ -1369,7 +1416,7 @@ static FrictionCurve s_active_friction_curve = {
     .lateral_rails_multiplier = 3.0f
 };
 
-bool config_load_friction_curve(const char* filepath, FrictionCurve* out) {
+static bool load_friction_curve_json(const char* filepath, FrictionCurve* out) {
     // Set generous defaults
     memset(out, 0, sizeof(*out));
     strcpy(out->name, "Generous (Arcade)");
@@ -1386,39 +1433,31 @@ bool config_load_friction_curve(const char* filepath, FrictionCurve* out) {
     out->lateral_count = 4;
     out->lateral_rails_multiplier = 3.0f;
 
-    char* json_str = read_file(filepath);
-    if (!json_str) {
-        printf("[Physics] Friction curve config not found, using generous defaults\n");
-        s_active_friction_curve = *out;
-        return false;
-    }
-
-    cJSON* root = cJSON_Parse(json_str);
-    free(json_str);
-
-    if (!root) {
-        fprintf(stderr, "JSON parse error in %s\n", filepath);
+    JsonDoc doc;
+    if (!json_doc_open(&doc, filepath)) {
+        printf("[Physics] Friction curve config not loaded, using generous defaults\n");
         s_active_friction_curve = *out;
         return false;
     }
+    JsonValue root = doc.root;
 
     // Get active curve name
     char active_curve[64] = "generous";
     json_get_string(root, "active_curve", active_curve, 64, "generous");
 
     // Parse friction_curves
-    cJSON* curves = cJSON_GetObjectItem(root, "friction_curves");
-    if (!curves) {
-        cJSON_Delete(root);
+    JsonValue curves = json_field(root, "friction_curves");
+    if (!json_is_object(curves)) {
+        json_doc_close(&doc);
         s_active_friction_curve = *out;
         return false;
     }
 
     // Get the active curve config
-    cJSON* curve_config = cJSON_GetObjectItem(curves, active_curve);
-    if (!curve_config) {
+    JsonValue curve_config = json_field(curves, active_curve);
+    if (!json_is_object(curve_config)) {
         fprintf(stderr, "Warning: Friction curve '%s' not found, using generous\n", active_curve);
-        cJSON_Delete(root);
+        json_doc_close(&doc);
         s_active_friction_curve = *out;
         return false;
     }
@@ -1427,45 +1466,45 @@ bool config_load_friction_curve(const char* filepath, FrictionCurve* out) {
     json_get_string(curve_config, "name", out->name, MAX_NAME_LENGTH, "Unknown");
 
     // Parse longitudinal friction points
-    cJSON* longitudinal = cJSON_GetObjectItem(curve_config, "longitudinal");
-    if (longitudinal && cJSON_IsArray(longitudinal)) {
+    JsonValue longitudinal = json_field(curve_config, "longitudinal");
+    if (json_is_array(longitudinal)) {
         out->longitudinal_count = 0;
-        cJSON* point;
-        cJSON_ArrayForEach(point, longitudinal) {
+        JsonValue point;
+        JSON_FOR_EACH(point, longitudinal) {
             if (out->longitudinal_count >= MAX_FRICTION_POINTS) break;
-            if (cJSON_IsArray(point) && cJSON_GetArraySize(point) >= 2) {
+            if (json_is_array(point) && json_count(point) >= 2) {
                 out->longitudinal[out->longitudinal_count].slip =
-                    (float)cJSON_GetArrayItem(point, 0)->valuedouble;
+                    (float)json_number(json_index(point, 0));
                 out->longitudinal[out->longitudinal_count].friction =
-                    (float)cJSON_GetArrayItem(point, 1)->valuedouble;
+                    (float)json_number(json_index(point, 1));
                 out->longitudinal_count++;
             }
         }
     }
 
     // Parse lateral friction
-    cJSON* lateral_config = cJSON_GetObjectItem(root, "lateral_friction");
-    if (lateral_config) {
+    JsonValue lateral_config = json_field(root, "lateral_friction");
+    if (json_is_object(lateral_config)) {
         out->lateral_rails_multiplier = json_get_float(lateral_config, "rails_multiplier", 3.0f);
 
-        cJSON* lateral_points = cJSON_GetObjectItem(lateral_config, "points");
-        if (lateral_points && cJSON_IsArray(lateral_points)) {
+        JsonValue lateral_points = json_field(lateral_config, "points");
+        if (json_is_array(lateral_points)) {
             out->lateral_count = 0;
-            cJSON* point;
-            cJSON_ArrayForEach(point, lateral_points) {
+            JsonValue point;
+            JSON_FOR_EACH(point, lateral_points) {
                 if (out->lateral_count >= MAX_FRICTION_POINTS) break;
-                if (cJSON_IsArray(point) && cJSON_GetArraySize(point) >= 2) {
+                if (json_is_array(point) && json_count(point) >= 2) {
                     out->lateral[out->lateral_count].slip =
-                        (float)cJSON_GetArrayItem(point, 0)->valuedouble;
+                        (float)json_number(json_index(point, 0));
                     out->lateral[out->lateral_count].friction =
-                        (float)cJSON_GetArrayItem(point, 1)->valuedouble;
+                        (float)json_number(json_index(point, 1));
                     out->lateral_count++;
                 }
             }
         }
     }
 
-    cJSON_Delete(root);
+    json_doc_close(&doc);
 
     // Store as active curve
     s_active_friction_curve = *out;
@@ -1481,6 +1520,20 @@ bool config_load_friction_curve(const char* filepath, FrictionCurve* out) {
     return true;
 }
 
+bool config_load_friction_curve(const char* filepath, FrictionCurve* out) {
+    uint64_t key = config_cache_key("friction_curve", sizeof(FrictionCurve));
+    bool cacheable = config_cache_enabled() && config_cache_hash_file(&key, filepath);
+    if (cacheable && config_cache_load("friction_curve", key, out, sizeof(*out))) {
+        s_active_friction_curve = *out;
+        printf("[Physics] Loaded friction curve: %s (baked)\n", out->name);
+        return true;
+    }
+
+    if (!load_friction_curve_json(filepath, out)) return false;
+    if (cacheable) config_cache_store("friction_curve", key, out, sizeof(*out));
+    return true;
+}
+
 const FrictionCurve* config_get_friction_curve(void) {
     return &s_active_friction_curve;
 }
@@ -11,7 +11,6 @@
 #include "../physics/jolt_physics.h"
 
 #define MAX_SCENE_VEHICLES 8
-#define MAX_SCENE_OBSTACLES 32
 #define MAX_NAME_LENGTH 64
 #define MAX_WHEELS 16          // Max wheels per vehicle (supports trucks, etc.)
 #define MAX_AXLES 8            // Max axles per vehicle
@@ -115,6 +114,7 @@ typedef struct {
     char name[MAX_NAME_LENGTH];           // Script identifier (e.g., "freestyle_assist")
     char path[MAX_SCRIPT_PATH];           // Path to Lua script file
     bool enabled;                         // Whether script is active
+    bool native;                          // Prefer the built-in C++ version if one exists
     ScriptOption options[MAX_SCRIPT_OPTIONS];  // Configuration options
     int option_count;
 } VehicleScript;
@@ -201,7 +201,7 @@ typedef struct {
     SceneVehicle vehicles[MAX_SCENE_VEHICLES];
     int vehicle_count;
 
-    SceneObstacle obstacles[MAX_SCENE_OBSTACLES];
+    SceneObstacle* obstacles;    // Heap array, any length (config_free_scene)
     int obstacle_count;
 } SceneJSON;
 
@@ -264,8 +264,12 @@ bool config_load_vehicle(const char* filepath, VehicleJSON* out);
 
 // Load scene configuration from JSON file
 // Returns true on success, false on error
+// Overwrites out: free a previously loaded scene with config_free_scene first
 bool config_load_scene(const char* filepath, SceneJSON* out);
 
+// Release a scene's obstacle array
+void config_free_scene(SceneJSON* scene);
+
 // Convert VehicleJSON to VehicleConfig (for physics system)
 VehicleConfig config_vehicle_to_physics(const VehicleJSON* json);
 
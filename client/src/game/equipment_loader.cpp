@@ -4,7 +4,8 @@
  */
 
 #include "equipment_loader.h"
-#include "../vendor/cJSON.h"
+#include "config_cache.h"
+#include "../util/json_reader.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -12,64 +13,49 @@
 // Global equipment database
 EquipmentDB g_equipment = {0};
 
-// Read file helper
-static char* read_file(const char* filepath) {
-    FILE* f = fopen(filepath, "rb");
-    if (!f) {
-        fprintf(stderr, "Equipment: Failed to open: %s\n", filepath);
-        return NULL;
-    }
-    fseek(f, 0, SEEK_END);
-    long size = ftell(f);
-    fseek(f, 0, SEEK_SET);
-    char* buffer = (char*)malloc(size + 1);
-    if (!buffer) { fclose(f); return NULL; }
-    fread(buffer, 1, size, f);
-    buffer[size] = '\0';
-    fclose(f);
-    return buffer;
-}
-
 // JSON helpers
-static float json_get_float(cJSON* obj, const char* key, float def) {
-    cJSON* item = cJSON_GetObjectItem(obj, key);
-    return (item && cJSON_IsNumber(item)) ? (float)item->valuedouble : def;
+static float json_get_float(JsonValue obj, const char* key, float def) {
+    JsonValue item = json_field(obj, key);
+    return json_is_number(item) ? (float)json_number(item) : def;
 }
 
-static int json_get_int(cJSON* obj, const char* key, int def) {
-    cJSON* item = cJSON_GetObjectItem(obj, key);
-    return (item && cJSON_IsNumber(item)) ? item->valueint : def;
+static int json_get_int(JsonValue obj, const char* key, int def) {
+    JsonValue item = json_field(obj, key);
+    return json_is_number(item) ? (int)json_number(item) : def;
 }
 
-static void json_get_string(cJSON* obj, const char* key, char* out, int maxlen, const char* def) {
-    cJSON* item = cJSON_GetObjectItem(obj, key);
-    if (item && cJSON_IsString(item)) {
-        strncpy(out, item->valuestring, maxlen - 1);
-        out[maxlen - 1] = '\0';
+static void json_get_string(JsonValue obj, const char* key, char* out, int maxlen, const char* def) {
+    JsonValue item = json_field(obj, key);
+    if (json_is_string(item)) {
+        json_string(item, out, (size_t)maxlen);
     } else {
         strncpy(out, def, maxlen - 1);
         out[maxlen - 1] = '\0';
     }
 }
 
+// Sections are objects keyed by id; the key is the id unless "id" overrides it
+static void json_get_id(const JsonIter* it, JsonValue item, char* out, int maxlen) {
+    char key[MAX_EQUIPMENT_ID];
+    json_string(it->key, key, sizeof(key));
+    json_get_string(item, "id", out, maxlen, key);
+}
+
 // Load chassis.json
 static bool load_chassis(const char* filepath) {
-    char* json_str = read_file(filepath);
-    if (!json_str) return false;
-
-    cJSON* root = cJSON_Parse(json_str);
-    free(json_str);
-    if (!root) { fprintf(stderr, "Equipment: JSON parse error in chassis.json\n"); return false; }
+    JsonDoc doc;
+    if (!json_doc_open(&doc, filepath)) return false;
+    JsonValue root = doc.root;
 
     // Parse cars section
-    cJSON* cars = cJSON_GetObjectItem(root, "cars");
-    if (cars) {
-        cJSON* item;
-        cJSON_ArrayForEach(item, cars) {
+    JsonValue cars = json_field(root, "cars");
+    if (json_is_object(cars)) {
+        JsonValue item;
+        JSON_FOR_EACH(item, cars) {
             if (g_equipment.chassis_count >= MAX_EQUIPMENT_ITEMS) break;
             ChassisEquipment* c = &g_equipment.chassis[g_equipment.chassis_count];
 
-            json_get_string(item, "id", c->id, MAX_EQUIPMENT_ID, item->string);
+            json_get_id(&item_iter, item, c->id, MAX_EQUIPMENT_ID);
             json_get_string(item, "name", c->name, MAX_EQUIPMENT_NAME, "Unknown");
             c->cost = json_get_int(item, "cost", 0);
             c->weight_lbs = json_get_int(item, "weight", 0);
@@ -78,34 +64,34 @@ static bool load_chassis(const char* filepath) {
             c->base_hc_modifier = json_get_int(item, "base_hc_modifier", 0);
 
             // Physics dimensions
-            cJSON* physics = cJSON_GetObjectItem(item, "physics");
-            if (physics) {
-                cJSON* length = cJSON_GetObjectItem(physics, "length");
-                cJSON* width = cJSON_GetObjectItem(physics, "width");
-                cJSON* height = cJSON_GetObjectItem(physics, "height");
+            JsonValue physics = json_field(item, "physics");
+            if (json_is_object(physics)) {
+                JsonValue length = json_field(physics, "length");
+                JsonValue width = json_field(physics, "width");
+                JsonValue height = json_field(physics, "height");
 
-                if (length) {
+                if (json_is_object(length)) {
                     c->length_default = json_get_float(length, "default", 4.0f);
                     c->length_min = json_get_float(length, "min", 3.5f);
                     c->length_max = json_get_float(length, "max", 5.0f);
                 }
-                if (width) {
+                if (json_is_object(width)) {
                     c->width_default = json_get_float(width, "default", 1.8f);
                     c->width_min = json_get_float(width, "min", 1.5f);
                     c->width_max = json_get_float(width, "max", 2.2f);
                 }
-                if (height) {
+                if (json_is_object(height)) {
                     c->height_default = json_get_float(height, "default", 1.4f);
                     c->height_min = json_get_float(height, "min", 1.2f);
                     c->height_max = json_get_float(height, "max", 1.8f);
                 }
 
                 // Center of mass offset [x, y, z]
-                cJSON* com = cJSON_GetObjectItem(physics, "center_of_mass");
-                if (com && cJSON_IsArray(com) && cJSON_GetArraySize(com) >= 3) {
-                    c->center_of_mass[0] = (float)cJSON_GetArrayItem(com, 0)->valuedouble;
-                    c->center_of_mass[1] = (float)cJSON_GetArrayItem(com, 1)->valuedouble;
-                    c->center_of_mass[2] = (float)cJSON_GetArrayItem(com, 2)->valuedouble;
+                JsonValue com = json_field(physics, "center_of_mass");
+                if (json_is_array(com) && json_count(com) >= 3) {
+                    c->center_of_mass[0] = (float)json_number(json_index(com, 0));
+                    c->center_of_mass[1] = (float)json_number(json_index(com, 1));
+                    c->center_of_mass[2] = (float)json_number(json_index(com, 2));
                 } else {
                     // Default: centered, halfway down
                     c->center_of_mass[0] = 0.0f;
@@ -122,20 +108,20 @@ static bool load_chassis(const char* filepath) {
 
             // Wheel mount positions
             c->wheel_mount_count = 0;
-            cJSON* mounts = cJSON_GetObjectItem(item, "wheel_mounts");
-            if (mounts && cJSON_IsArray(mounts)) {
-                cJSON* mount;
-                cJSON_ArrayForEach(mount, mounts) {
+            JsonValue mounts = json_field(item, "wheel_mounts");
+            if (json_is_array(mounts)) {
+                JsonValue mount;
+                JSON_FOR_EACH(mount, mounts) {
                     if (c->wheel_mount_count >= MAX_WHEEL_MOUNTS) break;
                     WheelMount* wm = &c->wheel_mounts[c->wheel_mount_count];
 
                     json_get_string(mount, "id", wm->id, 16, "W");
 
-                    cJSON* pos = cJSON_GetObjectItem(mount, "position");
-                    if (pos && cJSON_IsArray(pos) && cJSON_GetArraySize(pos) >= 3) {
-                        wm->position[0] = (float)cJSON_GetArrayItem(pos, 0)->valuedouble;
-                        wm->position[1] = (float)cJSON_GetArrayItem(pos, 1)->valuedouble;
-                        wm->position[2] = (float)cJSON_GetArrayItem(pos, 2)->valuedouble;
+                    JsonValue pos = json_field(mount, "position");
+                    if (json_is_array(pos) && json_count(pos) >= 3) {
+                        wm->position[0] = (float)json_number(json_index(pos, 0));
+                        wm->position[1] = (float)json_number(json_index(pos, 1));
+                        wm->position[2] = (float)json_number(json_index(pos, 2));
                     }
                     c->wheel_mount_count++;
                 }
@@ -145,29 +131,26 @@ static bool load_chassis(const char* filepath) {
         }
     }
 
-    cJSON_Delete(root);
+    json_doc_close(&doc);
     printf("Equipment: Loaded %d chassis types\n", g_equipment.chassis_count);
     return true;
 }
 
 // Load power_plants.json
 static bool load_power_plants(const char* filepath) {
-    char* json_str = read_file(filepath);
-    if (!json_str) return false;
-
-    cJSON* root = cJSON_Parse(json_str);
-    free(json_str);
-    if (!root) { fprintf(stderr, "Equipment: JSON parse error in power_plants.json\n"); return false; }
+    JsonDoc doc;
+    if (!json_doc_open(&doc, filepath)) return false;
+    JsonValue root = doc.root;
 
     // Helper to parse power plant section
     #define PARSE_POWER_PLANTS(section_name) \
-        cJSON* section_name##_section = cJSON_GetObjectItem(root, #section_name); \
-        if (section_name##_section) { \
-            cJSON* item; \
-            cJSON_ArrayForEach(item, section_name##_section) { \
+        JsonValue section_name##_section = json_field(root, #section_name); \
+        if (json_is_object(section_name##_section)) { \
+            JsonValue item; \
+            JSON_FOR_EACH(item, section_name##_section) { \
                 if (g_equipment.power_plant_count >= MAX_EQUIPMENT_ITEMS) break; \
                 PowerPlantEquipment* p = &g_equipment.power_plants[g_equipment.power_plant_count]; \
-                json_get_string(item, "id", p->id, MAX_EQUIPMENT_ID, item->string); \
+                json_get_id(&item_iter, item, p->id, MAX_EQUIPMENT_ID); \
                 json_get_string(item, "name", p->name, MAX_EQUIPMENT_NAME, "Unknown"); \
                 json_get_string(item, "type", p->type, 32, "electric"); \
                 p->cost = json_get_int(item, "cost", 0); \
@@ -197,36 +180,33 @@ static bool load_power_plants(const char* filepath) {
 
     #undef PARSE_POWER_PLANTS
 
-    cJSON_Delete(root);
+    json_doc_close(&doc);
     printf("Equipment: Loaded %d power plants\n", g_equipment.power_plant_count);
     return true;
 }
 
 // Load tires.json
 static bool load_tires(const char* filepath) {
-    char* json_str = read_file(filepath);
-    if (!json_str) return false;
-
-    cJSON* root = cJSON_Parse(json_str);
-    free(json_str);
-    if (!root) { fprintf(stderr, "Equipment: JSON parse error in tires.json\n"); return false; }
+    JsonDoc doc;
+    if (!json_doc_open(&doc, filepath)) return false;
+    JsonValue root = doc.root;
 
     // Base types
-    cJSON* base_types = cJSON_GetObjectItem(root, "base_types");
-    if (base_types) {
-        cJSON* item;
-        cJSON_ArrayForEach(item, base_types) {
+    JsonValue base_types = json_field(root, "base_types");
+    if (json_is_object(base_types)) {
+        JsonValue item;
+        JSON_FOR_EACH(item, base_types) {
             if (g_equipment.tire_count >= MAX_EQUIPMENT_ITEMS) break;
             TireEquipment* t = &g_equipment.tires[g_equipment.tire_count];
 
-            json_get_string(item, "id", t->id, MAX_EQUIPMENT_ID, item->string);
+            json_get_id(&item_iter, item, t->id, MAX_EQUIPMENT_ID);
             json_get_string(item, "name", t->name, MAX_EQUIPMENT_NAME, "Unknown");
             t->cost = json_get_int(item, "cost", 50);
             t->weight_lbs = json_get_int(item, "weight", 30);
             t->dp = json_get_int(item, "dp", 4);
 
-            cJSON* physics = cJSON_GetObjectItem(item, "physics");
-            if (physics) {
+            JsonValue physics = json_field(item, "physics");
+            if (json_is_object(physics)) {
                 t->mu = json_get_float(physics, "mu", 1.5f);
             } else {
                 t->mu = 1.5f;
@@ -236,21 +216,21 @@ static bool load_tires(const char* filepath) {
     }
 
     // Modifiers
-    cJSON* modifiers = cJSON_GetObjectItem(root, "modifiers");
-    if (modifiers) {
-        cJSON* item;
-        cJSON_ArrayForEach(item, modifiers) {
+    JsonValue modifiers = json_field(root, "modifiers");
+    if (json_is_object(modifiers)) {
+        JsonValue item;
+        JSON_FOR_EACH(item, modifiers) {
             if (g_equipment.tire_modifier_count >= MAX_EQUIPMENT_ITEMS) break;
             TireModifier* m = &g_equipment.tire_modifiers[g_equipment.tire_modifier_count];
 
-            json_get_string(item, "id", m->id, MAX_EQUIPMENT_ID, item->string);
+            json_get_id(&item_iter, item, m->id, MAX_EQUIPMENT_ID);
             json_get_string(item, "name", m->name, MAX_EQUIPMENT_NAME, "Unknown");
             m->cost_modifier = json_get_float(item, "cost_modifier", 0.0f);
             m->weight_modifier = json_get_float(item, "weight_modifier", 0.0f);
             m->hc_bonus = json_get_int(item, "hc_bonus", 0);
 
-            cJSON* physics_mod = cJSON_GetObjectItem(item, "physics_modifier");
-            if (physics_mod) {
+            JsonValue physics_mod = json_field(item, "physics_modifier");
+            if (json_is_object(physics_mod)) {
                 m->mu_bonus = json_get_float(physics_mod, "mu_bonus", 0.0f);
             } else {
                 m->mu_bonus = 0.0f;
@@ -259,7 +239,7 @@ static bool load_tires(const char* filepath) {
         }
     }
 
-    cJSON_Delete(root);
+    json_doc_close(&doc);
     printf("Equipment: Loaded %d tire types, %d modifiers\n",
            g_equipment.tire_count, g_equipment.tire_modifier_count);
     return true;
@@ -267,28 +247,25 @@ static bool load_tires(const char* filepath) {
 
 // Load suspension.json
 static bool load_suspension(const char* filepath) {
-    char* json_str = read_file(filepath);
-    if (!json_str) return false;
-
-    cJSON* root = cJSON_Parse(json_str);
-    free(json_str);
-    if (!root) { fprintf(stderr, "Equipment: JSON parse error in suspension.json\n"); return false; }
-
-    cJSON* types = cJSON_GetObjectItem(root, "types");
-    if (types) {
-        cJSON* item;
-        cJSON_ArrayForEach(item, types) {
+    JsonDoc doc;
+    if (!json_doc_open(&doc, filepath)) return false;
+    JsonValue root = doc.root;
+
+    JsonValue types = json_field(root, "types");
+    if (json_is_object(types)) {
+        JsonValue item;
+        JSON_FOR_EACH(item, types) {
             if (g_equipment.suspension_count >= MAX_EQUIPMENT_ITEMS) break;
             SuspensionEquipment* s = &g_equipment.suspensions[g_equipment.suspension_count];
 
-            json_get_string(item, "id", s->id, MAX_EQUIPMENT_ID, item->string);
+            json_get_id(&item_iter, item, s->id, MAX_EQUIPMENT_ID);
             json_get_string(item, "name", s->name, MAX_EQUIPMENT_NAME, "Unknown");
             s->cost_modifier = json_get_float(item, "cost_modifier", 0.0f);
             s->hc_car = json_get_int(item, "hc_car", 1);
             s->hc_van = json_get_int(item, "hc_van", 0);
 
-            cJSON* physics = cJSON_GetObjectItem(item, "physics");
-            if (physics) {
+            JsonValue physics = json_field(item, "physics");
+            if (json_is_object(physics)) {
                 s->frequency = json_get_float(physics, "frequency", 1.5f);
                 s->damping = json_get_float(physics, "damping", 0.5f);
                 s->travel = json_get_float(physics, "travel", 0.12f);
@@ -301,34 +278,31 @@ static bool load_suspension(const char* filepath) {
         }
     }
 
-    cJSON_Delete(root);
+    json_doc_close(&doc);
     printf("Equipment: Loaded %d suspension types\n", g_equipment.suspension_count);
     return true;
 }
 
 // Load brakes.json
 static bool load_brakes(const char* filepath) {
-    char* json_str = read_file(filepath);
-    if (!json_str) return false;
-
-    cJSON* root = cJSON_Parse(json_str);
-    free(json_str);
-    if (!root) { fprintf(stderr, "Equipment: JSON parse error in brakes.json\n"); return false; }
-
-    cJSON* types = cJSON_GetObjectItem(root, "types");
-    if (types) {
-        cJSON* item;
-        cJSON_ArrayForEach(item, types) {
+    JsonDoc doc;
+    if (!json_doc_open(&doc, filepath)) return false;
+    JsonValue root = doc.root;
+
+    JsonValue types = json_field(root, "types");
+    if (json_is_object(types)) {
+        JsonValue item;
+        JSON_FOR_EACH(item, types) {
             if (g_equipment.brake_count >= MAX_EQUIPMENT_ITEMS) break;
             BrakeEquipment* b = &g_equipment.brakes[g_equipment.brake_count];
 
-            json_get_string(item, "id", b->id, MAX_EQUIPMENT_ID, item->string);
+            json_get_id(&item_iter, item, b->id, MAX_EQUIPMENT_ID);
             json_get_string(item, "name", b->name, MAX_EQUIPMENT_NAME, "Unknown");
             b->cost = json_get_int(item, "cost", 0);
             b->weight_lbs = json_get_int(item, "weight", 0);
 
-            cJSON* physics = cJSON_GetObjectItem(item, "physics");
-            if (physics) {
+            JsonValue physics = json_field(item, "physics");
+            if (json_is_object(physics)) {
                 b->brake_force_multiplier = json_get_float(physics, "brake_force_multiplier", 8.0f);
             } else {
                 b->brake_force_multiplier = 8.0f;
@@ -337,54 +311,51 @@ static bool load_brakes(const char* filepath) {
         }
     }
 
-    cJSON_Delete(root);
+    json_doc_close(&doc);
     printf("Equipment: Loaded %d brake types\n", g_equipment.brake_count);
     return true;
 }
 
 // Load gearboxes.json
 static bool load_gearboxes(const char* filepath) {
-    char* json_str = read_file(filepath);
-    if (!json_str) return false;
-
-    cJSON* root = cJSON_Parse(json_str);
-    free(json_str);
-    if (!root) { fprintf(stderr, "Equipment: JSON parse error in gearboxes.json\n"); return false; }
-
-    cJSON* types = cJSON_GetObjectItem(root, "types");
-    if (types) {
-        cJSON* item;
-        cJSON_ArrayForEach(item, types) {
+    JsonDoc doc;
+    if (!json_doc_open(&doc, filepath)) return false;
+    JsonValue root = doc.root;
+
+    JsonValue types = json_field(root, "types");
+    if (json_is_object(types)) {
+        JsonValue item;
+        JSON_FOR_EACH(item, types) {
             if (g_equipment.gearbox_count >= MAX_EQUIPMENT_ITEMS) break;
             GearboxEquipment* g = &g_equipment.gearboxes[g_equipment.gearbox_count];
 
-            json_get_string(item, "id", g->id, MAX_EQUIPMENT_ID, item->string);
+            json_get_id(&item_iter, item, g->id, MAX_EQUIPMENT_ID);
             json_get_string(item, "name", g->name, MAX_EQUIPMENT_NAME, "Unknown");
             g->cost = json_get_int(item, "cost", 0);
             g->weight_lbs = json_get_int(item, "weight_lbs", 0);
 
             // Physics values
-            cJSON* physics = cJSON_GetObjectItem(item, "physics");
-            if (physics) {
+            JsonValue physics = json_field(item, "physics");
+            if (json_is_object(physics)) {
                 // Gear ratios
-                cJSON* gear_ratios = cJSON_GetObjectItem(physics, "gear_ratios");
-                if (gear_ratios && cJSON_IsArray(gear_ratios)) {
+                JsonValue gear_ratios = json_field(physics, "gear_ratios");
+                if (json_is_array(gear_ratios)) {
                     g->gear_count = 0;
-                    cJSON* ratio;
-                    cJSON_ArrayForEach(ratio, gear_ratios) {
+                    JsonValue ratio;
+                    JSON_FOR_EACH(ratio, gear_ratios) {
                         if (g->gear_count >= MAX_GEARS) break;
-                        g->gear_ratios[g->gear_count++] = (float)ratio->valuedouble;
+                        g->gear_ratios[g->gear_count++] = (float)json_number(ratio);
                     }
                 }
 
                 // Reverse gear ratios
-                cJSON* reverse_ratios = cJSON_GetObjectItem(physics, "reverse_ratios");
-                if (reverse_ratios && cJSON_IsArray(reverse_ratios)) {
+                JsonValue reverse_ratios = json_field(physics, "reverse_ratios");
+                if (json_is_array(reverse_ratios)) {
                     g->reverse_count = 0;
-                    cJSON* ratio;
-                    cJSON_ArrayForEach(ratio, reverse_ratios) {
+                    JsonValue ratio;
+                    JSON_FOR_EACH(ratio, reverse_ratios) {
                         if (g->reverse_count >= MAX_GEARS) break;
-                        g->reverse_ratios[g->reverse_count++] = (float)ratio->valuedouble;
+                        g->reverse_ratios[g->reverse_count++] = (float)json_number(ratio);
                     }
                 }
 
@@ -399,110 +370,203 @@ static bool load_gearboxes(const char* filepath) {
         }
     }
 
-    cJSON_Delete(root);
+    json_doc_close(&doc);
     printf("Equipment: Loaded %d gearbox types\n", g_equipment.gearbox_count);
     return true;
 }
 
+// Equipment files in load order
+static const struct {
+    const char* file;
+    bool (*load)(const char* filepath);
+} EQUIPMENT_FILES[] = {
+    { "chassis.json",      load_chassis },
+    { "power_plants.json", load_power_plants },
+    { "gearboxes.json",    load_gearboxes },
+    { "tires.json",        load_tires },
+    { "suspension.json",   load_suspension },
+    { "brakes.json",       load_brakes },
+};
+#define EQUIPMENT_FILE_COUNT (int)(sizeof(EQUIPMENT_FILES) / sizeof(EQUIPMENT_FILES[0]))
+
 // Load all equipment (can be called multiple times for reload)
+static void build_indexes(void);
+
 bool equipment_load_all(const char* base_path) {
+    char path[512];
+
+    // Unchanged files load from the baked tables (config_cache.h)
+    uint64_t key = config_cache_key("equipment", sizeof(EquipmentDB));
+    bool cacheable = config_cache_enabled();
+    for (int i = 0; i < EQUIPMENT_FILE_COUNT && cacheable; i++) {
+        snprintf(path, sizeof(path), "%s/%s", base_path, EQUIPMENT_FILES[i].file);
+        cacheable = config_cache_hash_file(&key, path);
+    }
+    if (cacheable && config_cache_load("equipment", key, &g_equipment, sizeof(g_equipment))) {
+        printf("Equipment: Loaded %d chassis, %d power plants, %d gearboxes, %d tires, "
+               "%d suspensions, %d brakes (baked)\n",
+               g_equipment.chassis_count, g_equipment.power_plant_count, g_equipment.gearbox_count,
+               g_equipment.tire_count, g_equipment.suspension_count, g_equipment.brake_count);
+        return true;
+    }
+
     // Reset and reload
     memset(&g_equipment, 0, sizeof(g_equipment));
 
-    char path[512];
     bool success = true;
+    for (int i = 0; i < EQUIPMENT_FILE_COUNT; i++) {
+        snprintf(path, sizeof(path), "%s/%s", base_path, EQUIPMENT_FILES[i].file);
+        if (!EQUIPMENT_FILES[i].load(path)) success = false;
+    }
 
-    snprintf(path, sizeof(path), "%s/chassis.json", base_path);
-    if (!load_chassis(path)) success = false;
+    build_indexes();  // Baked with the tables, so cache hits skip this
 
-    snprintf(path, sizeof(path), "%s/power_plants.json", base_path);
-    if (!load_power_plants(path)) success = false;
+    g_equipment.loaded = success;
+    if (success && cacheable) {
+        g_equipment.source_hash = key;
+        config_cache_store("equipment", key, &g_equipment, sizeof(g_equipment));
+    }
+    return success;
+}
 
-    snprintf(path, sizeof(path), "%s/gearboxes.json", base_path);
-    if (!load_gearboxes(path)) success = false;
+// ============================================================================
+// ID index
+// ============================================================================
+
+// Number of entries and ID of entry i in a category
+static int category_count(EquipmentCategory category) {
+    switch (category) {
+        case EQUIPMENT_CHASSIS:       return g_equipment.chassis_count;
+        case EQUIPMENT_POWER_PLANT:   return g_equipment.power_plant_count;
+        case EQUIPMENT_GEARBOX:       return g_equipment.gearbox_count;
+        case EQUIPMENT_TIRE:          return g_equipment.tire_count;
+        case EQUIPMENT_TIRE_MODIFIER: return g_equipment.tire_modifier_count;
+        case EQUIPMENT_SUSPENSION:    return g_equipment.suspension_count;
+        case EQUIPMENT_BRAKE:         return g_equipment.brake_count;
+        default:                      return 0;
+    }
+}
 
-    snprintf(path, sizeof(path), "%s/tires.json", base_path);
-    if (!load_tires(path)) success = false;
+static const char* category_id(EquipmentCategory category, int i) {
+    switch (category) {
+        case EQUIPMENT_CHASSIS:       return g_equipment.chassis[i].id;
+        case EQUIPMENT_POWER_PLANT:   return g_equipment.power_plants[i].id;
+        case EQUIPMENT_GEARBOX:       return g_equipment.gearboxes[i].id;
+        case EQUIPMENT_TIRE:          return g_equipment.tires[i].id;
+        case EQUIPMENT_TIRE_MODIFIER: return g_equipment.tire_modifiers[i].id;
+        case EQUIPMENT_SUSPENSION:    return g_equipment.suspensions[i].id;
+        case EQUIPMENT_BRAKE:         return g_equipment.brakes[i].id;
+        default:                      return "";
+    }
+}
 
-    snprintf(path, sizeof(path), "%s/suspension.json", base_path);
-    if (!load_suspension(path)) success = false;
+// Rebuild every category index from the loaded tables
+static void build_indexes(void) {
+    for (int c = 0; c < EQUIPMENT_CATEGORY_COUNT; c++) {
+        EquipmentCategory category = (EquipmentCategory)c;
+        EquipmentIndex* index = &g_equipment.index[c];
+        memset(index, 0, sizeof(*index));
+
+        for (int i = 0; i < category_count(category); i++) {
+            const char* id = category_id(category, i);
+            if (equipment_handle(category, id) != EQUIPMENT_HANDLE_NONE) continue;  // Keep first
+
+            uint32_t hash = equipment_id_hash(id);
+            uint32_t slot = hash & (EQUIPMENT_INDEX_SLOTS - 1);
+            while (index->item[slot]) slot = (slot + 1) & (EQUIPMENT_INDEX_SLOTS - 1);
+            index->hash[slot] = hash;
+            index->item[slot] = (uint8_t)(i + 1);
+        }
+    }
+}
 
-    snprintf(path, sizeof(path), "%s/brakes.json", base_path);
-    if (!load_brakes(path)) success = false;
+// FNV-1a 32
+uint32_t equipment_id_hash(const char* id) {
+    uint32_t hash = 2166136261u;
+    for (const unsigned char* p = (const unsigned char*)id; *p; p++) {
+        hash ^= *p;
+        hash *= 16777619u;
+    }
+    return hash ? hash : 1;
+}
 
-    g_equipment.loaded = success;
-    return success;
+EquipmentHandle equipment_handle(EquipmentCategory category, const char* id) {
+    if (!id || category < 0 || category >= EQUIPMENT_CATEGORY_COUNT) return EQUIPMENT_HANDLE_NONE;
+
+    // Never more than half full, so the probe always reaches an empty slot
+    const EquipmentIndex* index = &g_equipment.index[category];
+    uint32_t hash = equipment_id_hash(id);
+    for (uint32_t slot = hash & (EQUIPMENT_INDEX_SLOTS - 1); index->item[slot];
+         slot = (slot + 1) & (EQUIPMENT_INDEX_SLOTS - 1)) {
+        int i = index->item[slot] - 1;
+        if (index->hash[slot] == hash && strcmp(category_id(category, i), id) == 0) {
+            return i;
+        }
+    }
+    return EQUIPMENT_HANDLE_NONE;
+}
+
+// Handle lookups
+#define EQUIPMENT_GET(array, count) \
+    return (h >= 0 && h < g_equipment.count) ? &g_equipment.array[h] : NULL
+
+const ChassisEquipment* equipment_get_chassis(EquipmentHandle h) {
+    EQUIPMENT_GET(chassis, chassis_count);
+}
+
+const PowerPlantEquipment* equipment_get_power_plant(EquipmentHandle h) {
+    EQUIPMENT_GET(power_plants, power_plant_count);
+}
+
+const GearboxEquipment* equipment_get_gearbox(EquipmentHandle h) {
+    EQUIPMENT_GET(gearboxes, gearbox_count);
+}
+
+const TireEquipment* equipment_get_tire(EquipmentHandle h) {
+    EQUIPMENT_GET(tires, tire_count);
+}
+
+const TireModifier* equipment_get_tire_modifier(EquipmentHandle h) {
+    EQUIPMENT_GET(tire_modifiers, tire_modifier_count);
+}
+
+const SuspensionEquipment* equipment_get_suspension(EquipmentHandle h) {
+    EQUIPMENT_GET(suspensions, suspension_count);
 }
 
+const BrakeEquipment* equipment_get_brake(EquipmentHandle h) {
+    EQUIPMENT_GET(brakes, brake_count);
+}
+
+#undef EQUIPMENT_GET
+
 // Lookup functions
 const ChassisEquipment* equipment_find_chassis(const char* id) {
-    if (!id) return NULL;
-    for (int i = 0; i < g_equipment.chassis_count; i++) {
-        if (strcmp(g_equipment.chassis[i].id, id) == 0) {
-            return &g_equipment.chassis[i];
-        }
-    }
-    return NULL;
+    return equipment_get_chassis(equipment_handle(EQUIPMENT_CHASSIS, id));
 }
 
 const PowerPlantEquipment* equipment_find_power_plant(const char* id) {
-    if (!id) return NULL;
-    for (int i = 0; i < g_equipment.power_plant_count; i++) {
-        if (strcmp(g_equipment.power_plants[i].id, id) == 0) {
-            return &g_equipment.power_plants[i];
-        }
-    }
-    return NULL;
+    return equipment_get_power_plant(equipment_handle(EQUIPMENT_POWER_PLANT, id));
 }
 
 const GearboxEquipment* equipment_find_gearbox(const char* id) {
-    if (!id) return NULL;
-    for (int i = 0; i < g_equipment.gearbox_count; i++) {
-        if (strcmp(g_equipment.gearboxes[i].id, id) == 0) {
-            return &g_equipment.gearboxes[i];
-        }
-    }
-    return NULL;
+    return equipment_get_gearbox(equipment_handle(EQUIPMENT_GEARBOX, id));
 }
 
 const TireEquipment* equipment_find_tire(const char* id) {
-    if (!id) return NULL;
-    for (int i = 0; i < g_equipment.tire_count; i++) {
-        if (strcmp(g_equipment.tires[i].id, id) == 0) {
-            return &g_equipment.tires[i];
-        }
-    }
-    return NULL;
+    return equipment_get_tire(equipment_handle(EQUIPMENT_TIRE, id));
 }
 
 const TireModifier* equipment_find_tire_modifier(const char* id) {
-    if (!id) return NULL;
-    for (int i = 0; i < g_equipment.tire_modifier_count; i++) {
-        if (strcmp(g_equipment.tire_modifiers[i].id, id) == 0) {
-            return &g_equipment.tire_modifiers[i];
-        }
-    }
-    return NULL;
+    return equipment_get_tire_modifier(equipment_handle(EQUIPMENT_TIRE_MODIFIER, id));
 }
 
 const SuspensionEquipment* equipment_find_suspension(const char* id) {
-    if (!id) return NULL;
-    for (int i = 0; i < g_equipment.suspension_count; i++) {
-        if (strcmp(g_equipment.suspensions[i].id, id) == 0) {
-            return &g_equipment.suspensions[i];
-        }
-    }
-    return NULL;
+    return equipment_get_suspension(equipment_handle(EQUIPMENT_SUSPENSION, id));
 }
 
 const BrakeEquipment* equipment_find_brake(const char* id) {
-    if (!id) return NULL;
-    for (int i = 0; i < g_equipment.brake_count; i++) {
-        if (strcmp(g_equipment.brakes[i].id, id) == 0) {
-            return &g_equipment.brakes[i];
-        }
-    }
-    return NULL;
+    return equipment_get_brake(equipment_handle(EQUIPMENT_BRAKE, id));
 }
 
 // Calculate combined tire physics
@@ -7,6 +7,7 @@
 #define EQUIPMENT_LOADER_H
 
 #include <stdbool.h>
+#include <stdint.h>
 
 #define MAX_EQUIPMENT_ID 64
 #define MAX_EQUIPMENT_NAME 64
@@ -138,6 +139,31 @@ typedef struct {
     float brake_force_multiplier;  // Multiplied by mass for actual force
 } BrakeEquipment;
 
+// Equipment categories, one ID namespace each
+typedef enum {
+    EQUIPMENT_CHASSIS,
+    EQUIPMENT_POWER_PLANT,
+    EQUIPMENT_GEARBOX,
+    EQUIPMENT_TIRE,
+    EQUIPMENT_TIRE_MODIFIER,
+    EQUIPMENT_SUSPENSION,
+    EQUIPMENT_BRAKE,
+    EQUIPMENT_CATEGORY_COUNT
+} EquipmentCategory;
+
+// Stable handle to a catalog entry: its index in the category array.
+// Valid until the next equipment_load_all; EQUIPMENT_HANDLE_NONE if not found.
+typedef int EquipmentHandle;
+#define EQUIPMENT_HANDLE_NONE (-1)
+
+// Open-addressed ID index for one category. Pointer-free so it is baked
+// along with the tables; an all-zero index is empty.
+#define EQUIPMENT_INDEX_SLOTS 128  // Power of two, 2x MAX_EQUIPMENT_ITEMS
+typedef struct {
+    uint32_t hash[EQUIPMENT_INDEX_SLOTS];   // equipment_id_hash of the ID
+    uint8_t item[EQUIPMENT_INDEX_SLOTS];    // Item index + 1 (0 = empty slot)
+} EquipmentIndex;
+
 // Equipment database (singleton-ish, loaded once)
 typedef struct {
     ChassisEquipment chassis[MAX_EQUIPMENT_ITEMS];
@@ -161,7 +187,10 @@ typedef struct {
     BrakeEquipment brakes[MAX_EQUIPMENT_ITEMS];
     int brake_count;
 
+    EquipmentIndex index[EQUIPMENT_CATEGORY_COUNT];
+
     bool loaded;
+    uint64_t source_hash;  // Config cache key of the JSON it came from (0 = not cached)
 } EquipmentDB;
 
 // Global equipment database
@@ -171,7 +200,23 @@ extern EquipmentDB g_equipment;
 // base_path should be path to assets/data/equipment/
 bool equipment_load_all(const char* base_path);
 
-// Lookup functions - return NULL if not found
+// ID hash used by the catalog index (FNV-1a 32, never 0)
+uint32_t equipment_id_hash(const char* id);
+
+// Resolve an ID once and keep the handle for repeated lookups.
+// Duplicate IDs resolve to the first entry, as the old linear scans did.
+EquipmentHandle equipment_handle(EquipmentCategory category, const char* id);
+
+// Handle lookups - return NULL for EQUIPMENT_HANDLE_NONE or out of range
+const ChassisEquipment* equipment_get_chassis(EquipmentHandle h);
+const PowerPlantEquipment* equipment_get_power_plant(EquipmentHandle h);
+const GearboxEquipment* equipment_get_gearbox(EquipmentHandle h);
+const TireEquipment* equipment_get_tire(EquipmentHandle h);
+const TireModifier* equipment_get_tire_modifier(EquipmentHandle h);
+const SuspensionEquipment* equipment_get_suspension(EquipmentHandle h);
+const BrakeEquipment* equipment_get_brake(EquipmentHandle h);
+
+// Lookup functions (hashed) - return NULL if not found
 const ChassisEquipment* equipment_find_chassis(const char* id);
 const PowerPlantEquipment* equipment_find_power_plant(const char* id);
 const GearboxEquipment* equipment_find_gearbox(const char* id);
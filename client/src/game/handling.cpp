@@ -7,20 +7,31 @@
 #include <stdio.h>
 #include <time.h>
 
-// Track if RNG has been seeded
-static bool rng_seeded = false;
+// splitmix64 step - plain integer math, identical on every platform
+static uint64_t rng_next(HandlingRng* rng) {
+    uint64_t z = (rng->state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+// Seed a dice RNG
+void handling_rng_seed(HandlingRng* rng, uint64_t seed) {
+    rng->state = seed;
+}
 
 // Roll 2d6
-int handling_roll_2d6(void) {
-    if (!rng_seeded) {
-        srand((unsigned int)time(NULL));
-        rng_seeded = true;
-    }
-    int d1 = (rand() % 6) + 1;
-    int d2 = (rand() % 6) + 1;
+int handling_roll_2d6(HandlingRng* rng) {
+    int d1 = (int)(rng_next(rng) % 6) + 1;
+    int d2 = (int)(rng_next(rng) % 6) + 1;
     return d1 + d2;
 }
 
+// Seed this vehicle's dice
+void handling_seed_rng(VehicleHandling* h, uint64_t seed) {
+    handling_rng_seed(&h->rng, seed);
+}
+
 // Initialize handling state
 void handling_init(VehicleHandling* h, int handling_class) {
     h->handling_class = handling_class;
@@ -29,6 +40,11 @@ void handling_init(VehicleHandling* h, int handling_class) {
     h->last_roll = 0;
     h->last_roll_target = 7;
     h->last_result = CONTROL_SUCCESS;
+    h->quiet = false;
+
+    // Non-reproducible by default (matches the old srand(time) behaviour);
+    // lockstep matches reseed via handling_seed_rng
+    handling_rng_seed(&h->rng, (uint64_t)time(NULL) ^ (uint64_t)(uintptr_t)h);
 }
 
 // Reset HS to HC at start of turn
@@ -40,20 +56,22 @@ void handling_reset_turn(VehicleHandling* h) {
 // Internal: perform control roll and return result
 static ControlResult do_control_roll(VehicleHandling* h, int target) {
     h->last_roll_target = target;
-    h->last_roll = handling_roll_2d6();
+    h->last_roll = handling_roll_2d6(&h->rng);
 
     int total = h->last_roll + h->handling_status;
 
-    printf("[Handling] Control roll: 2d6(%d) + HS(%d) = %d vs target %d\n",
-           h->last_roll, h->handling_status, total, target);
+    if (!h->quiet) {
+        printf("[Handling] Control roll: 2d6(%d) + HS(%d) = %d vs target %d\n",
+               h->last_roll, h->handling_status, total, target);
+    }
 
     if (total >= target) {
         h->last_result = CONTROL_ROLL_PASSED;
-        printf("[Handling] Control roll PASSED\n");
+        if (!h->quiet) printf("[Handling] Control roll PASSED\n");
         return CONTROL_ROLL_PASSED;
     } else {
         h->last_result = CONTROL_ROLL_FAILED;
-        printf("[Handling] Control roll FAILED - Crash Table 1 lookup needed\n");
+        if (!h->quiet) printf("[Handling] Control roll FAILED - Crash Table 1 lookup needed\n");
         return CONTROL_ROLL_FAILED;
     }
 }
@@ -69,7 +87,7 @@ ControlResult handling_apply_maneuver(VehicleHandling* h, int difficulty) {
     int old_hs = h->handling_status;
     h->handling_status -= difficulty;
 
-    printf("[Handling] Maneuver D%d: HS %d -> %d\n", difficulty, old_hs, h->handling_status);
+    if (!h->quiet) printf("[Handling] Maneuver D%d: HS %d -> %d\n", difficulty, old_hs, h->handling_status);
 
     // Control roll needed when HS goes negative
     if (h->handling_status < 0) {
@@ -90,12 +108,12 @@ ControlResult handling_apply_hazard(VehicleHandling* h, int difficulty) {
     int old_hs = h->handling_status;
     h->handling_status -= difficulty;
 
-    printf("[Handling] Hazard D%d: HS %d -> %d\n", difficulty, old_hs, h->handling_status);
+    if (!h->quiet) printf("[Handling] Hazard D%d: HS %d -> %d\n", difficulty, old_hs, h->handling_status);
 
     // Control roll needed when HS goes negative
     if (h->handling_status < 0) {
         ControlResult result = do_control_roll(h, 7);
-        if (result == CONTROL_ROLL_FAILED) {
+        if (result == CONTROL_ROLL_FAILED && !h->quiet) {
             printf("[Handling] Hazard crash - Crash Table 2 lookup needed\n");
         }
         return result;
@@ -109,8 +127,10 @@ ControlResult handling_apply_hazard(VehicleHandling* h, int difficulty) {
 void handling_recover(VehicleHandling* h) {
     if (h->handling_status < h->handling_class) {
         h->handling_status++;
-        printf("[Handling] Recovery: HS -> %d (max %d)\n",
-               h->handling_status, h->handling_class);
+        if (!h->quiet) {
+            printf("[Handling] Recovery: HS -> %d (max %d)\n",
+                   h->handling_status, h->handling_class);
+        }
     }
 }
 
@@ -16,6 +16,7 @@
 #define HANDLING_H
 
 #include <stdbool.h>
+#include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -35,6 +36,12 @@ typedef enum {
     CRASH_TABLE_2_HAZARD,      // Crash Table 2 - hazard event
 } CrashTableType;
 
+// Dice RNG (splitmix64) - same seed gives the same rolls on every platform,
+// so lockstep matches seeded per match replay identical control rolls
+typedef struct {
+    uint64_t state;
+} HandlingRng;
+
 // Vehicle handling state
 typedef struct {
     int handling_class;        // Base HC (calculated from equipment)
@@ -45,11 +52,18 @@ typedef struct {
     int last_roll;             // Last 2d6 roll result
     int last_roll_target;      // What was needed (usually 7)
     ControlResult last_result; // Result of last control check
+
+    HandlingRng rng;           // Dice for this vehicle's control rolls
+    bool quiet;                // No console output (copied from PhysicsWorld.quiet)
 } VehicleHandling;
 
 // Initialize handling state with calculated HC
+// Dice are seeded from the clock; call handling_seed_rng for reproducible rolls
 void handling_init(VehicleHandling* h, int handling_class);
 
+// Seed this vehicle's dice (e.g. from the match seed)
+void handling_seed_rng(VehicleHandling* h, uint64_t seed);
+
 // Reset HS to HC (call at start of turn)
 void handling_reset_turn(VehicleHandling* h);
 
@@ -74,8 +88,11 @@ bool handling_would_need_roll(const VehicleHandling* h, int difficulty);
 // tire_hc_bonus: from tire type (e.g., radials +1)
 int handling_calculate_hc(int chassis_hc_mod, int suspension_hc, int tire_hc_bonus);
 
+// Seed a dice RNG
+void handling_rng_seed(HandlingRng* rng, uint64_t seed);
+
 // Roll 2d6 (for control rolls and crash tables)
-int handling_roll_2d6(void);
+int handling_roll_2d6(HandlingRng* rng);
 
 // Get string description of control result
 const char* handling_result_string(ControlResult result);
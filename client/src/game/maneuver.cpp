@@ -6,6 +6,7 @@
  */
 
 #include "maneuver.h"
+#include "../util/log.h"
 #include <stdio.h>
 #include <math.h>
 #include <string.h>
@@ -294,14 +295,19 @@ bool maneuver_start(ManeuverAutopilot* ap,
     // Validate
     const char* reason = NULL;
     if (!maneuver_validate(request->type, current_speed_ms, &reason)) {
-        printf("[Maneuver] Cannot start %s: %s\n",
-               maneuver_get_name(request->type), reason);
+        if (!ap->quiet) {
+            printf("[Maneuver] Cannot start %s: %s\n",
+                   maneuver_get_name(request->type), reason);
+        }
         return false;
     }
 
-    // Initialize autopilot state
+    // Initialize autopilot state (quiet belongs to the owner)
+    bool quiet = ap->quiet;
     memset(ap, 0, sizeof(*ap));
+    ap->quiet = quiet;
     ap->state = AUTOPILOT_EXECUTING;
+    ap->debug_last_quarter = -1;
     ap->request = *request;
 
     // Capture start state
@@ -323,55 +329,57 @@ bool maneuver_start(ManeuverAutopilot* ap,
     ap->current_pose.heading = current_heading;
 
     // Debug output
-    printf("\n");
-    printf("╔══════════════════════════════════════════════════════════════╗\n");
-    printf("║            KINEMATIC MANEUVER START                          ║\n");
-    printf("╠══════════════════════════════════════════════════════════════╣\n");
-    const char* dir_str = (request->type == MANEUVER_STRAIGHT) ? "-" :
-                          (request->direction == MANEUVER_LEFT ? "LEFT" : "RIGHT");
-    printf("║ Type: %-20s Direction: %-10s          ║\n",
-           maneuver_get_name(request->type), dir_str);
-    printf("╠══════════════════════════════════════════════════════════════╣\n");
-    printf("║ START:  pos=(%.1f, %.1f, %.1f) heading=%.1f°               \n",
-           current_pos.x, current_pos.y, current_pos.z,
-           current_heading * 180.0f / PI);
-    printf("║ TARGET: pos=(%.1f, %.1f, %.1f) heading=%.1f°               \n",
-           ap->target_position.x, ap->target_position.y, ap->target_position.z,
-           ap->target_heading * 180.0f / PI);
-    printf("╠══════════════════════════════════════════════════════════════╣\n");
-
-    // Type-specific parameters
-    if (ap->is_arc_path) {
-        // Bend maneuver: show arc parameters
-        printf("║ Bend: %d° %s | Radius: %.1fm | Duration: %.2fs | Speed: %.1f mph\n",
-               request->bend_angle,
-               request->direction == MANEUVER_LEFT ? "LEFT" : "RIGHT",
-               ap->arc_radius,
-               ap->duration,
-               current_speed_ms * MS_TO_MPH);
-    } else if (request->type == MANEUVER_STRAIGHT) {
-        // Straight: no lateral, just forward
-        printf("║ Forward: %.1fm | Duration: %.2fs | Speed: %.1f mph               \n",
-               ap->duration * current_speed_ms,
-               ap->duration,
-               current_speed_ms * MS_TO_MPH);
-    } else {
-        // Drift maneuver: show lateral displacement
-        float lateral_target = 0.0f;
-        switch (request->type) {
-            case MANEUVER_DRIFT: lateral_target = CW_QUARTER_INCH; break;
-            case MANEUVER_STEEP_DRIFT: lateral_target = CW_HALF_INCH; break;
-            default: lateral_target = 0.0f; break;
+    if (!ap->quiet) {
+        printf("\n");
+        printf("╔══════════════════════════════════════════════════════════════╗\n");
+        printf("║            KINEMATIC MANEUVER START                          ║\n");
+        printf("╠══════════════════════════════════════════════════════════════╣\n");
+        const char* dir_str = (request->type == MANEUVER_STRAIGHT) ? "-" :
+                              (request->direction == MANEUVER_LEFT ? "LEFT" : "RIGHT");
+        printf("║ Type: %-20s Direction: %-10s          ║\n",
+               maneuver_get_name(request->type), dir_str);
+        printf("╠══════════════════════════════════════════════════════════════╣\n");
+        printf("║ START:  pos=(%.1f, %.1f, %.1f) heading=%.1f°               \n",
+               current_pos.x, current_pos.y, current_pos.z,
+               current_heading * 180.0f / PI);
+        printf("║ TARGET: pos=(%.1f, %.1f, %.1f) heading=%.1f°               \n",
+               ap->target_position.x, ap->target_position.y, ap->target_position.z,
+               ap->target_heading * 180.0f / PI);
+        printf("╠══════════════════════════════════════════════════════════════╣\n");
+
+        // Type-specific parameters
+        if (ap->is_arc_path) {
+            // Bend maneuver: show arc parameters
+            printf("║ Bend: %d° %s | Radius: %.1fm | Duration: %.2fs | Speed: %.1f mph\n",
+                   request->bend_angle,
+                   request->direction == MANEUVER_LEFT ? "LEFT" : "RIGHT",
+                   ap->arc_radius,
+                   ap->duration,
+                   current_speed_ms * MS_TO_MPH);
+        } else if (request->type == MANEUVER_STRAIGHT) {
+            // Straight: no lateral, just forward
+            printf("║ Forward: %.1fm | Duration: %.2fs | Speed: %.1f mph               \n",
+                   ap->duration * current_speed_ms,
+                   ap->duration,
+                   current_speed_ms * MS_TO_MPH);
+        } else {
+            // Drift maneuver: show lateral displacement
+            float lateral_target = 0.0f;
+            switch (request->type) {
+                case MANEUVER_DRIFT: lateral_target = CW_QUARTER_INCH; break;
+                case MANEUVER_STEEP_DRIFT: lateral_target = CW_HALF_INCH; break;
+                default: lateral_target = 0.0f; break;
+            }
+            printf("║ Lateral: %.2fm %s | Duration: %.2fs | Speed: %.1f mph       \n",
+                   lateral_target,
+                   request->direction == MANEUVER_LEFT ? "LEFT" : "RIGHT",
+                   ap->duration,
+                   current_speed_ms * MS_TO_MPH);
         }
-        printf("║ Lateral: %.2fm %s | Duration: %.2fs | Speed: %.1f mph       \n",
-               lateral_target,
-               request->direction == MANEUVER_LEFT ? "LEFT" : "RIGHT",
-               ap->duration,
-               current_speed_ms * MS_TO_MPH);
-    }
 
-    printf("╚══════════════════════════════════════════════════════════════╝\n");
-    fflush(stdout);
+        printf("╚══════════════════════════════════════════════════════════════╝\n");
+        fflush(stdout);
+    }
 
     // Set up as single-phase turn for compatibility
     ap->num_phases = 1;
@@ -519,7 +527,7 @@ bool maneuver_start_turn(ManeuverAutopilot* ap,
                          float current_heading,
                          float current_speed_ms) {
     if (num_phases < 1 || num_phases > MAX_TURN_PHASES) {
-        printf("[Maneuver] Invalid number of phases: %d\n", num_phases);
+        if (!ap->quiet) printf("[Maneuver] Invalid number of phases: %d\n", num_phases);
         return false;
     }
 
@@ -529,15 +537,20 @@ bool maneuver_start_turn(ManeuverAutopilot* ap,
         ManeuverType type = requests[i].type;
         if (type == MANEUVER_NONE) type = MANEUVER_STRAIGHT;  // Treat NONE as STRAIGHT
         if (!maneuver_validate(type, current_speed_ms, &reason)) {
-            printf("[Maneuver] Cannot start phase %d (%s): %s\n",
-                   phase_indices[i] + 1, maneuver_get_name(type), reason);
+            if (!ap->quiet) {
+                printf("[Maneuver] Cannot start phase %d (%s): %s\n",
+                       phase_indices[i] + 1, maneuver_get_name(type), reason);
+            }
             return false;
         }
     }
 
-    // Initialize autopilot state
+    // Initialize autopilot state (quiet belongs to the owner)
+    bool quiet = ap->quiet;
     memset(ap, 0, sizeof(*ap));
+    ap->quiet = quiet;
     ap->state = AUTOPILOT_EXECUTING;
+    ap->debug_last_quarter = -1;
     ap->start_position = current_pos;
     ap->start_heading = current_heading;
     ap->start_speed_ms = current_speed_ms;
@@ -554,13 +567,15 @@ bool maneuver_start_turn(ManeuverAutopilot* ap,
     Vec3 phase_start_pos = current_pos;
     float phase_start_heading = current_heading;
 
-    printf("\n");
-    printf("╔══════════════════════════════════════════════════════════════╗\n");
-    printf("║            MULTI-PHASE TURN START (%d phases)                 ║\n", num_phases);
-    printf("╠══════════════════════════════════════════════════════════════╣\n");
-    printf("║ Speed: %.1f mph | Total Duration: 1.0s                       \n",
-           current_speed_ms * MS_TO_MPH);
-    printf("╠══════════════════════════════════════════════════════════════╣\n");
+    if (!ap->quiet) {
+        printf("\n");
+        printf("╔══════════════════════════════════════════════════════════════╗\n");
+        printf("║            MULTI-PHASE TURN START (%d phases)                 ║\n", num_phases);
+        printf("╠══════════════════════════════════════════════════════════════╣\n");
+        printf("║ Speed: %.1f mph | Total Duration: 1.0s                       \n",
+               current_speed_ms * MS_TO_MPH);
+        printf("╠══════════════════════════════════════════════════════════════╣\n");
+    }
 
     for (int i = 0; i < num_phases; i++) {
         TurnPhase* phase = &ap->phases[i];
@@ -585,27 +600,31 @@ bool maneuver_start_turn(ManeuverAutopilot* ap,
         // Debug output
         const char* dir_str = (phase->request.type == MANEUVER_STRAIGHT) ? "-" :
                               (phase->request.direction == MANEUVER_LEFT ? "L" : "R");
-        printf("║ P%d: %-12s %s | %.2fs-%.2fs | fwd=%.1fm               \n",
-               phase_indices[i] + 1,
-               maneuver_get_name(phase->request.type),
-               dir_str,
-               phase->start_time, phase->end_time,
-               current_speed_ms * phase_duration);
+        if (!ap->quiet) {
+            printf("║ P%d: %-12s %s | %.2fs-%.2fs | fwd=%.1fm               \n",
+                   phase_indices[i] + 1,
+                   maneuver_get_name(phase->request.type),
+                   dir_str,
+                   phase->start_time, phase->end_time,
+                   current_speed_ms * phase_duration);
+        }
 
         // Update for next phase (chain positions)
         phase_start_pos = phase->target_position;
         phase_start_heading = phase->target_heading;
     }
 
-    printf("╠══════════════════════════════════════════════════════════════╣\n");
-    printf("║ START:  pos=(%.1f, %.1f, %.1f) heading=%.1f°               \n",
-           current_pos.x, current_pos.y, current_pos.z,
-           current_heading * 180.0f / PI);
-    printf("║ TARGET: pos=(%.1f, %.1f, %.1f) heading=%.1f°               \n",
-           phase_start_pos.x, phase_start_pos.y, phase_start_pos.z,
-           phase_start_heading * 180.0f / PI);
-    printf("╚══════════════════════════════════════════════════════════════╝\n");
-    fflush(stdout);
+    if (!ap->quiet) {
+        printf("╠══════════════════════════════════════════════════════════════╣\n");
+        printf("║ START:  pos=(%.1f, %.1f, %.1f) heading=%.1f°               \n",
+               current_pos.x, current_pos.y, current_pos.z,
+               current_heading * 180.0f / PI);
+        printf("║ TARGET: pos=(%.1f, %.1f, %.1f) heading=%.1f°               \n",
+               phase_start_pos.x, phase_start_pos.y, phase_start_pos.z,
+               phase_start_heading * 180.0f / PI);
+        printf("╚══════════════════════════════════════════════════════════════╝\n");
+        fflush(stdout);
+    }
 
     // Set up initial state from first phase
     ap->request = ap->phases[0].request;
@@ -746,8 +765,8 @@ ManeuverPose maneuver_update(ManeuverAutopilot* ap,
 
     // Track phase transitions for debug output
     if (phase_idx != ap->current_phase) {
-        printf("[Turn] Phase transition: %d -> %d at %.0f%%\n",
-               ap->current_phase + 1, phase_idx + 1, ap->progress * 100.0f);
+        LOG_DEBUG(LOG_MANEUVER, "[Turn] Phase transition: %d -> %d at %.0f%%",
+                  ap->current_phase + 1, phase_idx + 1, ap->progress * 100.0f);
         ap->current_phase = phase_idx;
     }
 
@@ -771,63 +790,61 @@ ManeuverPose maneuver_update(ManeuverAutopilot* ap,
     ap->lateral_displacement = dx * cos_h - dz * sin_h;
 
     // Debug output at 25% intervals
-    static int last_quarter = -1;
     int quarter = (int)(ap->progress * 4.0f);
-    if (quarter != last_quarter && quarter <= 4) {
+    if (quarter != ap->debug_last_quarter && quarter <= 4) {
         if (ap->num_phases > 1) {
-            printf("[Turn] %.0f%% (P%d) | pos=(%.1f, %.1f) | heading=%.1f° | lat=%.2fm\n",
-                   ap->progress * 100.0f,
-                   phase_idx + 1,
-                   ap->current_pose.position.x, ap->current_pose.position.z,
-                   ap->current_pose.heading * 180.0f / PI,
-                   ap->lateral_displacement);
+            LOG_DEBUG(LOG_MANEUVER, "[Turn] %.0f%% (P%d) | pos=(%.1f, %.1f) | heading=%.1f° | lat=%.2fm",
+                      ap->progress * 100.0f,
+                      phase_idx + 1,
+                      ap->current_pose.position.x, ap->current_pose.position.z,
+                      ap->current_pose.heading * 180.0f / PI,
+                      ap->lateral_displacement);
         } else {
-            printf("[Kinematic] %.0f%% | pos=(%.1f, %.1f) | heading=%.1f° | lat=%.2fm\n",
-                   ap->progress * 100.0f,
-                   ap->current_pose.position.x, ap->current_pose.position.z,
-                   ap->current_pose.heading * 180.0f / PI,
-                   ap->lateral_displacement);
+            LOG_DEBUG(LOG_MANEUVER, "[Kinematic] %.0f%% | pos=(%.1f, %.1f) | heading=%.1f° | lat=%.2fm",
+                      ap->progress * 100.0f,
+                      ap->current_pose.position.x, ap->current_pose.position.z,
+                      ap->current_pose.heading * 180.0f / PI,
+                      ap->lateral_displacement);
         }
-        fflush(stdout);
-        last_quarter = quarter;
+        ap->debug_last_quarter = quarter;
     }
 
     // Check completion
     if (ap->progress >= 1.0f) {
         ap->state = AUTOPILOT_FINISHED;
         *out_complete = true;
-        last_quarter = -1;  // Reset for next turn
+        ap->debug_last_quarter = -1;  // Reset for next turn
 
         // Final position exactly at target (last phase's target)
         const TurnPhase* last_phase = &ap->phases[ap->num_phases - 1];
         ap->current_pose.position = last_phase->target_position;
         ap->current_pose.heading = last_phase->target_heading;
 
-        printf("\n");
-        printf("╔══════════════════════════════════════════════════════════════╗\n");
-        if (ap->num_phases > 1) {
-            printf("║            MULTI-PHASE TURN COMPLETE (%d phases)              ║\n", ap->num_phases);
-        } else {
-            printf("║            KINEMATIC MANEUVER COMPLETE                       ║\n");
+        if (!ap->quiet) {
+            LOG_INFO(LOG_MANEUVER, "\n╔══════════════════════════════════════════════════════════════╗");
+            if (ap->num_phases > 1) {
+                LOG_INFO(LOG_MANEUVER, "║            MULTI-PHASE TURN COMPLETE (%d phases)              ║", ap->num_phases);
+            } else {
+                LOG_INFO(LOG_MANEUVER, "║            KINEMATIC MANEUVER COMPLETE                       ║");
+            }
+            LOG_INFO(LOG_MANEUVER, "╠══════════════════════════════════════════════════════════════╣");
+            LOG_INFO(LOG_MANEUVER, "║ Duration: %.2fs                                             ",
+                     ap->elapsed);
+            LOG_INFO(LOG_MANEUVER, "║ Final: pos=(%.1f, %.1f, %.1f) heading=%.1f°                ",
+                     ap->current_pose.position.x, ap->current_pose.position.y,
+                     ap->current_pose.position.z,
+                     ap->current_pose.heading * 180.0f / PI);
+            LOG_INFO(LOG_MANEUVER, "║ Lateral: %.2fm | Forward: %.2fm                            ",
+                     ap->lateral_displacement, ap->forward_displacement);
+            LOG_INFO(LOG_MANEUVER, "╚══════════════════════════════════════════════════════════════╝");
         }
-        printf("╠══════════════════════════════════════════════════════════════╣\n");
-        printf("║ Duration: %.2fs                                             \n",
-               ap->elapsed);
-        printf("║ Final: pos=(%.1f, %.1f, %.1f) heading=%.1f°                \n",
-               ap->current_pose.position.x, ap->current_pose.position.y,
-               ap->current_pose.position.z,
-               ap->current_pose.heading * 180.0f / PI);
-        printf("║ Lateral: %.2fm | Forward: %.2fm                            \n",
-               ap->lateral_displacement, ap->forward_displacement);
-        printf("╚══════════════════════════════════════════════════════════════╝\n");
-        fflush(stdout);
     }
 
     return ap->current_pose;
 }
 
 void maneuver_cancel(ManeuverAutopilot* ap) {
-    if (ap->state != AUTOPILOT_IDLE) {
+    if (ap->state != AUTOPILOT_IDLE && !ap->quiet) {
         printf("[Maneuver] Cancelled after %.2fs\n", ap->elapsed);
     }
     ap->state = AUTOPILOT_IDLE;
@@ -140,11 +140,15 @@ typedef struct {
     // Debug info
     float lateral_displacement;   // Current lateral offset from start
     float forward_displacement;   // Current forward offset from start
+    int debug_last_quarter;       // Last 25% progress mark logged (-1 = none yet)
 
     // Multi-phase turn support
     int num_phases;               // Number of phases in this turn (1-5)
     int current_phase;            // Which phase we're currently executing (0-based)
     TurnPhase phases[MAX_TURN_PHASES];  // Phase data array
+
+    // No console output (copied from PhysicsWorld.quiet; kept across starts)
+    bool quiet;
 } ManeuverAutopilot;
 
 // Validate if a maneuver can be performed at current speed
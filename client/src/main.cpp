@@ -30,10 +30,19 @@
 #include "ui/ui_render.h"
 #include "ui/ui_text.h"
 #include "physics/jolt_physics.h"
+#include "physics/turn_predictor.h"
+#include "physics/sim_thread.h"
+#include "game/config_cache.h"
 #include "game/config_loader.h"
 #include "game/equipment_loader.h"
 #include "game/maneuver.h"
 #include "script/reflex_script.h"
+#include "script/script_cache.h"
+#include "script/script_profile.h"
+#include "script/script_watch.h"
+#include "util/job_graph.h"
+#include "util/profiler.h"
+#include "util/log.h"
 
 #include <GL/glew.h>
 #include <stdio.h>
@@ -135,71 +144,85 @@ static bool read_chassis_id_from_json(const char* filepath, char* chassis_id_out
     return false;
 }
 
-// Load a vehicle type (config + mesh), returns type index or -1 on failure
-static int load_vehicle_type(const char* type_name) {
-    // Check if already loaded
-    int existing = find_vehicle_type(type_name);
-    if (existing >= 0) return existing;
+// ============================================================================
+// Startup loading
+// ============================================================================
+// Parsing and decoding (JSON, OBJ, PNG, font atlas) run as jobs on worker
+// threads; the GL uploads run on this thread as JOB_MAIN_THREAD jobs.
+//
+//   equipment ──┐
+//   scene ──────┴─> vehicle config (per type) ─> body OBJ, texture ─┐
+//   wheel OBJ ─────────────────────────────────────────────────────┴─> upload
+//   font atlas ─> upload          particle effects
 
-    // Check capacity
-    if (g_vehicle_type_count >= MAX_VEHICLE_TYPES) {
-        fprintf(stderr, "Too many vehicle types (max %d)\n", MAX_VEHICLE_TYPES);
-        return -1;
-    }
+#define STARTUP_WHEEL_OBJ "../../assets/models/wheels/wheel_standard.obj"
 
-    int idx = g_vehicle_type_count;
-    VehicleMesh* mesh = &g_vehicle_meshes[idx];
-    VehicleJSON* config = &g_vehicle_configs[idx];
+struct StartupLoad;
 
-    // Initialize mesh struct
-    memset(mesh, 0, sizeof(VehicleMesh));
-
-    // Build vehicle config path
+// One vehicle type, loaded into slot type_idx of g_vehicle_meshes/configs
+typedef struct {
+    StartupLoad* load;
+    int type_idx;
+    char type_name[64];
     char config_path[256];
-    snprintf(config_path, sizeof(config_path), "../../assets/data/vehicles/%s.json", type_name);
-
-    // Read chassis ID from JSON first (before full config load)
-    char chassis_id[64] = {0};
-    if (!read_chassis_id_from_json(config_path, chassis_id, sizeof(chassis_id))) {
-        fprintf(stderr, "Could not find chassis in: %s\n", config_path);
-        return -1;
+    char body_path[256];
+    char texture_path[256];  // Empty = no texture
+    bool config_ok;          // Config and chassis resolved (the type is kept)
+    bool body_ok;
+    bool texture_ok;
+    ObjMeshData body;
+    TextureImage texture;
+} VehicleTypeLoad;
+
+struct StartupLoad {
+    int equipment_job;
+    int wheel_job;
+    SceneJSON* scene;
+    bool scene_ok;
+    ObjMeshData wheel;       // Shared by every vehicle type
+    bool wheel_ok;
+    VehicleTypeLoad vehicles[MAX_VEHICLE_TYPES];
+    int vehicle_count;
+    TextRenderer* text;
+    bool text_ok;
+    bool effects_ok;
+};
+
+static void startup_equipment_job(JobGraph*, void*) {
+    if (!equipment_load_all("../../assets/data/equipment")) {
+        fprintf(stderr, "Warning: Equipment data not loaded - using defaults\n");
     }
+}
 
-    // Store chassis ID
-    strncpy(mesh->chassis_id, chassis_id, sizeof(mesh->chassis_id) - 1);
-
-    // Load vehicle config
-    if (!config_load_vehicle(config_path, config)) {
-        fprintf(stderr, "Failed to load vehicle config: %s\n", config_path);
-        return -1;
-    }
+static void startup_wheel_job(JobGraph*, void* user) {
+    StartupLoad* load = (StartupLoad*)user;
+    load->wheel_ok = obj_parse_groups(&load->wheel, STARTUP_WHEEL_OBJ, NULL, 0);
+}
 
-    // Store type name
-    strncpy(mesh->type_name, type_name, sizeof(mesh->type_name) - 1);
-    mesh->type_name[sizeof(mesh->type_name) - 1] = '\0';
+static void startup_vehicle_body_job(JobGraph*, void* user) {
+    VehicleTypeLoad* v = (VehicleTypeLoad*)user;
+    v->body_ok = obj_parse_groups(&v->body, v->body_path, NULL, 0);
+}
 
-    // Get chassis equipment to find model path
-    const ChassisEquipment* chassis = equipment_find_chassis(chassis_id);
-    if (!chassis) {
-        fprintf(stderr, "Chassis '%s' not found for vehicle '%s'\n", chassis_id, type_name);
-        return -1;
-    }
+static void startup_vehicle_texture_job(JobGraph*, void* user) {
+    VehicleTypeLoad* v = (VehicleTypeLoad*)user;
+    v->texture_ok = texture_decode(&v->texture, v->texture_path);
+}
 
-    // Build model paths
-    char body_path[256];
-    char wheel_path[256];
-    snprintf(body_path, sizeof(body_path), "../../assets/%s", chassis->model);
-    // Use standard wheel for now (could be per-tire later)
-    snprintf(wheel_path, sizeof(wheel_path), "../../assets/models/wheels/wheel_standard.obj");
+// GL side of a vehicle type: upload meshes, size the body, upload texture
+static void startup_vehicle_upload_job(JobGraph*, void* user) {
+    VehicleTypeLoad* v = (VehicleTypeLoad*)user;
+    VehicleMesh* mesh = &g_vehicle_meshes[v->type_idx];
+    VehicleJSON* config = &g_vehicle_configs[v->type_idx];
 
-    printf("Loading vehicle type '%s':\n", type_name);
-    printf("  Config: %s\n", config_path);
-    printf("  Body:   %s\n", body_path);
-    printf("  Wheel:  %s\n", wheel_path);
+    printf("Loading vehicle type '%s':\n", v->type_name);
+    printf("  Config: %s\n", v->config_path);
+    printf("  Body:   %s\n", v->body_path);
+    printf("  Wheel:  %s\n", STARTUP_WHEEL_OBJ);
 
-    // Load meshes
-    bool body_loaded = obj_load(&mesh->body, body_path);
-    bool wheel_loaded = obj_load(&mesh->wheel, wheel_path);
+    // Upload meshes
+    bool body_loaded = v->body_ok && obj_upload(&mesh->body, &v->body);
+    bool wheel_loaded = v->load->wheel_ok && obj_upload(&mesh->wheel, &v->load->wheel);
 
     if (body_loaded && wheel_loaded) {
         // Calculate body scale
@@ -242,12 +265,10 @@ static int load_vehicle_type(const char* type_name) {
         printf("  Physics dims: %.2fm x %.2fm x %.2fm\n",
                config->chassis_length, config->chassis_width, config->chassis_height);
 
-        // Load texture if specified and mesh has UVs
+        // Upload texture if specified and mesh has UVs (decoded either way)
         mesh->texture = 0;
         if (config->texture[0] != '\0' && mesh->body.has_uvs) {
-            char texture_path[256];
-            snprintf(texture_path, sizeof(texture_path), "../../assets/%s", config->texture);
-            mesh->texture = texture_load(texture_path);
+            mesh->texture = v->texture_ok ? texture_upload(&v->texture) : 0;
             if (mesh->texture) {
                 printf("  Texture: %s (loaded)\n", config->texture);
             } else {
@@ -262,8 +283,156 @@ static int load_vehicle_type(const char* type_name) {
         mesh->loaded = false;
     }
 
-    g_vehicle_type_count++;
-    return idx;
+    obj_data_free(&v->body);
+    texture_image_free(&v->texture);
+}
+
+// CPU side of a vehicle type: config and chassis, then queue its assets
+static void startup_vehicle_config_job(JobGraph* graph, void* user) {
+    VehicleTypeLoad* v = (VehicleTypeLoad*)user;
+    VehicleMesh* mesh = &g_vehicle_meshes[v->type_idx];
+    VehicleJSON* config = &g_vehicle_configs[v->type_idx];
+
+    // Initialize mesh struct
+    memset(mesh, 0, sizeof(VehicleMesh));
+
+    // Build vehicle config path
+    snprintf(v->config_path, sizeof(v->config_path), "../../assets/data/vehicles/%s.json", v->type_name);
+
+    // Read chassis ID from JSON first (before full config load)
+    char chassis_id[64] = {0};
+    if (!read_chassis_id_from_json(v->config_path, chassis_id, sizeof(chassis_id))) {
+        fprintf(stderr, "Could not find chassis in: %s\n", v->config_path);
+        return;
+    }
+
+    // Store chassis ID
+    strncpy(mesh->chassis_id, chassis_id, sizeof(mesh->chassis_id) - 1);
+
+    // Load vehicle config
+    if (!config_load_vehicle(v->config_path, config)) {
+        fprintf(stderr, "Failed to load vehicle config: %s\n", v->config_path);
+        return;
+    }
+
+    // Store type name
+    strncpy(mesh->type_name, v->type_name, sizeof(mesh->type_name) - 1);
+    mesh->type_name[sizeof(mesh->type_name) - 1] = '\0';
+
+    // Get chassis equipment to find model path
+    const ChassisEquipment* chassis = equipment_find_chassis(chassis_id);
+    if (!chassis) {
+        fprintf(stderr, "Chassis '%s' not found for vehicle '%s'\n", chassis_id, v->type_name);
+        return;
+    }
+    v->config_ok = true;
+
+    // Build asset paths (use standard wheel for now, could be per-tire later)
+    snprintf(v->body_path, sizeof(v->body_path), "../../assets/%s", chassis->model);
+    if (config->texture[0] != '\0') {
+        snprintf(v->texture_path, sizeof(v->texture_path), "../../assets/%s", config->texture);
+    }
+
+    int deps[3];
+    int dep_count = 0;
+    deps[dep_count++] = v->load->wheel_job;
+    deps[dep_count++] = job_graph_add(graph, "Startup.VehicleBody", startup_vehicle_body_job, v, NULL, 0, 0);
+    if (v->texture_path[0] != '\0') {
+        deps[dep_count++] = job_graph_add(graph, "Startup.VehicleTexture", startup_vehicle_texture_job, v, NULL, 0, 0);
+    }
+    job_graph_add(graph, "Startup.VehicleUpload", startup_vehicle_upload_job, v,
+                  deps, dep_count, JOB_MAIN_THREAD);
+}
+
+// Scene config, then one load per distinct vehicle type (in scene order)
+static void startup_scene_job(JobGraph* graph, void* user) {
+    StartupLoad* load = (StartupLoad*)user;
+    load->scene_ok = config_load_scene("../../assets/config/scenes/showdown.json", load->scene);
+    if (!load->scene_ok) {
+        fprintf(stderr, "\n*** ERROR: Scene config failed to load! ***\n");
+        fprintf(stderr, "*** Check assets/config/scenes/showdown.json ***\n\n");
+        return;
+    }
+
+    printf("\n=== Loading Vehicle Types ===\n");
+    for (int i = 0; i < load->scene->vehicle_count; i++) {
+        const char* type_name = load->scene->vehicles[i].type;
+        bool queued = false;
+        for (int t = 0; t < load->vehicle_count && !queued; t++) {
+            queued = strcmp(load->vehicles[t].type_name, type_name) == 0;
+        }
+        if (queued) continue;
+
+        // Check capacity
+        if (load->vehicle_count >= MAX_VEHICLE_TYPES) {
+            fprintf(stderr, "Too many vehicle types (max %d)\n", MAX_VEHICLE_TYPES);
+            continue;
+        }
+
+        VehicleTypeLoad* v = &load->vehicles[load->vehicle_count];
+        v->load = load;
+        v->type_idx = load->vehicle_count++;
+        strncpy(v->type_name, type_name, sizeof(v->type_name) - 1);
+        job_graph_add(graph, "Startup.VehicleConfig", startup_vehicle_config_job, v,
+                      &load->equipment_job, 1, 0);
+    }
+}
+
+static void startup_font_job(JobGraph*, void* user) {
+    StartupLoad* load = (StartupLoad*)user;
+    text_renderer_bake(load->text, "../../assets/fonts/Roboto-Bold.ttf", 18.0f);
+}
+
+static void startup_font_upload_job(JobGraph*, void* user) {
+    StartupLoad* load = (StartupLoad*)user;
+    load->text_ok = text_renderer_upload(load->text);
+}
+
+static void startup_effects_job(JobGraph*, void* user) {
+    StartupLoad* load = (StartupLoad*)user;
+    load->effects_ok = particle_effects_load("../../assets/data/effects/particles.json");
+}
+
+// Load equipment, scene, vehicle types, font and particle effects.
+// threads < 0: one worker per core, 0: everything on this thread.
+static void startup_load(StartupLoad* load, SceneJSON* scene, TextRenderer* text, int threads) {
+    PROFILE_SCOPE("Startup.Load");
+    uint64_t start_ns = profiler_now_ns();
+
+    memset(load, 0, sizeof(*load));
+    load->scene = scene;
+    load->text = text;
+    memset(scene, 0, sizeof(*scene));
+    memset(text, 0, sizeof(*text));
+
+    JobGraph* graph = job_graph_create(threads);
+    load->equipment_job = job_graph_add(graph, "Startup.Equipment", startup_equipment_job, load, NULL, 0, 0);
+    load->wheel_job = job_graph_add(graph, "Startup.WheelMesh", startup_wheel_job, load, NULL, 0, 0);
+    job_graph_add(graph, "Startup.Scene", startup_scene_job, load, NULL, 0, 0);
+    int font_job = job_graph_add(graph, "Startup.Font", startup_font_job, load, NULL, 0, 0);
+    job_graph_add(graph, "Startup.FontUpload", startup_font_upload_job, load, &font_job, 1, JOB_MAIN_THREAD);
+    job_graph_add(graph, "Startup.Effects", startup_effects_job, load, NULL, 0, 0);
+    job_graph_run(graph);
+    int workers = job_graph_worker_count(graph);
+    job_graph_destroy(graph);
+    obj_data_free(&load->wheel);
+
+    // Keep the types that resolved, in scene order
+    g_vehicle_type_count = 0;
+    for (int i = 0; i < load->vehicle_count; i++) {
+        const VehicleTypeLoad* v = &load->vehicles[i];
+        if (!v->config_ok) continue;
+        if (v->type_idx != g_vehicle_type_count) {
+            g_vehicle_meshes[g_vehicle_type_count] = g_vehicle_meshes[v->type_idx];
+            g_vehicle_configs[g_vehicle_type_count] = g_vehicle_configs[v->type_idx];
+        }
+        g_vehicle_type_count++;
+    }
+    if (load->scene_ok) {
+        printf("=== Loaded %d vehicle type(s) ===\n", g_vehicle_type_count);
+    }
+    printf("Startup assets loaded in %.0f ms (%d worker thread%s)\n\n",
+           (profiler_now_ns() - start_ns) / 1e6, workers, workers == 1 ? "" : "s");
 }
 
 // Get mesh for a physics vehicle
@@ -311,6 +480,25 @@ typedef struct {
     int turn_vehicle_id;              // Vehicle ID for the executing turn
 } PlanningState;
 
+// Turn plan the ghost path was last predicted for
+typedef struct {
+    int vehicle_id;
+    ManeuverType type;
+    ManeuverDirection direction;
+    int bend_angle;
+    SpeedChoice speed_choice;
+    int snapshot_speed;
+} GhostPlan;
+
+static bool ghost_plan_equal(const GhostPlan* a, const GhostPlan* b) {
+    return a->vehicle_id == b->vehicle_id &&
+           a->type == b->type &&
+           a->direction == b->direction &&
+           a->bend_angle == b->bend_angle &&
+           a->speed_choice == b->speed_choice &&
+           a->snapshot_speed == b->snapshot_speed;
+}
+
 // Physics state for freestyle mode
 typedef struct {
     float velocity;          // Current speed in game units/sec
@@ -505,7 +693,7 @@ static void draw_ramps(BoxRenderer* r, SceneJSON* scene) {
 
 // Draw physics vehicles as solid primitives (box chassis only, wheels drawn separately)
 // team_for_vehicle maps physics vehicle id -> team (TEAM_RED, TEAM_BLUE, etc.)
-static void draw_physics_vehicles(BoxRenderer* r, PhysicsWorld* pw, int selected_id, Team* team_for_vehicle) {
+static void draw_physics_vehicles(BoxRenderer* r, const SimFrame* frame, float alpha, int selected_id, Team* team_for_vehicle) {
     // Team colors
     Vec3 red_color = vec3(0.8f, 0.2f, 0.2f);         // Red team
     Vec3 red_selected = vec3(1.0f, 0.4f, 0.4f);      // Red selected
@@ -513,8 +701,9 @@ static void draw_physics_vehicles(BoxRenderer* r, PhysicsWorld* pw, int selected
     Vec3 blue_selected = vec3(0.4f, 0.6f, 1.0f);     // Blue selected
     Vec3 front_color = vec3(0.9f, 0.9f, 0.2f);       // Yellow front indicator
 
-    for (int i = 0; i < pw->vehicle_count; i++) {
-        if (!pw->vehicles[i].active) continue;
+    for (int n = 0; n < frame->vehicle_count; n++) {
+        const SimVehicleState* v = &frame->vehicles[n];
+        int i = v->id;
 
         // Get team-based color
         Team team = team_for_vehicle ? team_for_vehicle[i] : TEAM_RED;
@@ -522,14 +711,10 @@ static void draw_physics_vehicles(BoxRenderer* r, PhysicsWorld* pw, int selected
         Vec3 sel_color = (team == TEAM_BLUE) ? blue_selected : red_selected;
         Vec3 color = (i == selected_id) ? sel_color : base_color;
 
-        // Get chassis position and full rotation from physics
+        // Get chassis position and full rotation, interpolated between physics steps
         Vec3 pos;
         float rot_matrix[9];  // 3x3 row-major rotation matrix
-        physics_vehicle_get_position(pw, i, &pos);
-        physics_vehicle_get_rotation_matrix(pw, i, rot_matrix);
-
-        // Get vehicle config for dimensions
-        VehicleConfig* cfg = &pw->vehicles[i].config;
+        sim_vehicle_render_transform(v, alpha, &pos, rot_matrix);
 
         // Get the correct mesh for this vehicle type
         VehicleMesh* vmesh = get_vehicle_mesh(i);
@@ -554,19 +739,19 @@ static void draw_physics_vehicles(BoxRenderer* r, PhysicsWorld* pw, int selected
             }
             // Wheels rendered separately by draw_vehicle_wheels_mesh()
         } else {
-            Vec3 chassis_size = vec3(cfg->chassis_width, cfg->chassis_height, cfg->chassis_length);
+            Vec3 chassis_size = vec3(v->chassis_width, v->chassis_height, v->chassis_length);
             box_renderer_draw_rotated_matrix(r, pos, chassis_size, rot_matrix, color);
 
             // Draw front indicator (yellow bar at front of car) - only for box mode
-            float front_offset = cfg->chassis_length * 0.35f;
+            float front_offset = v->chassis_length * 0.35f;
             float indicator_height = 0.3f;
-            float local_y = cfg->chassis_height * 0.5f + indicator_height * 0.5f;
+            float local_y = v->chassis_height * 0.5f + indicator_height * 0.5f;
             Vec3 front_pos = vec3(
                 pos.x + rot_matrix[2] * front_offset + rot_matrix[1] * local_y,
                 pos.y + rot_matrix[5] * front_offset + rot_matrix[4] * local_y,
                 pos.z + rot_matrix[8] * front_offset + rot_matrix[7] * local_y
             );
-            Vec3 front_size = vec3(cfg->chassis_width * 0.7f, indicator_height, 0.4f);
+            Vec3 front_size = vec3(v->chassis_width * 0.7f, indicator_height, 0.4f);
             box_renderer_draw_rotated_matrix(r, front_pos, front_size, rot_matrix, front_color);
         }
     }
@@ -574,21 +759,20 @@ static void draw_physics_vehicles(BoxRenderer* r, PhysicsWorld* pw, int selected
 
 // Draw wheels as cylinders with rotating spokes (batched - efficient)
 // Uses Jolt wheel transform for correct display during rollovers
-static void draw_vehicle_wheels(LineRenderer* lr, PhysicsWorld* pw) {
+static void draw_vehicle_wheels(LineRenderer* lr, const SimFrame* frame, float alpha) {
     Vec3 rim_color = vec3(0.3f, 0.3f, 0.35f);     // Dark grey rim
     Vec3 spoke_color = vec3(0.8f, 0.8f, 0.8f);    // Light grey spokes
 
-    for (int i = 0; i < pw->vehicle_count; i++) {
-        if (!pw->vehicles[i].active) continue;
+    for (int n = 0; n < frame->vehicle_count; n++) {
+        const SimVehicleState* v = &frame->vehicles[n];
 
-        VehicleConfig* cfg = &pw->vehicles[i].config;
         WheelState wheels[4];
-        physics_vehicle_get_wheel_states(pw, i, wheels);
+        sim_vehicle_render_wheels(v, alpha, wheels);
 
         for (int w = 0; w < 4; w++) {
             Vec3 center = wheels[w].position;
-            float radius = cfg->use_per_wheel_config ? cfg->wheel_radii[w] : cfg->wheel_radius;
-            float width = cfg->use_per_wheel_config ? cfg->wheel_widths[w] : cfg->wheel_width;
+            float radius = v->wheel_radius[w];
+            float width = v->wheel_width[w];
             float halfWidth = width * 0.5f;
             float spin = wheels[w].rotation;
 
@@ -676,14 +860,14 @@ static void draw_vehicle_wheels(LineRenderer* lr, PhysicsWorld* pw) {
 
 // Draw wheels using loaded mesh at physics wheel positions
 // Uses Jolt wheel transform for correct display during rollovers
-static void draw_vehicle_wheels_mesh(BoxRenderer* r, PhysicsWorld* pw) {
+static void draw_vehicle_wheels_mesh(BoxRenderer* r, const SimFrame* frame, float alpha) {
     Vec3 wheel_color = vec3(0.2f, 0.2f, 0.22f);  // Dark tire color
 
-    for (int i = 0; i < pw->vehicle_count; i++) {
-        if (!pw->vehicles[i].active) continue;
+    for (int n = 0; n < frame->vehicle_count; n++) {
+        const SimVehicleState* v = &frame->vehicles[n];
 
         // Get the correct mesh for this vehicle type
-        VehicleMesh* vmesh = get_vehicle_mesh(i);
+        VehicleMesh* vmesh = get_vehicle_mesh(v->id);
         if (!vmesh->loaded) continue;
 
         // Pre-translation to center the wheel mesh at origin
@@ -691,13 +875,12 @@ static void draw_vehicle_wheels_mesh(BoxRenderer* r, PhysicsWorld* pw) {
                                   -vmesh->wheel_center.y,
                                   -vmesh->wheel_center.z);
 
-        VehicleConfig* cfg = &pw->vehicles[i].config;
         WheelState wheels[4];
-        physics_vehicle_get_wheel_states(pw, i, wheels);
+        sim_vehicle_render_wheels(v, alpha, wheels);
 
         for (int w = 0; w < 4; w++) {
             Vec3 center = wheels[w].position;
-            float radius = cfg->use_per_wheel_config ? cfg->wheel_radii[w] : cfg->wheel_radius;
+            float radius = v->wheel_radius[w];
 
             // Scale wheel mesh to match physics wheel radius
             float wheel_scale = vmesh->wheel_scale * (radius / 0.32f);
@@ -752,11 +935,26 @@ static bool g_verbose = false;
 
 int main(int argc, char* argv[]) {
     // Parse command line arguments
+    float physics_hz = 0.0f;  // 0 = physics default (60 Hz)
+    int script_lanes = 1;     // Lua states running vehicle scripts in parallel
+    int script_budget = 0;    // Lua instructions per script update (0 = unlimited)
+    int load_threads = -1;    // Startup loader workers (-1 = one per core, 0 = main thread only)
     for (int i = 1; i < argc; i++) {
         if (strcmp(argv[i], "--verbose") == 0 || strcmp(argv[i], "-v") == 0) {
             g_verbose = true;
+        } else if (strcmp(argv[i], "--log") == 0 && i + 1 < argc) {
+            log_parse_levels(argv[++i]);
+        } else if (strcmp(argv[i], "--physics-hz") == 0 && i + 1 < argc) {
+            physics_hz = (float)atof(argv[++i]);
+        } else if (strcmp(argv[i], "--script-lanes") == 0 && i + 1 < argc) {
+            script_lanes = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--script-budget") == 0 && i + 1 < argc) {
+            script_budget = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--load-threads") == 0 && i + 1 < argc) {
+            load_threads = atoi(argv[++i]);
         }
     }
+    log_init();
 
     printf("=== Arena ===\n");
     printf("Press F1 for controls help\n");
@@ -788,33 +986,17 @@ int main(int argc, char* argv[]) {
         return 1;
     }
 
-    // Load equipment data first (required for vehicle config parsing)
-    if (!equipment_load_all("../../assets/data/equipment")) {
-        fprintf(stderr, "Warning: Equipment data not loaded - using defaults\n");
-    }
-
-    // Load scene config
+    // Load equipment, scene, vehicle types, font and effects in parallel
+    config_cache_init("config_cache");  // Baked configs, kept between runs
     SceneJSON scene_config;
-    bool scene_ok = config_load_scene("../../assets/config/scenes/showdown.json", &scene_config);
-    if (!scene_ok) {
-        fprintf(stderr, "\n*** ERROR: Scene config failed to load! ***\n");
-        fprintf(stderr, "*** Check assets/config/scenes/showdown.json ***\n\n");
-    }
-
-    // Load all vehicle types from scene
-    bool vehicle_ok = false;
-    if (scene_ok) {
-        printf("\n=== Loading Vehicle Types ===\n");
-        for (int i = 0; i < scene_config.vehicle_count; i++) {
-            const char* type_name = scene_config.vehicles[i].type;
-            int type_idx = load_vehicle_type(type_name);
-            if (type_idx >= 0) {
-                vehicle_ok = true;  // At least one vehicle loaded
-            }
-        }
-        printf("=== Loaded %d vehicle type(s) ===\n\n", g_vehicle_type_count);
-    }
+    TextRenderer text_renderer;
+    StartupLoad startup;
+    startup_load(&startup, &scene_config, &text_renderer, load_threads);
+    bool scene_ok = startup.scene_ok;
+    bool has_text = startup.text_ok;
+    bool has_effects = startup.effects_ok;
 
+    bool vehicle_ok = g_vehicle_type_count > 0;  // At least one vehicle loaded
     if (!vehicle_ok) {
         fprintf(stderr, "\n*** ERROR: No vehicle configs loaded! ***\n");
         fprintf(stderr, "*** Arena will be empty - no vehicles! ***\n\n");
@@ -837,10 +1019,33 @@ int main(int argc, char* argv[]) {
         fprintf(stderr, "Failed to initialize physics\n");
         // Continue anyway, physics just won't work
     }
+    // Rendering interpolates between steps, so any rate looks smooth
+    if (physics_hz > 0.0f) {
+        physics.step_size = 1.0f / physics_hz;
+        printf("Physics rate: %.0f Hz\n", physics_hz);
+    }
+
+    // Ghost path: planned turn simulated on a forked world off the main thread
+    TurnPredictor* turn_predictor = turn_predictor_create();
+    TurnPrediction ghost_prediction;
+    bool has_ghost_prediction = false;
+    int ghost_generation = 0;
+    GhostPlan ghost_plan = {};          // Plan the last request was made for
+    bool has_ghost_plan = false;
+
+    // Quick-save slot for rewinding the world (F6 save, F7 rewind)
+    PhysicsSnapshot* rewind_snapshot = physics_snapshot_create();
+    bool has_rewind_snapshot = false;
 
     // Initialize Reflex Script Engine (Lua/Sol3)
     // Scripts are loaded per-vehicle in the vehicle creation loop below
-    ReflexScriptEngine* script_engine = reflex_create();
+    script_cache_init("script_cache");  // Compiled scripts, kept between runs
+    ReflexScriptEngine* script_engine = reflex_create_lanes(script_lanes);
+    reflex_set_script_budget(script_engine, script_budget);  // Before scripts attach
+
+    // Reload edited scripts as they are saved (F5 still reloads everything)
+    const char* script_dirs[] = { "../../assets/scripts", "../../assets/scripts/modules" };
+    ScriptWatcher* script_watcher = script_engine ? script_watcher_create(script_dirs, 2) : NULL;
 
     // Set up ground plane from scene config
     physics_set_ground(&physics, scene_config.arena.ground_y);
@@ -854,7 +1059,8 @@ int main(int argc, char* argv[]) {
         return 1;
     }
 
-    // Add arena walls to physics
+    // Add arena walls and obstacles to physics as one merged static body
+    physics_begin_static_batch(&physics);
     physics_add_arena_walls(&physics, scene_config.arena.size,
                             scene_config.arena.wall_height,
                             scene_config.arena.wall_thickness);
@@ -868,6 +1074,7 @@ int main(int argc, char* argv[]) {
             physics_add_box_obstacle(&physics, o->position, o->size);
         }
     }
+    physics_end_static_batch(&physics);
 
     // Create physics vehicles for each entity using per-vehicle type configs
     // Only if vehicle configs loaded successfully
@@ -909,9 +1116,15 @@ int main(int argc, char* argv[]) {
                             values[opt] = vs->options[opt].value;
                         }
 
-                        // Attach script with config (creates isolated instance for this vehicle)
-                        reflex_attach_script(script_engine, phys_id, vs->name, vs->path,
-                                             keys, values, vs->option_count);
+                        // Built-in C++ version if the JSON asks for it, otherwise
+                        // the Lua script (creates isolated instance for this vehicle)
+                        bool native = vs->native &&
+                                      reflex_attach_native_script(script_engine, phys_id, vs->name,
+                                                                  keys, values, vs->option_count);
+                        if (!native) {
+                            reflex_attach_script(script_engine, phys_id, vs->name, vs->path,
+                                                 keys, values, vs->option_count);
+                        }
                     }
                 }
 
@@ -927,9 +1140,7 @@ int main(int argc, char* argv[]) {
         // Continue anyway, just won't have UI
     }
 
-    // Initialize text renderer
-    TextRenderer text_renderer;
-    bool has_text = text_renderer_init(&text_renderer, "../../assets/fonts/Roboto-Bold.ttf", 18.0f);
+    // Text renderer was loaded with the startup assets
     if (!has_text) {
         fprintf(stderr, "Failed to initialize text renderer\n");
         // Continue anyway, just won't have text
@@ -952,11 +1163,12 @@ int main(int argc, char* argv[]) {
         ParticleEmitter* smoke;
         ParticleEmitter* explosion;
     } emitters = { &smoke_emitter, &explosion_emitter };
+    ParticleSpawnCallback spawn_script_particle = NULL;
 
     bool has_particles = particle_renderer_init(&particle_renderer);
     if (has_particles) {
-        // Load particle effects from JSON
-        if (!particle_effects_load("../../assets/data/effects/particles.json")) {
+        // Particle effects were loaded with the startup assets
+        if (!has_effects) {
             fprintf(stderr, "Warning: Failed to load particle effects, using hardcoded defaults\n");
         }
 
@@ -966,23 +1178,19 @@ int main(int argc, char* argv[]) {
             fprintf(stderr, "Warning: explosion effect not found\n");
         }
 
-        // Register particle spawn callback for Lua scripts
-        if (script_engine) {
-            reflex_set_particle_callback(script_engine,
-                [](const char* effect_name, float x, float y, float z, float intensity, void* user_data) {
-                    ParticleEmitters* em = (ParticleEmitters*)user_data;
-                    Vec3 pos = vec3(x, y, z);
-
-                    // Check which emitter matches the requested effect
-                    if (strcmp(em->smoke->effect.name, effect_name) == 0) {
-                        particle_emitter_spawn(em->smoke, pos, intensity);
-                    } else if (strcmp(em->explosion->effect.name, effect_name) == 0) {
-                        particle_emitter_spawn(em->explosion, pos, intensity);
-                    }
-                },
-                &emitters
-            );
-        }
+        // Particle spawns from Lua scripts: queued by the sim thread and
+        // delivered here once per frame (sim_thread_drain_particles)
+        spawn_script_particle = [](const char* effect_name, float x, float y, float z, float intensity, void* user_data) {
+            ParticleEmitters* em = (ParticleEmitters*)user_data;
+            Vec3 pos = vec3(x, y, z);
+
+            // Check which emitter matches the requested effect
+            if (strcmp(em->smoke->effect.name, effect_name) == 0) {
+                particle_emitter_spawn(em->smoke, pos, intensity);
+            } else if (strcmp(em->explosion->effect.name, effect_name) == 0) {
+                particle_emitter_spawn(em->explosion, pos, intensity);
+            }
+        };
     } else {
         fprintf(stderr, "Failed to initialize particle renderer\n");
     }
@@ -1009,6 +1217,7 @@ int main(int argc, char* argv[]) {
         .turn_executing = false,
         .turn_vehicle_id = -1
     };
+    uint32_t turn_end_serial = 0;   // SimFrame.turns_completed when the turn started
 
     // Debug flags
     bool show_cars = true;       // Toggle with 'H' key
@@ -1016,6 +1225,12 @@ int main(int argc, char* argv[]) {
     bool show_physics_debug = false;  // Toggle with 'P' key for physics shapes
     bool show_help = false;      // Toggle with 'F1' key for help overlay
 
+    // Script cost overlay (F9), refreshed from the sim thread every 30 frames
+    bool show_script_costs = false;
+    ScriptCostStats script_costs[32];
+    int script_cost_count = 0;
+    int script_cost_refresh = 0;
+
     // Chase camera mode (C to toggle) - spherical orbit around car
     bool chase_camera = false;
     float chase_distance = 10.0f;       // Distance from car (radius of orbit sphere)
@@ -1057,13 +1272,34 @@ int main(int argc, char* argv[]) {
     int frame_count = 0;
     double fps_timer = 0;
 
+    // From here on physics and scripts run on the sim thread. The loop reads
+    // published frames and talks to the world only through sim_thread_*.
+    SimThread* sim = sim_thread_create(&physics, script_engine);
+    if (!sim) {
+        fprintf(stderr, "Failed to start simulation thread\n");
+        return 1;
+    }
+    const SimFrame* frame = sim_thread_acquire_frame(sim);
+
+    // Blocking call on the sim thread; frame is refreshed to show its effects
+    auto sim_sync = [&](auto&& fn) {
+        sim_thread_run(sim, fn);
+        frame = sim_thread_acquire_frame(sim);
+    };
+
     // Main loop
+    PROFILE_THREAD_NAME("Main");
     while (!platform.should_quit) {
+        PROFILE_SCOPE("Frame");
+
         // Timing
         double current_time = platform_get_time();
         float dt = (float)(current_time - last_time);
         last_time = current_time;
 
+        // Latest simulation state (read-only for the rest of the frame)
+        frame = sim_thread_acquire_frame(sim);
+
         // FPS counter
         frame_count++;
         fps_timer += dt;
@@ -1078,6 +1314,7 @@ int main(int argc, char* argv[]) {
         }
 
         // Input
+        PROFILE_BEGIN("Input");
         platform_poll_events(&platform, &input);
 
         // Toggle mouse capture with middle click (for camera orbit/look)
@@ -1096,7 +1333,8 @@ int main(int argc, char* argv[]) {
                 if (input.keys_pressed[key_to_vehicle[v]]) {
                     // Find entity that maps to physics vehicle v
                     int target_phys_id = v;
-                    if (target_phys_id < physics.vehicle_count && physics.vehicles[target_phys_id].active) {
+                    const SimVehicleState* target = sim_frame_vehicle(frame, target_phys_id);
+                    if (target) {
                         // Find the entity with this physics id
                         for (int i = 0; i < entities.count; i++) {
                             Entity* e = &entities.entities[i];
@@ -1108,8 +1346,7 @@ int main(int argc, char* argv[]) {
                                 if (!chase_camera) {
                                     chase_camera = true;
                                     // Initialize chase camera from current position
-                                    Vec3 car_pos;
-                                    physics_vehicle_get_position(&physics, target_phys_id, &car_pos);
+                                    Vec3 car_pos = target->render_curr.position;
                                     Vec3 offset = vec3_sub(camera.position, car_pos);
                                     chase_distance = 10.0f;
                                     chase_azimuth = atan2f(offset.x, offset.z);
@@ -1154,6 +1391,44 @@ int main(int argc, char* argv[]) {
             show_help = !show_help;
         }
 
+        // Script cost overlay toggle
+        if (input.keys_pressed[KEY_F9]) {
+            show_script_costs = !show_script_costs;
+            script_cost_refresh = 0;
+        }
+        if (show_script_costs && script_cost_refresh-- <= 0) {
+            sim_sync([&](PhysicsWorld*, ReflexScriptEngine* engine) {
+                script_cost_count = reflex_get_script_stats(engine, script_costs, 32);
+            });
+            script_cost_refresh = 30;
+        }
+
+        // Script profiler: F10 starts sampling, F10 again writes the results
+        if (input.keys_pressed[KEY_F10]) {
+            bool was_running = script_profile_is_running();
+            bool started = false;
+            sim_sync([&](PhysicsWorld*, ReflexScriptEngine* engine) {
+                if (was_running) {
+                    reflex_profile_stop(engine);
+                } else {
+                    script_profile_reset();
+                    started = reflex_profile_start(engine, 0);
+                }
+            });
+
+            if (was_running) {
+                ScriptProfileStats prof = script_profile_get_stats();
+                bool written = script_profile_write_folded("script_profile.folded") &&
+                               script_profile_write_aborts("script_trace_aborts.txt");
+                printf("Script profile: %llu samples (%llu compiled), %u stacks, %u trace aborts%s\n",
+                       (unsigned long long)prof.samples, (unsigned long long)prof.compiled,
+                       prof.stacks, prof.trace_aborts,
+                       written ? " -> script_profile.folded, script_trace_aborts.txt" : " (write failed)");
+            } else {
+                printf(started ? "Script profiler started (F10 to stop)\n" : "Script profiler unavailable\n");
+            }
+        }
+
         // Quit on ESC
         if (input.keys_pressed[KEY_ESCAPE]) {
             platform.should_quit = true;
@@ -1182,7 +1457,9 @@ int main(int argc, char* argv[]) {
             Entity* sel = entity_manager_get_selected(&entities);
             if (sel && sel->id < MAX_ENTITIES && entity_to_physics[sel->id] >= 0) {
                 int phys_id = entity_to_physics[sel->id];
-                physics_vehicle_flip(&physics, phys_id);
+                sim_sync([&](PhysicsWorld* pw, ReflexScriptEngine*) {
+                    physics_vehicle_flip(pw, phys_id);
+                });
             } else {
                 printf("No vehicle selected to flip\n");
             }
@@ -1197,9 +1474,8 @@ int main(int argc, char* argv[]) {
 
                 // Initialize chase camera from current camera position
                 if (chase_camera) {
-                    int phys_id = entity_to_physics[sel->id];
-                    Vec3 car_pos;
-                    physics_vehicle_get_position(&physics, phys_id, &car_pos);
+                    const SimVehicleState* sv = sim_frame_vehicle(frame, entity_to_physics[sel->id]);
+                    Vec3 car_pos = sv ? sv->render_curr.position : sel->position;
 
                     // Calculate spherical coords from camera to car
                     Vec3 offset = vec3_sub(camera.position, car_pos);
@@ -1234,16 +1510,24 @@ int main(int argc, char* argv[]) {
             // Reload equipment first (suspension.json, tires.json, etc.)
             equipment_load_all("../../assets/data/equipment");
 
-            // Collect old spawn info and vehicle types before destroying
-            int old_count = physics.vehicle_count;
+            // Collect old spawn info and vehicle types before destroying (in id order,
+            // so recreation hands out the same ids)
+            int old_count = 0;
+            int old_ids[MAX_PHYSICS_VEHICLES];
             Vec3 spawn_positions[MAX_PHYSICS_VEHICLES];
             float spawn_rotations[MAX_PHYSICS_VEHICLES];
             int old_type_map[MAX_PHYSICS_VEHICLES];
-            for (int i = 0; i < old_count; i++) {
-                spawn_positions[i] = physics.vehicles[i].spawn_position;
-                spawn_rotations[i] = physics.vehicles[i].spawn_rotation;
-                old_type_map[i] = g_vehicle_type_map[i];
-            }
+            sim_sync([&](PhysicsWorld* pw, ReflexScriptEngine*) {
+                for (int id = 0; id < pw->vehicle_capacity; id++) {
+                    PhysicsVehicle* pv = physics_get_vehicle(pw, id);
+                    if (!pv) continue;
+                    old_ids[old_count] = id;
+                    spawn_positions[old_count] = pv->cold->spawn_position;
+                    spawn_rotations[old_count] = pv->cold->spawn_rotation;
+                    old_type_map[old_count] = g_vehicle_type_map[id];
+                    old_count++;
+                }
+            });
 
             // Reload all vehicle type configs (but don't reload meshes - they're already in GPU)
             bool reload_ok = true;
@@ -1283,47 +1567,98 @@ int main(int argc, char* argv[]) {
             }
 
             if (reload_ok) {
-                // Destroy all vehicles
-                for (int i = 0; i < old_count; i++) {
-                    if (physics.vehicles[i].active) {
-                        physics_destroy_vehicle(&physics, i);
+                sim_sync([&](PhysicsWorld* pw, ReflexScriptEngine*) {
+                    // Destroy all vehicles
+                    for (int i = 0; i < old_count; i++) {
+                        physics_destroy_vehicle(pw, old_ids[i]);
                     }
-                }
-                physics.vehicle_count = 0;
 
-                // Recreate all vehicles with their correct type configs
-                for (int i = 0; i < old_count; i++) {
-                    int type_idx = old_type_map[i];
-                    VehicleJSON* vconfig = &g_vehicle_configs[type_idx];
-                    VehicleConfig vehicle_cfg = config_vehicle_to_physics(vconfig);
+                    // Recreate all vehicles with their correct type configs
+                    for (int i = 0; i < old_count; i++) {
+                        int type_idx = old_type_map[i];
+                        VehicleJSON* vconfig = &g_vehicle_configs[type_idx];
+                        VehicleConfig vehicle_cfg = config_vehicle_to_physics(vconfig);
 
-                    int phys_id = physics_create_vehicle(&physics, spawn_positions[i], spawn_rotations[i], &vehicle_cfg);
-                    g_vehicle_type_map[phys_id] = type_idx;
-                }
-                printf("All %d vehicles recreated with reloaded configs\n", old_count);
+                        int phys_id = physics_create_vehicle(pw, spawn_positions[i], spawn_rotations[i], &vehicle_cfg);
+                        if (phys_id >= 0) g_vehicle_type_map[phys_id] = type_idx;
+                    }
 
-                // Unpause physics so vehicles can settle
-                if (physics_is_paused(&physics)) {
-                    physics_unpause(&physics);
-                }
+                    // Unpause physics so vehicles can settle
+                    if (physics_is_paused(pw)) {
+                        physics_unpause(pw);
+                    }
+                });
+                printf("All %d vehicles recreated with reloaded configs\n", old_count);
+                has_rewind_snapshot = false;  // Bodies were rebuilt, old snapshot no longer fits
             } else {
                 fprintf(stderr, "RELOAD FAILED: Some configs have errors - keeping current vehicles\n");
             }
         }
 
+        // World snapshot: F6 = save, F7 = rewind to the saved state
+        if (input.keys_pressed[KEY_F6]) {
+            sim_sync([&](PhysicsWorld* pw, ReflexScriptEngine*) {
+                has_rewind_snapshot = physics_save_state(pw, rewind_snapshot);
+            });
+            printf(has_rewind_snapshot ? "World state saved (F7 to rewind)\n" : "World state save failed\n");
+        }
+        if (input.keys_pressed[KEY_F7]) {
+            bool rewound = false;
+            if (!has_rewind_snapshot) {
+                printf("No saved world state (F6 to save)\n");
+            } else {
+                sim_sync([&](PhysicsWorld* pw, ReflexScriptEngine*) {
+                    rewound = physics_restore_state(pw, rewind_snapshot);
+                });
+            }
+            if (rewound) {
+                printf("World state rewound\n");
+                has_ghost_plan = false;  // Re-predict from the rewound state
+            }
+        }
+
+#if ARENA_PROFILE
+        // Write the profiler's recent spans (open in chrome://tracing)
+        if (input.keys_pressed[KEY_F8]) {
+            profiler_dump_chrome_trace("carwars_trace.json");
+        }
+#endif
+
         // Reload scene config with L
         if (input.keys_pressed[KEY_L]) {
             printf("Reloading scene config...\n");
+            config_free_scene(&scene_config);
             config_load_scene("../../assets/config/scenes/showdown.json", &scene_config);
             printf("Scene config reloaded (arena/obstacles - restart for full effect)\n");
         }
 
+        // Reload just the scripts that depend on files saved since last frame
+        char changed_files[16][SCRIPT_WATCH_PATH_MAX];
+        int changed_count = script_watcher_poll(script_watcher, changed_files, 16);
+        if (changed_count > 0) {
+            const char* changed_paths[16];
+            for (int i = 0; i < changed_count; i++) changed_paths[i] = changed_files[i];
+
+            int count = -1;
+            sim_sync([&](PhysicsWorld*, ReflexScriptEngine* engine) {
+                count = reflex_reload_changed(engine, changed_paths, changed_count);
+            });
+            if (count > 0) {
+                printf("Hot reload: %d script instance(s) from %d changed file(s)\n", count, changed_count);
+            }
+        }
+
         // Reload scripts with F5 (hot reload for development)
         if (input.keys_pressed[KEY_F5]) {
             printf("Reloading scripts...\n");
-            int count = reflex_reload_all_scripts(script_engine);
+            int count = -1;
+            sim_sync([&](PhysicsWorld*, ReflexScriptEngine* engine) {
+                count = reflex_reload_all_scripts(engine);
+            });
             if (count >= 0) {
-                printf("Scripts reloaded: %d vehicle scripts\n", count);
+                ScriptCacheStats cache = script_cache_get_stats();
+                printf("Scripts reloaded: %d vehicle scripts (%u compiled, %u cached so far)\n",
+                       count, cache.compiled, cache.memory_hits + cache.disk_hits);
             } else {
                 printf("Script reload failed!\n");
             }
@@ -1333,7 +1668,10 @@ int main(int argc, char* argv[]) {
         if (input.keys_pressed[KEY_T]) {
             Entity* sel = entity_manager_get_selected(&entities);
             if (sel && sel->id < MAX_ENTITIES && entity_to_physics[sel->id] >= 0) {
-                physics_vehicle_start_accel_test(&physics, entity_to_physics[sel->id]);
+                int phys_id = entity_to_physics[sel->id];
+                sim_sync([&](PhysicsWorld* pw, ReflexScriptEngine*) {
+                    physics_vehicle_start_accel_test(pw, phys_id);
+                });
             } else {
                 printf("Select a vehicle first (T)\n");
             }
@@ -1346,7 +1684,16 @@ int main(int argc, char* argv[]) {
             if (sel && sel->id < MAX_ENTITIES && entity_to_physics[sel->id] >= 0) {
                 selected_vehicle_id = entity_to_physics[sel->id];
             }
-            reflex_on_input(script_engine, input.keys_pressed, 512, selected_vehicle_id);
+            // Scripts ignore frames without a key press, so skip the round trip
+            bool any_pressed = false;
+            for (int k = 0; k < 512 && !any_pressed; k++) {
+                any_pressed = input.keys_pressed[k];
+            }
+            if (any_pressed) {
+                sim_sync([&](PhysicsWorld*, ReflexScriptEngine* engine) {
+                    reflex_on_input(engine, input.keys_pressed, 512, selected_vehicle_id);
+                });
+            }
         }
 
         // Cruise control: V = toggle cruise (hold current speed or cancel)
@@ -1354,11 +1701,13 @@ int main(int argc, char* argv[]) {
             Entity* sel = entity_manager_get_selected(&entities);
             if (sel && sel->id < MAX_ENTITIES && entity_to_physics[sel->id] >= 0) {
                 int phys_id = entity_to_physics[sel->id];
-                if (physics_vehicle_cruise_active(&physics, phys_id)) {
-                    physics_vehicle_cruise_cancel(&physics, phys_id);
-                } else {
-                    physics_vehicle_cruise_hold(&physics, phys_id);
-                }
+                sim_sync([&](PhysicsWorld* pw, ReflexScriptEngine*) {
+                    if (physics_vehicle_cruise_active(pw, phys_id)) {
+                        physics_vehicle_cruise_cancel(pw, phys_id);
+                    } else {
+                        physics_vehicle_cruise_hold(pw, phys_id);
+                    }
+                });
             } else {
                 printf("Select a vehicle first (V)\n");
             }
@@ -1368,7 +1717,10 @@ int main(int argc, char* argv[]) {
         if (input.keys_pressed[KEY_RIGHTBRACKET]) {
             Entity* sel = entity_manager_get_selected(&entities);
             if (sel && sel->id < MAX_ENTITIES && entity_to_physics[sel->id] >= 0) {
-                physics_vehicle_cruise_snap_up(&physics, entity_to_physics[sel->id]);
+                int phys_id = entity_to_physics[sel->id];
+                sim_sync([&](PhysicsWorld* pw, ReflexScriptEngine*) {
+                    physics_vehicle_cruise_snap_up(pw, phys_id);
+                });
             } else {
                 printf("Select a vehicle first (])\n");
             }
@@ -1378,7 +1730,10 @@ int main(int argc, char* argv[]) {
         if (input.keys_pressed[KEY_LEFTBRACKET]) {
             Entity* sel = entity_manager_get_selected(&entities);
             if (sel && sel->id < MAX_ENTITIES && entity_to_physics[sel->id] >= 0) {
-                physics_vehicle_cruise_snap_down(&physics, entity_to_physics[sel->id]);
+                int phys_id = entity_to_physics[sel->id];
+                sim_sync([&](PhysicsWorld* pw, ReflexScriptEngine*) {
+                    physics_vehicle_cruise_snap_down(pw, phys_id);
+                });
             } else {
                 printf("Select a vehicle first ([)\n");
             }
@@ -1389,10 +1744,10 @@ int main(int argc, char* argv[]) {
 #if TURN_MODE_ENABLED
         // When pausing: snapshot speed and calculate active phases for turn declaration
         if (input.keys_pressed[KEY_TAB]) {
-            if (physics_is_paused(&physics)) {
-                physics_unpause(&physics);
+            if (frame->paused) {
+                sim_sync([](PhysicsWorld* pw, ReflexScriptEngine*) { physics_unpause(pw); });
             } else {
-                physics_pause(&physics);
+                sim_sync([](PhysicsWorld* pw, ReflexScriptEngine*) { physics_pause(pw); });
 #else
         // Turn mode disabled - TAB does nothing
         if (false && input.keys_pressed[KEY_TAB]) {
@@ -1407,8 +1762,8 @@ int main(int argc, char* argv[]) {
 
                 if (pause_phys_id >= 0) {
                     // Get current speed in m/s and convert to mph
-                    float vel_ms = 0.0f;
-                    physics_vehicle_get_velocity(&physics, pause_phys_id, &vel_ms);
+                    const SimVehicleState* pv = sim_frame_vehicle(frame, pause_phys_id);
+                    float vel_ms = pv ? pv->speed_ms : 0.0f;
                     planning.snapshot_speed = (int)(fabsf(vel_ms) * 2.237f);  // m/s to mph
 
                     // Reset maneuver for new turn
@@ -1424,12 +1779,14 @@ int main(int argc, char* argv[]) {
         // ========== MANEUVER CANCEL KEY ==========
         // Key 0 = cancel maneuver (kept for emergency abort)
         // Direct maneuver keys 1-9 removed - use GUI declaration instead
-        if (physics_is_paused(&physics) && input.keys_pressed[KEY_0]) {
+        if (frame->paused && input.keys_pressed[KEY_0]) {
             Entity* sel_for_cancel = entity_manager_get_selected(&entities);
             int cancel_phys_id = (sel_for_cancel && sel_for_cancel->id < MAX_ENTITIES)
                               ? entity_to_physics[sel_for_cancel->id] : -1;
             if (cancel_phys_id >= 0) {
-                physics_vehicle_cancel_maneuver(&physics, cancel_phys_id);
+                sim_sync([&](PhysicsWorld* pw, ReflexScriptEngine*) {
+                    physics_vehicle_cancel_maneuver(pw, cancel_phys_id);
+                });
             }
         }
 
@@ -1461,7 +1818,7 @@ int main(int argc, char* argv[]) {
 
             // Maneuver selector click handling (only when paused AND not at 0 mph)
             // At 0 mph, only STRAIGHT is allowed (no maneuver selection)
-            bool can_edit_maneuver = physics_is_paused(&physics) && !at_stop;
+            bool can_edit_maneuver = frame->paused && !at_stop;
 
             if (can_edit_maneuver && !ui_clicked) {
                 // Row 1: Maneuver type buttons (5 buttons: STR, DFT, STP, BND, SWV)
@@ -1517,7 +1874,7 @@ int main(int argc, char* argv[]) {
 
             // Check Execute button click (moved down to Y=465)
             UIRect execute_btn = ui_rect(platform.width - 315, 465, 300, 50);
-            if (point_in_rect(mx, my, execute_btn) && physics_is_paused(&physics)) {
+            if (point_in_rect(mx, my, execute_btn) && frame->paused) {
                 Entity* selected = entity_manager_get_selected(&entities);
                 int exec_phys_id = (selected && selected->id < MAX_ENTITIES)
                                    ? entity_to_physics[selected->id] : -1;
@@ -1539,7 +1896,8 @@ int main(int argc, char* argv[]) {
                     }
 
                     // Check if cruise was active before executing
-                    bool cruise_was_active = physics_vehicle_cruise_active(&physics, exec_phys_id);
+                    const SimVehicleState* exec_v = sim_frame_vehicle(frame, exec_phys_id);
+                    bool cruise_was_active = exec_v && exec_v->cruise_active;
 
                     // Calculate target speed
                     int target_speed_mph = calculate_next_speed(planning.snapshot_speed, planning.speed_choice);
@@ -1559,20 +1917,25 @@ int main(int argc, char* argv[]) {
                     reflex_event_data_add_string(&event_data, "speed_change", speed_change_names[planning.speed_choice]);
                     reflex_event_data_add_float(&event_data, "target_speed", (float)target_speed_mph);
 
-                    reflex_send_event(script_engine, exec_phys_id, "execute_maneuver", &event_data);
-
-                    // Apply speed change via cruise control
                     bool should_set_cruise = (planning.speed_choice != SPEED_HOLD) || cruise_was_active;
-                    if (should_set_cruise) {
-                        float target_speed_ms = target_speed_mph / 2.237f;  // mph to m/s
-                        physics_vehicle_cruise_set(&physics, exec_phys_id, target_speed_ms);
-                    }
+                    sim_sync([&](PhysicsWorld* pw, ReflexScriptEngine* engine) {
+                        reflex_send_event(engine, exec_phys_id, "execute_maneuver", &event_data);
 
-                    physics_unpause(&physics);
+                        // Apply speed change via cruise control
+                        if (should_set_cruise) {
+                            float target_speed_ms = target_speed_mph / 2.237f;  // mph to m/s
+                            physics_vehicle_cruise_set(pw, exec_phys_id, target_speed_ms);
+                        }
+
+                        physics_unpause(pw);
+                    });
 
-                    // Track that a turn is executing
+                    // Track that a turn is executing; the sim thread re-pauses
+                    // in the step the script reports the turn finished
                     planning.turn_executing = true;
                     planning.turn_vehicle_id = exec_phys_id;
+                    turn_end_serial = frame->turns_completed;
+                    sim_thread_pause_after_turn(sim, exec_phys_id);
 
                     // Log what we're executing
                     const char* speed_names[] = {"BRAKE", "HOLD", "ACCEL"};
@@ -1623,7 +1986,7 @@ int main(int argc, char* argv[]) {
         }
 
         // Apply vehicle controls only in freestyle mode (not paused)
-        if (!physics_is_paused(&physics)) {
+        if (!frame->paused) {
             Entity* selected = entity_manager_get_selected(&entities);
             if (selected && selected->id < MAX_ENTITIES) {
                 int phys_id = entity_to_physics[selected->id];
@@ -1701,30 +2064,89 @@ int main(int argc, char* argv[]) {
                     }
                     if (input.keys[KEY_SPACE]) brake = 1.0f;
 
-                    // Apply controls to physics vehicle
-                    physics_vehicle_set_throttle(&physics, phys_id, throttle);
-                    physics_vehicle_set_reverse(&physics, phys_id, reverse);
-                    physics_vehicle_set_brake(&physics, phys_id, brake);
-                    physics_vehicle_set_steering(&physics, phys_id, current_steering);
+                    // Queue controls for the next physics step
+                    sim_thread_set_controls(sim, phys_id, throttle, reverse, brake, current_steering);
                 }
             }
         }
 
-        // Update reflex scripts (ABS, traction control, AI)
-        // Scripts run before physics so they can modify controls
-        if (script_engine) {
-            for (int i = 0; i < physics.vehicle_count; i++) {
-                if (physics.vehicles[i].active) {
-                    reflex_update_vehicle(script_engine, &physics, i, dt);
+        PROFILE_END();  // Input
+
+        // ========== GHOST PATH PREDICTION ==========
+        // While planning (paused), re-predict whenever the declared turn changes
+        {
+            PROFILE_SCOPE("TurnPredictor.Request");
+            Entity* ghost_sel = entity_manager_get_selected(&entities);
+            int ghost_phys_id = (ghost_sel && ghost_sel->id < MAX_ENTITIES)
+                                ? entity_to_physics[ghost_sel->id] : -1;
+
+            if (frame->paused && !planning.turn_executing && ghost_phys_id >= 0) {
+                ManeuverType ghost_type = planning.maneuver;
+                if (planning.snapshot_speed < 5 || ghost_type == MANEUVER_NONE) {
+                    ghost_type = MANEUVER_STRAIGHT;
+                }
+                GhostPlan plan;
+                plan.vehicle_id = ghost_phys_id;
+                plan.type = ghost_type;
+                plan.direction = planning.direction;
+                plan.bend_angle = planning.bend_angle;
+                plan.speed_choice = planning.speed_choice;
+                plan.snapshot_speed = planning.snapshot_speed;
+
+                if (!has_ghost_plan || !ghost_plan_equal(&plan, &ghost_plan)) {
+                    // One declared maneuver per turn, in the first active phase
+                    int phases = get_active_phases(planning.snapshot_speed);
+                    int phase_index = 0;
+                    while (phase_index < 4 && !(phases & (1 << phase_index))) phase_index++;
+
+                    ManeuverRequest ghost_req = {};
+                    ghost_req.type = ghost_type;
+                    ghost_req.direction = planning.direction;
+                    ghost_req.bend_angle = planning.bend_angle;
+
+                    int target_mph = calculate_next_speed(planning.snapshot_speed, planning.speed_choice);
+                    if (target_mph < 0) target_mph = 0;
+                    const SimVehicleState* ghost_v = sim_frame_vehicle(frame, ghost_phys_id);
+                    bool sets_cruise = (planning.speed_choice != SPEED_HOLD) ||
+                                       (ghost_v && ghost_v->cruise_active);
+                    float cruise_ms = sets_cruise ? target_mph / 2.237f : -1.0f;
+
+                    // The fork is captured on the sim thread, which owns the world
+                    sim_sync([&](PhysicsWorld* pw, ReflexScriptEngine*) {
+                        turn_predictor_request(turn_predictor, pw, ghost_phys_id,
+                                               &phase_index, &ghost_req, 1, cruise_ms, 1.0f);
+                    });
+                    ghost_plan = plan;
+                    has_ghost_plan = true;
+                }
+
+                if (turn_predictor_poll(turn_predictor, ghost_generation, &ghost_prediction)) {
+                    ghost_generation = ghost_prediction.generation;
+                    has_ghost_prediction = true;
+                    if (debug_ghost) {
+                        printf("[Ghost] v%d %s: end (%.2f, %.2f) heading %.1f deg, %.1f mph, HS %d\n",
+                               ghost_prediction.vehicle_id, ghost_prediction.accepted ? "ok" : "REJECTED",
+                               ghost_prediction.final_position.x, ghost_prediction.final_position.z,
+                               ghost_prediction.final_heading * 57.2958f,
+                               ghost_prediction.final_speed_ms * 2.237f,
+                               ghost_prediction.final_handling_status);
+                    }
                 }
+            } else if (has_ghost_plan) {
+                turn_predictor_clear(turn_predictor);
+                has_ghost_prediction = false;
+                has_ghost_plan = false;
             }
         }
 
-        // Always step physics simulation (gravity, collisions, etc. always active)
-        physics_step(&physics, dt);
+        // Reflex scripts and physics steps run on the sim thread (sim_thread.h)
+
+        // Particles requested by scripts since the last frame
+        sim_thread_drain_particles(sim, has_particles ? spawn_script_particle : NULL, &emitters);
 
         // Update particle systems
         if (has_particles) {
+            PROFILE_SCOPE("Particles");
             particle_emitter_update(&smoke_emitter, dt);
             particle_emitter_update(&explosion_emitter, dt);
 
@@ -1733,16 +2155,13 @@ int main(int argc, char* argv[]) {
             float slip_thresh = smoke_emitter.effect.slip_threshold;
 
             // Spawn smoke at all vehicles' rear wheels when slipping
-            for (int v = 0; v < physics.vehicle_count; v++) {
-                if (!physics.vehicles[v].active) continue;
+            for (int n = 0; n < frame->vehicle_count; n++) {
+                const SimVehicleState* sv = &frame->vehicles[n];
 
                 // Only spawn smoke if car is moving
-                float velocity = 0.0f;
-                physics_vehicle_get_velocity(&physics, v, &velocity);
-                if (fabsf(velocity) < min_vel) continue;
+                if (fabsf(sv->speed_ms) < min_vel) continue;
 
-                WheelState ws[4];
-                physics_vehicle_get_wheel_states(&physics, v, ws);
+                const WheelState* ws = sv->wheels;
 
                 // Spawn at rear wheels (indices 2 and 3) when slipping
                 for (int w = 2; w < 4; w++) {
@@ -1765,19 +2184,15 @@ int main(int argc, char* argv[]) {
             }
         }
 
-        // Check if GUI-triggered turn has completed and re-pause physics
+        // Check if GUI-triggered turn has completed (the sim thread has already
+        // paused physics for the next turn declaration)
         if (planning.turn_executing && planning.turn_vehicle_id >= 0) {
-            // Poll Lua to check if turn is still active
-            bool turn_still_active = reflex_is_turn_active(script_engine, planning.turn_vehicle_id);
-
-            if (!turn_still_active) {
-                // Turn completed - pause physics for next turn declaration
-                physics_pause(&physics);
+            if (frame->turns_completed != turn_end_serial) {
                 planning.turn_executing = false;
 
                 // Get current speed for next turn snapshot
-                float vel_ms = 0.0f;
-                physics_vehicle_get_velocity(&physics, planning.turn_vehicle_id, &vel_ms);
+                const SimVehicleState* tv = sim_frame_vehicle(frame, planning.turn_vehicle_id);
+                float vel_ms = tv ? tv->speed_ms : 0.0f;
                 planning.snapshot_speed = (int)(fabsf(vel_ms) * 2.237f);
 
                 // Reset maneuver for next turn
@@ -1797,7 +2212,10 @@ int main(int argc, char* argv[]) {
             // Check for turn completion
             if (scripted_turn.elapsed >= scripted_turn.duration) {
                 // End the turn and get result
-                ManeuverResult result = reflex_end_turn(script_engine, scripted_turn.vehicle_id);
+                ManeuverResult result = {};
+                sim_sync([&](PhysicsWorld*, ReflexScriptEngine* engine) {
+                    result = reflex_end_turn(engine, scripted_turn.vehicle_id);
+                });
 
                 printf("[Turn] Completed: %s %s\n", scripted_turn.maneuver, scripted_turn.direction);
                 printf("[Turn] Result: %s (success=%s)\n",
@@ -1817,30 +2235,21 @@ int main(int argc, char* argv[]) {
             Entity* e = &entities.entities[i];
             if (!e->active || e->type != ENTITY_VEHICLE) continue;
 
-            int phys_id = entity_to_physics[e->id];
-            if (phys_id >= 0) {
-                Vec3 pos;
-                float rot_y;
-                physics_vehicle_get_position(&physics, phys_id, &pos);
-                physics_vehicle_get_rotation(&physics, phys_id, &rot_y);
-                e->position = pos;
-                e->rotation_y = rot_y;
+            const SimVehicleState* sv = sim_frame_vehicle(frame, entity_to_physics[e->id]);
+            if (sv) {
+                e->position = sv->render_curr.position;
+                e->rotation_y = sv->heading;
 
                 // Store velocity for display
                 // During kinematic maneuver, interpolate between start and target speed
                 float speed_ms;
-                if (physics_vehicle_maneuver_active(&physics, phys_id)) {
-                    const ManeuverAutopilot* ap = physics_vehicle_get_autopilot(&physics, phys_id);
-                    if (ap) {
-                        // Interpolate speed during turn (ACCEL/BRAKE changes speed during turn)
-                        float start = ap->start_speed_ms;
-                        float target = ap->target_speed_ms > 0.0f ? ap->target_speed_ms : start;
-                        speed_ms = start + (target - start) * ap->progress;
-                    } else {
-                        speed_ms = 0.0f;
-                    }
+                if (sv->maneuver_active) {
+                    // Interpolate speed during turn (ACCEL/BRAKE changes speed during turn)
+                    float start = sv->maneuver_start_speed_ms;
+                    float target = sv->maneuver_target_speed_ms > 0.0f ? sv->maneuver_target_speed_ms : start;
+                    speed_ms = start + (target - start) * sv->maneuver_progress;
                 } else {
-                    physics_vehicle_get_velocity(&physics, phys_id, &speed_ms);
+                    speed_ms = sv->speed_ms;
                 }
                 if (e->id < MAX_ENTITIES) {
                     car_physics[e->id].velocity = speed_ms;
@@ -1848,6 +2257,9 @@ int main(int argc, char* argv[]) {
             }
         }
 
+        // How far the renderer is between the frame's last two physics steps
+        float render_alpha = sim_thread_render_alpha(sim, frame);
+
         // Chase camera: spherical orbit around selected vehicle
         if (chase_camera) {
             Entity* sel = entity_manager_get_selected(&entities);
@@ -1885,9 +2297,9 @@ int main(int argc, char* argv[]) {
                         if (chase_distance > 100.0f) chase_distance = 100.0f;
                     }
 
-                    // Get car position directly (no smoothing needed with orbit control)
-                    Vec3 car_pos;
-                    physics_vehicle_get_position(&physics, phys_id, &car_pos);
+                    // Follow the interpolated car position so the camera moves with what is drawn
+                    Vec3 car_pos = sel->position;
+                    sim_vehicle_render_transform(sim_frame_vehicle(frame, phys_id), render_alpha, &car_pos, NULL);
 
                     // Spherical coordinates: camera orbits on a sphere around the car
                     // elevation=0 is level, elevation=PI/2 is directly overhead
@@ -1925,6 +2337,7 @@ int main(int argc, char* argv[]) {
         floor_render(&arena_floor, &view, &projection, camera.position);
 
         // Draw walls, obstacles, ramps, and cars with lighting
+        PROFILE_BEGIN("Render.Boxes");
         box_renderer_begin(&box_renderer, &view, &projection, light_dir);
         draw_arena_walls(&box_renderer, &scene_config.arena);
         draw_obstacles(&box_renderer, &scene_config);
@@ -1950,14 +2363,15 @@ int main(int argc, char* argv[]) {
             }
 
             // Render physics vehicles as solid primitives (physics-first approach)
-            draw_physics_vehicles(&box_renderer, &physics, selected_phys_id, team_for_vehicle);
+            draw_physics_vehicles(&box_renderer, frame, render_alpha, selected_phys_id, team_for_vehicle);
 
             // Draw wheel meshes at physics wheel positions (if any mesh loaded)
             if (g_vehicle_type_count > 0) {
-                draw_vehicle_wheels_mesh(&box_renderer, &physics);
+                draw_vehicle_wheels_mesh(&box_renderer, frame, render_alpha);
             }
         }
         box_renderer_end(&box_renderer);
+        PROFILE_END();  // Render.Boxes
 
         // Draw particles (after solid geometry, before lines/UI)
         if (has_particles) {
@@ -1977,18 +2391,32 @@ int main(int argc, char* argv[]) {
 
             // Draw wheels with rotating spokes (only if no meshes loaded - fallback)
             if (show_cars && g_vehicle_type_count == 0) {
-                draw_vehicle_wheels(&line_renderer, &physics);
+                draw_vehicle_wheels(&line_renderer, frame, render_alpha);
             }
 
             // Physics debug visualization (press P to toggle)
             if (show_physics_debug) {
-                physics_debug_draw(&physics, &line_renderer);
+                physics_debug_draw(frame, render_alpha, &line_renderer);
+            }
+
+            // Ghost path of the planned turn (predicted trajectory + final pose)
+            if (has_ghost_prediction && ghost_prediction.point_count > 1) {
+                Vec3 ghost_color = ghost_prediction.accepted ? vec3(0.3f, 0.9f, 1.0f) : vec3(1.0f, 0.3f, 0.3f);
+                for (int p = 1; p < ghost_prediction.point_count; p++) {
+                    line_renderer_draw_line(&line_renderer, ghost_prediction.points[p - 1],
+                                            ghost_prediction.points[p], ghost_color, 1.0f);
+                }
+                Vec3 end = ghost_prediction.final_position;
+                Vec3 tip = vec3(end.x + sinf(ghost_prediction.final_heading) * 1.5f, end.y,
+                                end.z + cosf(ghost_prediction.final_heading) * 1.5f);
+                line_renderer_draw_line(&line_renderer, end, tip, ghost_color, 1.0f);
             }
 
             line_renderer_end(&line_renderer);
         }
 
         // Draw UI test panels
+        PROFILE_BEGIN("UI");
         ui_renderer_begin(&ui_renderer, platform.width, platform.height);
 
         // Right side panel (where controls will go)
@@ -2003,7 +2431,7 @@ int main(int argc, char* argv[]) {
 
         // Speed control section
         // In freestyle mode, show controls as disabled
-        bool turn_mode = physics_is_paused(&physics);
+        bool turn_mode = frame->paused;
         UIColor section_border = turn_mode ? ui_color(0.3f, 0.3f, 0.4f, 1.0f) : ui_color(0.2f, 0.2f, 0.25f, 1.0f);
 
         ui_draw_panel(&ui_renderer,
@@ -2041,7 +2469,7 @@ int main(int argc, char* argv[]) {
         // Maneuver selector (only when physics paused AND not at 0 mph)
         // At 0 mph, only STRAIGHT is allowed (starting from stop)
         bool at_stop_for_selector = (planning.snapshot_speed < 5);
-        bool show_maneuver_selector = physics_is_paused(&physics) && !at_stop_for_selector;
+        bool show_maneuver_selector = frame->paused && !at_stop_for_selector;
 
         if (show_maneuver_selector) {
             // Row 1: Maneuver type buttons (5 buttons: STR, DFT, STP, BND, SWV)
@@ -2119,15 +2547,14 @@ int main(int argc, char* argv[]) {
 
         if (hud_sel && hud_sel->id < MAX_ENTITIES) {
             hud_phys_id = entity_to_physics[hud_sel->id];
-            if (hud_phys_id >= 0 && physics.vehicles[hud_phys_id].active) {
-                hud_throttle = physics.vehicles[hud_phys_id].throttle;
-                hud_brake = physics.vehicles[hud_phys_id].brake;
+            const SimVehicleState* hud_v = sim_frame_vehicle(frame, hud_phys_id);
+            if (hud_v) {
+                hud_throttle = hud_v->throttle;
+                hud_brake = hud_v->brake;
 
                 // Get wheel slip
-                WheelState ws[4];
-                physics_vehicle_get_wheel_states(&physics, hud_phys_id, ws);
                 for (int w = 0; w < 4; w++) {
-                    hud_slip[w] = fabsf(ws[w].longitudinal_slip);
+                    hud_slip[w] = fabsf(hud_v->wheels[w].longitudinal_slip);
                     if (hud_slip[w] > 1.0f) hud_slip[w] = 1.0f;
                 }
 
@@ -2135,9 +2562,8 @@ int main(int argc, char* argv[]) {
                 hud_speed_mph = fabsf(car_physics[hud_sel->id].velocity) * 2.237f;
 
                 // Get RPM and gear
-                int raw_gear = 0;
-                bool is_matchbox = false;
-                physics_vehicle_get_drivetrain_info(&physics, hud_phys_id, &hud_gear, &hud_rpm, &raw_gear, &is_matchbox);
+                hud_gear = hud_v->gear;
+                hud_rpm = hud_v->rpm;
             }
         }
 
@@ -2228,7 +2654,7 @@ int main(int argc, char* argv[]) {
             text_renderer_begin(&text_renderer, platform.width, platform.height);
 
             // Header text (changes based on mode)
-            const char* header_text = !physics_is_paused(&physics) ? "FREESTYLE MODE" : "TURN PLANNING";
+            const char* header_text = !frame->paused ? "FREESTYLE MODE" : "TURN PLANNING";
             text_draw_centered(&text_renderer, header_text,
                 ui_rect(platform.width - 315, 15, 300, 40), UI_COLOR_WHITE);
 
@@ -2251,7 +2677,7 @@ int main(int argc, char* argv[]) {
             // Maneuver section label with snapshot speed
             {
                 char maneuver_label[64];
-                if (physics_is_paused(&physics) && planning.snapshot_speed > 0) {
+                if (frame->paused && planning.snapshot_speed > 0) {
                     snprintf(maneuver_label, sizeof(maneuver_label), "MANEUVER (%d mph)", planning.snapshot_speed);
                 } else {
                     snprintf(maneuver_label, sizeof(maneuver_label), "MANEUVER");
@@ -2261,7 +2687,7 @@ int main(int argc, char* argv[]) {
 
             // Maneuver selector labels (only when paused, not at 0 mph)
             bool at_stop_labels = (planning.snapshot_speed < 5);
-            bool show_selector_labels = physics_is_paused(&physics) && !at_stop_labels;
+            bool show_selector_labels = frame->paused && !at_stop_labels;
 
             if (show_selector_labels) {
                 // Row 1: Maneuver type button labels (5 buttons)
@@ -2380,16 +2806,18 @@ int main(int argc, char* argv[]) {
                 }
                 int display_mph = (int)(fabsf(vel) * 2.237f);
 
+                const SimVehicleState* status_v = sim_frame_vehicle(frame, phys_id);
                 int hs = 0, hc = 0;
-                if (phys_id >= 0) {
-                    physics_vehicle_get_handling(&physics, phys_id, &hs, &hc);
+                if (status_v) {
+                    hs = status_v->handling_status;
+                    hc = status_v->handling_class;
                 }
 
                 // ===== ROW 1: Common info =====
                 // Mode indicator
-                const char* mode_label = physics_is_paused(&physics) ? "TURN MODE" : "FREE MODE";
+                const char* mode_label = frame->paused ? "TURN MODE" : "FREE MODE";
                 text_draw(&text_renderer, mode_label, col1, row1_y,
-                          physics_is_paused(&physics) ? UI_COLOR_CAUTION : UI_COLOR_SAFE);
+                          frame->paused ? UI_COLOR_CAUTION : UI_COLOR_SAFE);
 
                 // Vehicle
                 text_draw(&text_renderer, team_name, col2, row1_y, UI_COLOR_WHITE);
@@ -2399,11 +2827,11 @@ int main(int argc, char* argv[]) {
                 text_draw(&text_renderer, col_buf, col3, row1_y, UI_COLOR_WHITE);
 
                 // Target/Action (mode-dependent but same position)
-                if (!physics_is_paused(&physics)) {
+                if (!frame->paused) {
                     // Freestyle: show cruise target
-                    bool cruise_on = phys_id >= 0 && physics_vehicle_cruise_active(&physics, phys_id);
+                    bool cruise_on = status_v && status_v->cruise_active;
                     if (cruise_on) {
-                        float target_ms = physics_vehicle_cruise_target(&physics, phys_id);
+                        float target_ms = status_v->cruise_target_ms;
                         int target_mph = (int)(target_ms * 2.237f);
                         snprintf(col_buf, sizeof(col_buf), "Cruise: %d mph", target_mph);
                         text_draw(&text_renderer, col_buf, col4, row1_y, UI_COLOR_ACCENT);
@@ -2422,7 +2850,7 @@ int main(int argc, char* argv[]) {
                 text_draw(&text_renderer, col_buf, col5, row1_y, UI_COLOR_WHITE);
 
                 // ===== ROW 2: Mode-specific details =====
-                if (!physics_is_paused(&physics)) {
+                if (!frame->paused) {
                     // Freestyle mode: Steering, Traction, Drift status
                     // Steering
                     if (discrete_steering) {
@@ -2439,23 +2867,15 @@ int main(int argc, char* argv[]) {
                     text_draw(&text_renderer, col_buf, col1, row2_y, UI_COLOR_WHITE);
 
                     // Traction (moved to col2)
-                    float traction = 0.0f;
-                    if (phys_id >= 0) {
-                        float force_n;
-                        physics_vehicle_get_traction_info(&physics, phys_id, &force_n, &traction);
-                    }
+                    float traction = status_v ? status_v->traction : 0.0f;
                     int wheels_contact = (int)(traction * 4.0f + 0.5f);
                     snprintf(col_buf, sizeof(col_buf), "Traction: %d/4", wheels_contact);
                     text_draw(&text_renderer, col_buf, col2, row2_y, UI_COLOR_WHITE);
 
                     // Gear and RPM (col3 area)
-                    int gear = 0;
-                    float rpm = 0.0f;
-                    int raw_gear = 0;
-                    bool is_matchbox = false;
-                    if (phys_id >= 0) {
-                        physics_vehicle_get_drivetrain_info(&physics, phys_id, &gear, &rpm, &raw_gear, &is_matchbox);
-                    }
+                    int gear = status_v ? status_v->gear : 0;
+                    float rpm = status_v ? status_v->rpm : 0.0f;
+                    bool is_matchbox = status_v && status_v->is_matchbox;
 
                     if (is_matchbox) {
                         // Matchbox mode - drivetrain is fake, show N/A
@@ -2470,21 +2890,16 @@ int main(int argc, char* argv[]) {
                     text_draw(&text_renderer, col_buf, col3, row2_y, UI_COLOR_WHITE);
 
                     // Throttle (col4) - shows actual physics throttle (reflects TCS adjustments)
-                    float phys_throttle = 0.0f;
-                    if (phys_id >= 0 && physics.vehicles[phys_id].active) {
-                        phys_throttle = physics.vehicles[phys_id].throttle;
-                    }
+                    float phys_throttle = status_v ? status_v->throttle : 0.0f;
                     int throttle_pct = (int)(phys_throttle * 100.0f + 0.5f);
                     snprintf(col_buf, sizeof(col_buf), "Throttle: %d%%", throttle_pct);
                     text_draw(&text_renderer, col_buf, col4, row2_y, UI_COLOR_WHITE);
 
                     // Slip percentage (col5) - shows max wheel slip for debugging TCS
                     float max_slip = 0.0f;
-                    if (phys_id >= 0) {
-                        WheelState wheel_states[4];
-                        physics_vehicle_get_wheel_states(&physics, phys_id, wheel_states);
+                    if (status_v) {
                         for (int w = 0; w < 4; w++) {
-                            float slip = fabsf(wheel_states[w].longitudinal_slip);
+                            float slip = fabsf(status_v->wheels[w].longitudinal_slip);
                             if (slip > max_slip) max_slip = slip;
                         }
                     }
@@ -2531,6 +2946,44 @@ int main(int argc, char* argv[]) {
             text_renderer_end(&text_renderer);
         }
 
+        // Script cost overlay - upper right
+        if (show_script_costs && has_text) {
+            float line_h = 22.0f;
+            float panel_w = 470.0f;
+            float panel_h = 48.0f + line_h * (script_cost_count > 0 ? script_cost_count : 1);
+            float panel_x = platform.width - panel_w - 15.0f;
+            float panel_y = 15.0f;
+
+            ui_renderer_begin(&ui_renderer, platform.width, platform.height);
+            ui_draw_panel(&ui_renderer,
+                ui_rect(panel_x, panel_y, panel_w, panel_h),
+                ui_color(0.05f, 0.05f, 0.1f, 0.7f),
+                ui_color(0.3f, 0.5f, 0.8f, 0.5f), 1.0f, 6.0f);
+            ui_renderer_end(&ui_renderer);
+
+            text_renderer_begin(&text_renderer, platform.width, platform.height);
+            float tx = panel_x + 12;
+            float ty = panel_y + 10;
+            char line[128];
+            text_draw(&text_renderer, "SCRIPT COST (us)   min    avg    p99  over", tx, ty, UI_COLOR_ACCENT);
+            ty += line_h * 1.3f;
+
+            if (script_cost_count == 0) {
+                text_draw(&text_renderer, "No scripts attached", tx, ty, UI_COLOR_DISABLED);
+            }
+            for (int i = 0; i < script_cost_count; i++) {
+                const ScriptCostStats* sc = &script_costs[i];
+                snprintf(line, sizeof(line), "%2d %-14.14s %6.1f %6.1f %6.1f %5u%s",
+                         sc->vehicle_id, sc->script_name, sc->min_us, sc->avg_us, sc->p99_us,
+                         sc->overruns, sc->suspended ? " SUSP" : "");
+                UIColor color = sc->suspended ? UI_COLOR_DANGER
+                              : (sc->overruns > 0 ? UI_COLOR_CAUTION : UI_COLOR_WHITE);
+                text_draw(&text_renderer, line, tx, ty, color);
+                ty += line_h;
+            }
+            text_renderer_end(&text_renderer);
+        }
+
         // Help overlay (renders on top of everything)
         if (show_help) {
             // Semi-transparent background panel - upper left, auto-height
@@ -2615,6 +3068,10 @@ int main(int argc, char* argv[]) {
                 text_draw(&text_renderer, "  H         Hide cars", tx, ty, UI_COLOR_WHITE);
                 ty += line_h;
                 text_draw(&text_renderer, "  G         Ghost", tx, ty, UI_COLOR_WHITE);
+                ty += line_h;
+                text_draw(&text_renderer, "  F9        Script costs", tx, ty, UI_COLOR_WHITE);
+                ty += line_h;
+                text_draw(&text_renderer, "  F10       Script profiler", tx, ty, UI_COLOR_WHITE);
                 ty += line_h * 1.3f;
 
                 text_draw(&text_renderer, "SYSTEM", tx, ty, UI_COLOR_CAUTION);
@@ -2627,13 +3084,26 @@ int main(int argc, char* argv[]) {
             }
         }
 
+        PROFILE_END();  // UI
+
         // Swap buffers
+        PROFILE_BEGIN("Swap");
         platform_swap_buffers(&platform);
+        PROFILE_END();
     }
 
-    // Cleanup
+#if ARENA_PROFILE
+    profiler_dump_chrome_trace("carwars_trace.json");
+#endif
+
+    // Cleanup (stop the sim thread first: it owns the world and scripts)
+    sim_thread_destroy(sim);
     if (script_engine) reflex_destroy(script_engine);
+    script_watcher_destroy(script_watcher);
+    turn_predictor_destroy(turn_predictor);
+    physics_snapshot_destroy(rewind_snapshot);
     physics_destroy(&physics);
+    config_free_scene(&scene_config);
     if (has_lines) line_renderer_destroy(&line_renderer);
     if (has_particles) particle_renderer_destroy(&particle_renderer);
     if (has_text) text_renderer_destroy(&text_renderer);
@@ -2649,6 +3119,7 @@ int main(int argc, char* argv[]) {
     box_renderer_destroy(&box_renderer);
     floor_destroy(&arena_floor);
     platform_shutdown(&platform);
+    log_shutdown();
     printf("Goodbye!\n");
 
     return 0;
@@ -4,14 +4,21 @@
  */
 
 #include "jolt_physics.h"
-#include "../render/line_render.h"
 #include "../game/config_loader.h"
+#include "../util/profiler.h"
+#include "../util/log.h"
 
 #include <iostream>
 #include <cmath>
 #include <thread>
+#include <mutex>
+#include <atomic>
+#include <string>
+#include <cstdlib>
 #include <cstring>
 #include <cstdarg>
+#include <ctime>
+#include <vector>
 
 // Jolt Physics
 #include <Jolt/Jolt.h>
@@ -21,13 +28,16 @@
 #include <Jolt/Core/JobSystemThreadPool.h>
 #include <Jolt/Physics/PhysicsSettings.h>
 #include <Jolt/Physics/PhysicsSystem.h>
+#include <Jolt/Physics/StateRecorderImpl.h>
 #include <Jolt/Physics/Collision/Shape/BoxShape.h>
 #include <Jolt/Physics/Collision/Shape/SphereShape.h>
 #include <Jolt/Physics/Collision/Shape/CylinderShape.h>
 #include <Jolt/Physics/Collision/Shape/ConvexHullShape.h>
 #include <Jolt/Physics/Collision/Shape/OffsetCenterOfMassShape.h>
+#include <Jolt/Physics/Collision/Shape/StaticCompoundShape.h>
 #include <Jolt/Physics/Body/BodyCreationSettings.h>
 #include <Jolt/Physics/Body/BodyActivationListener.h>
+#include <Jolt/Physics/Body/BodyLock.h>
 #include <Jolt/Physics/Vehicle/WheeledVehicleController.h>
 #include <Jolt/Physics/Vehicle/VehicleCollisionTester.h>
 
@@ -123,6 +133,22 @@ struct PhysicsVehicleImpl
 {
     BodyID bodyId;
     VehicleConstraint* constraint;
+
+    // Kinematic mode tracking - separate from Jolt's motion type
+    // We can't use Jolt's EMotionType::Kinematic because WheeledVehicleConstraint
+    // doesn't support it (asserts on dynamic motion type). Instead, we track
+    // kinematic state ourselves and just directly set position/rotation.
+    bool kinematicMode;
+};
+
+// Static geometry added through the public API, kept so a world can be rebuilt
+// elsewhere (see physics_fork_apply)
+struct StaticGeometryRecord
+{
+    bool isRamp;
+    ::Vec3 position;
+    ::Vec3 size;
+    float rotationY;
 };
 
 // Internal world implementation
@@ -137,6 +163,94 @@ struct PhysicsWorldImpl
 
     BodyID groundBodyId;
     float groundLevel;
+
+    // Job system may be shared between worlds (see PhysicsJobPool)
+    bool ownsJobSystem;
+
+    // Debug logging state (per world so parallel worlds don't interfere)
+    float debugTimer;        // Time since last active-vehicle dump
+    float elapsedTime;       // Total simulated time
+    int rpmDebugCounter;     // Rate limiter for throttle/RPM print
+
+    // Runs before every fixed substep (see physics_set_pre_step_callback)
+    PhysicsPreStepCallback preStepCallback;
+    void* preStepUserData;
+
+    // Scratch list for the per-step state hash (reused, no per-step allocation)
+    BodyIDVector hashBodyIds;
+
+    // Layout tracking for forks: bumped whenever bodies or vehicles are added/removed
+    uint64_t serial;                 // Unique per world instance
+    uint32_t layoutGeneration;
+    std::vector<StaticGeometryRecord> statics;
+    bool staticBatchOpen;            // physics_begin_static_batch called
+    size_t staticBatchStart;         // First statics entry of the open batch
+    uint64_t forkSourceSerial;       // World this one was forked from (0 = none)
+    uint32_t forkLayoutGeneration;   // Source layout it was built for
+};
+
+// Distinguishes world instances for fork layout checks
+static std::atomic<uint64_t> sNextWorldSerial{1};
+
+// Saved per-vehicle state that Jolt's StateRecorder doesn't know about
+struct VehicleSnapshot
+{
+    int id;
+    PhysicsVehicle hot;          // impl/cold/live_index are not restored from here
+    PhysicsVehicleCold cold;     // Includes handling dice and autopilot
+    bool kinematicMode;
+};
+
+// Full world snapshot (see physics_save_state)
+struct PhysicsSnapshot
+{
+    StateRecorderImpl joltState;  // Bodies, contacts, constraints (incl. VehicleConstraint)
+    std::vector<VehicleSnapshot> vehicles;
+    float accumulator;
+    bool paused;
+    uint64_t stepIndex;
+    uint64_t stateHash;
+    bool valid;
+};
+
+// Vehicle state in a fork (layout + state, independent of Jolt body ids)
+struct ForkVehicle
+{
+    int id;
+    PhysicsVehicle hot;
+    PhysicsVehicleCold cold;         // Also carries config and spawn pose for rebuilding
+    bool kinematicMode;
+    RVec3 position;
+    Quat rotation;
+    JPH::Vec3 linearVelocity;
+    JPH::Vec3 angularVelocity;
+    bool bodyActive;
+    std::string constraintState;     // VehicleConstraint::SaveState (wheels, engine, transmission)
+};
+
+// Self-contained copy of a world (see physics_fork_capture)
+struct PhysicsFork
+{
+    uint64_t sourceSerial;
+    uint32_t layoutGeneration;
+    bool hasGround;
+    float groundLevel;
+    std::vector<StaticGeometryRecord> statics;
+    std::vector<ForkVehicle> vehicles;
+    float stepSize;
+    float accumulator;
+    bool paused;
+    bool deterministic;
+    uint64_t matchSeed;
+    uint64_t stepIndex;
+    uint64_t stateHash;
+    bool valid;
+};
+
+// Job system shared by several worlds (batch simulation)
+struct PhysicsJobPool
+{
+    JobSystemThreadPool* jobSystem;
 };
 
 static void TraceImpl(const char* inFMT, ...)
@@ -158,36 +272,181 @@ static bool AssertFailedImpl(const char* inExpression, const char* inMessage, co
 }
 #endif
 
-static bool sJoltInitialized = false;
-
-// Kinematic mode tracking - separate from Jolt's motion type
-// We can't use Jolt's EMotionType::Kinematic because WheeledVehicleConstraint
-// doesn't support it (asserts on dynamic motion type). Instead, we track
-// kinematic state ourselves and just directly set position/rotation.
-static bool sVehicleKinematicMode[MAX_PHYSICS_VEHICLES] = {false};
-
-// No traction control needed - wheels are unpowered in matchbox mode
-
-extern "C" {
+// Jolt global registration (allocator, factory, types) - done once per process
+static std::once_flag sJoltInitOnce;
 
-bool physics_init(PhysicsWorld* pw)
+static void register_jolt_once()
 {
-    if (!sJoltInitialized)
-    {
+    std::call_once(sJoltInitOnce, []() {
         RegisterDefaultAllocator();
         Trace = TraceImpl;
         JPH_IF_ENABLE_ASSERTS(AssertFailed = AssertFailedImpl;)
         Factory::sInstance = new Factory();
         RegisterTypes();
-        sJoltInitialized = true;
+    });
+}
+
+// Worlds stepping concurrently each need their own barriers on a shared pool
+static const int cMaxBatchWorlds = 256;
+
+// Per-vehicle dice seed derived from the match seed (distinct stream per id)
+static uint64_t vehicle_dice_seed(uint64_t match_seed, int vehicle_id)
+{
+    return match_seed ^ ((uint64_t)(vehicle_id + 1) * 0xD1B54A32D192ED03ULL);
+}
+
+// State hash helpers - floats are hashed by bit pattern, so any divergence shows
+static inline uint64_t hash_mix(uint64_t h, uint64_t v)
+{
+    h ^= v;
+    h *= 0x9E3779B97F4A7C15ULL;
+    return h ^ (h >> 29);
+}
+
+static inline uint64_t hash_float(uint64_t h, float f)
+{
+    uint32_t bits;
+    memcpy(&bits, &f, sizeof(bits));
+    return hash_mix(h, bits);
+}
+
+static inline uint64_t hash_vec3(uint64_t h, JPH::Vec3Arg v)
+{
+    h = hash_float(h, v.GetX());
+    h = hash_float(h, v.GetY());
+    return hash_float(h, v.GetZ());
+}
+
+static inline void store_quat(float* out, QuatArg q)
+{
+    out[0] = q.GetX(); out[1] = q.GetY(); out[2] = q.GetZ(); out[3] = q.GetW();
+}
+
+static inline Quat load_quat(const float* q)
+{
+    return Quat(q[0], q[1], q[2], q[3]);
+}
+
+// Record where a vehicle is right now as both render states, so a teleport
+// (respawn, restore, debug moves) is not smeared across the next frame
+static void snap_render_state(PhysicsWorld* pw, PhysicsVehicle* v)
+{
+    BodyInterface& bodyInterface = pw->impl->physicsSystem->GetBodyInterface();
+    PhysicsRenderState* rs = &v->render_curr;
+
+    RVec3 p = bodyInterface.GetPosition(v->impl->bodyId);
+    rs->position = (::Vec3){(float)p.GetX(), (float)p.GetY(), (float)p.GetZ()};
+    store_quat(rs->rotation, bodyInterface.GetRotation(v->impl->bodyId));
+
+    const Wheels& wheels = v->impl->constraint->GetWheels();
+    for (size_t w = 0; w < wheels.size() && w < 4; w++)
+    {
+        RMat44 wheelTransform = v->impl->constraint->GetWheelWorldTransform(
+            (uint)w, JPH::Vec3::sAxisY(), JPH::Vec3::sAxisX());
+        RVec3 wp = wheelTransform.GetTranslation();
+        rs->wheel_position[w] = (::Vec3){(float)wp.GetX(), (float)wp.GetY(), (float)wp.GetZ()};
+        store_quat(rs->wheel_rotation[w], wheelTransform.GetRotation().GetQuaternion());
+        rs->wheel_spin[w] = wheels[w]->GetRotationAngle();
     }
 
+    v->render_prev = *rs;
+}
+
+// Hash every non-static body and all vehicle state after a step
+static uint64_t compute_state_hash(PhysicsWorld* pw)
+{
+    auto* impl = pw->impl;
+    uint64_t h = hash_mix(0xCBF29CE484222325ULL, pw->step_index);
+
+    // Bodies in body-id order (stable for a given creation order)
+    impl->physicsSystem->GetBodies(impl->hashBodyIds);
+    const BodyLockInterfaceNoLock& lockInterface = impl->physicsSystem->GetBodyLockInterfaceNoLock();
+    for (const BodyID& id : impl->hashBodyIds)
+    {
+        BodyLockRead lock(lockInterface, id);
+        if (!lock.Succeeded()) continue;
+        const Body& body = lock.GetBody();
+        if (body.IsStatic()) continue;
+
+        Quat rot = body.GetRotation();
+        h = hash_mix(h, id.GetIndexAndSequenceNumber());
+        h = hash_vec3(h, JPH::Vec3(body.GetPosition()));
+        h = hash_float(h, rot.GetX());
+        h = hash_float(h, rot.GetY());
+        h = hash_float(h, rot.GetZ());
+        h = hash_float(h, rot.GetW());
+        h = hash_vec3(h, body.GetLinearVelocity());
+        h = hash_vec3(h, body.GetAngularVelocity());
+    }
+
+    // Vehicle controls, drivetrain, wheels and turn state
+    for (int n = 0; n < pw->vehicle_count; n++)
+    {
+        const PhysicsVehicle* v = &pw->vehicles[pw->live_vehicles[n]];
+        if (!v->impl) continue;
+
+        h = hash_mix(h, (uint64_t)v->id);
+        h = hash_float(h, v->steering);
+        h = hash_float(h, v->throttle);
+        h = hash_float(h, v->reverse);
+        h = hash_float(h, v->brake);
+        h = hash_float(h, v->handbrake);
+        h = hash_float(h, v->input_steering);
+        h = hash_float(h, v->input_throttle);
+        h = hash_float(h, v->input_brake);
+        h = hash_float(h, v->input_handbrake);
+        h = hash_float(h, v->engine_rpm);
+        h = hash_float(h, v->reverse_rpm);
+        h = hash_float(h, v->cruise_enabled ? v->cruise_target_ms : -1.0f);
+        h = hash_mix(h, (uint64_t)v->cold->handling.handling_status);
+        h = hash_mix(h, v->cold->handling.rng.state);
+        h = hash_mix(h, (uint64_t)v->cold->autopilot.state);
+        h = hash_float(h, v->cold->autopilot.elapsed);
+
+        const WheeledVehicleController* ctrl = static_cast<const WheeledVehicleController*>(
+            v->impl->constraint->GetController());
+        h = hash_float(h, ctrl->GetEngine().GetCurrentRPM());
+        h = hash_mix(h, (uint64_t)(int64_t)ctrl->GetTransmission().GetCurrentGear());
+
+        for (const Wheel* wheel : v->impl->constraint->GetWheels())
+        {
+            h = hash_float(h, wheel->GetAngularVelocity());
+            h = hash_float(h, wheel->GetRotationAngle());
+            h = hash_float(h, wheel->GetSuspensionLength());
+        }
+    }
+
+    return h;
+}
+
+// No traction control needed - wheels are unpowered in matchbox mode
+
+extern "C" {
+
+bool physics_init(PhysicsWorld* pw)
+{
+    return physics_init_with_pool(pw, nullptr);
+}
+
+bool physics_init_with_pool(PhysicsWorld* pw, PhysicsJobPool* pool)
+{
+    register_jolt_once();
+
     pw->impl = new PhysicsWorldImpl();
     auto* impl = pw->impl;
 
     impl->tempAllocator = new TempAllocatorImpl(10 * 1024 * 1024);
-    impl->jobSystem = new JobSystemThreadPool(cMaxPhysicsJobs, cMaxPhysicsBarriers,
-        std::thread::hardware_concurrency() - 1);
+    if (pool)
+    {
+        impl->jobSystem = pool->jobSystem;
+        impl->ownsJobSystem = false;
+    }
+    else
+    {
+        impl->jobSystem = new JobSystemThreadPool(cMaxPhysicsJobs, cMaxPhysicsBarriers,
+            std::thread::hardware_concurrency() - 1);
+        impl->ownsJobSystem = true;
+    }
 
     impl->broadPhaseLayerInterface = new BPLayerInterfaceImpl();
     impl->objectVsBroadPhaseLayerFilter = new ObjectVsBroadPhaseLayerFilterImpl();
@@ -195,8 +454,8 @@ bool physics_init(PhysicsWorld* pw)
 
     const uint cMaxBodies = 1024;
     const uint cNumBodyMutexes = 0;
-    const uint cMaxBodyPairs = 1024;
-    const uint cMaxContactConstraints = 1024;
+    const uint cMaxBodyPairs = 4096;           // Sized for a full MAX_PHYSICS_VEHICLES pile-up
+    const uint cMaxContactConstraints = 4096;
 
     impl->physicsSystem = new PhysicsSystem();
     impl->physicsSystem->Init(cMaxBodies, cNumBodyMutexes, cMaxBodyPairs, cMaxContactConstraints,
@@ -208,15 +467,37 @@ bool physics_init(PhysicsWorld* pw)
     pw->step_size = 1.0f / 60.0f;
     pw->accumulator = 0.0f;
     pw->paused = false;  // Start unpaused so vehicles can settle
-
-    for (int i = 0; i < MAX_PHYSICS_VEHICLES; i++)
+    pw->quiet = false;
+
+    // Free-running by default; lockstep matches opt in via physics_set_deterministic
+    pw->deterministic = false;
+    pw->match_seed = (uint64_t)time(NULL);
+    pw->step_index = 0;
+    pw->state_hash = 0;
+
+    // Vehicle pool starts small and grows on demand (see physics_create_vehicle)
+    pw->vehicle_capacity = PHYSICS_VEHICLE_POOL_INITIAL;
+    pw->vehicles = (PhysicsVehicle*)calloc(pw->vehicle_capacity, sizeof(PhysicsVehicle));
+    pw->live_vehicles = (int*)malloc(pw->vehicle_capacity * sizeof(int));
+    for (int i = 0; i < pw->vehicle_capacity; i++)
     {
-        pw->vehicles[i].active = false;
         pw->vehicles[i].id = i;
-        pw->vehicles[i].impl = nullptr;
+        pw->vehicles[i].live_index = -1;
     }
 
     impl->groundLevel = 0.0f;
+    impl->debugTimer = 0.0f;
+    impl->elapsedTime = 0.0f;
+    impl->rpmDebugCounter = 0;
+    impl->preStepCallback = nullptr;
+    impl->preStepUserData = nullptr;
+
+    impl->serial = sNextWorldSerial.fetch_add(1);
+    impl->layoutGeneration = 0;
+    impl->forkSourceSerial = 0;
+    impl->forkLayoutGeneration = 0;
+    impl->staticBatchOpen = false;
+    impl->staticBatchStart = 0;
 
     std::cout << "[Jolt] Physics initialized" << std::endl;
     return true;
@@ -226,14 +507,16 @@ void physics_destroy(PhysicsWorld* pw)
 {
     if (!pw || !pw->impl) return;
 
-    // Destroy all vehicles first
-    for (int i = 0; i < MAX_PHYSICS_VEHICLES; i++)
+    // Destroy all vehicles first (back to front so the live list never shuffles)
+    while (pw->vehicle_count > 0)
     {
-        if (pw->vehicles[i].active)
-        {
-            physics_destroy_vehicle(pw, i);
-        }
+        physics_destroy_vehicle(pw, pw->live_vehicles[pw->vehicle_count - 1]);
     }
+    free(pw->vehicles);
+    free(pw->live_vehicles);
+    pw->vehicles = nullptr;
+    pw->live_vehicles = nullptr;
+    pw->vehicle_capacity = 0;
 
     auto* impl = pw->impl;
 
@@ -241,7 +524,10 @@ void physics_destroy(PhysicsWorld* pw)
     delete impl->objectLayerPairFilter;
     delete impl->objectVsBroadPhaseLayerFilter;
     delete impl->broadPhaseLayerInterface;
-    delete impl->jobSystem;
+    if (impl->ownsJobSystem)
+    {
+        delete impl->jobSystem;
+    }
     delete impl->tempAllocator;
     delete impl;
 
@@ -249,6 +535,90 @@ void physics_destroy(PhysicsWorld* pw)
     std::cout << "[Jolt] Physics destroyed" << std::endl;
 }
 
+// ========== BATCH SIMULATION ==========
+
+PhysicsJobPool* physics_job_pool_create(int thread_count)
+{
+    register_jolt_once();
+
+    if (thread_count < 0)
+    {
+        thread_count = (int)std::thread::hardware_concurrency() - 1;
+    }
+
+    // Every world stepping inside a batch holds one barrier for its Update,
+    // and all of them draw jobs from the same free list
+    auto* pool = new PhysicsJobPool();
+    pool->jobSystem = new JobSystemThreadPool(cMaxPhysicsJobs * 4,
+        cMaxPhysicsBarriers + cMaxBatchWorlds, thread_count);
+
+    std::cout << "[Jolt] Job pool created (" << thread_count << " threads)" << std::endl;
+    return pool;
+}
+
+void physics_job_pool_destroy(PhysicsJobPool* pool)
+{
+    if (!pool) return;
+    delete pool->jobSystem;
+    delete pool;
+}
+
+void physics_step_batch(PhysicsJobPool* pool, PhysicsWorld** worlds, int world_count, float dt)
+{
+    if (!pool || !worlds || world_count <= 0) return;
+
+    JobSystem* jobSystem = pool->jobSystem;
+
+    // One job per world; each world's own Update fans out on the same pool.
+    // Waiting threads help run their barrier's jobs, so nesting can't deadlock.
+    for (int start = 0; start < world_count; start += cMaxBatchWorlds)
+    {
+        int end = start + cMaxBatchWorlds < world_count ? start + cMaxBatchWorlds : world_count;
+
+        JobSystem::Barrier* barrier = jobSystem->CreateBarrier();
+        for (int i = start; i < end; i++)
+        {
+            PhysicsWorld* pw = worlds[i];
+            if (!pw || !pw->impl) continue;
+
+            JobHandle handle = jobSystem->CreateJob("StepWorld", Color::sGreen,
+                [pw, dt]() { physics_step(pw, dt); });
+            barrier->AddJob(handle);
+        }
+        jobSystem->WaitForJobs(barrier);
+        jobSystem->DestroyBarrier(barrier);
+    }
+}
+
+void physics_set_pre_step_callback(PhysicsWorld* pw, PhysicsPreStepCallback callback, void* user_data)
+{
+    if (!pw || !pw->impl) return;
+    pw->impl->preStepCallback = callback;
+    pw->impl->preStepUserData = user_data;
+}
+
+void physics_parallel_for(PhysicsWorld* pw, int count, PhysicsParallelFn fn, void* user_data)
+{
+    if (!pw || !pw->impl || !fn || count <= 0) return;
+
+    if (count == 1)
+    {
+        fn(0, user_data);
+        return;
+    }
+
+    JobSystem* jobSystem = pw->impl->jobSystem;
+    JobSystem::Barrier* barrier = jobSystem->CreateBarrier();
+    for (int i = 0; i < count; i++)
+    {
+        JobHandle handle = jobSystem->CreateJob("ParallelFor", Color::sCyan,
+            [fn, user_data, i]() { fn(i, user_data); });
+        barrier->AddJob(handle);
+    }
+    jobSystem->WaitForJobs(barrier);
+    jobSystem->DestroyBarrier(barrier);
+}
+
 void physics_step(PhysicsWorld* pw, float dt)
 {
     if (!pw || !pw->impl) return;
@@ -256,9 +626,9 @@ void physics_step(PhysicsWorld* pw, float dt)
     // If paused, don't step physics but still update wheel states for rendering
     if (pw->paused) {
         // Update wheel states even when paused (for visual consistency)
-        for (int i = 0; i < MAX_PHYSICS_VEHICLES; i++) {
-            PhysicsVehicle* v = &pw->vehicles[i];
-            if (!v->active || !v->impl) continue;
+        for (int n = 0; n < pw->vehicle_count; n++) {
+            PhysicsVehicle* v = &pw->vehicles[pw->live_vehicles[n]];
+            if (!v->impl) continue;
             // Wheel state update is done below in main loop when unpaused
         }
         return;
@@ -269,23 +639,27 @@ void physics_step(PhysicsWorld* pw, float dt)
     pw->accumulator += dt;
     while (pw->accumulator >= pw->step_size)
     {
+        PROFILE_SCOPE("Physics.FixedStep");
+
         // Debug: print active vehicles every 2 seconds
-        static float vehicleDebugTimer = 0;
-        static float totalElapsedTime = 0;
-        vehicleDebugTimer += pw->step_size;
-        totalElapsedTime += pw->step_size;
-        if (vehicleDebugTimer >= 2.0f) {
-            printf("[T=%.1fs] Active vehicles: ", totalElapsedTime);
-            for (int vi = 0; vi < MAX_PHYSICS_VEHICLES; vi++) {
-                if (pw->vehicles[vi].active) {
-                    printf("[%d: thr=%.1f brk=%.1f] ", vi, pw->vehicles[vi].throttle, pw->vehicles[vi].brake);
+        impl->debugTimer += pw->step_size;
+        impl->elapsedTime += pw->step_size;
+        if (impl->debugTimer >= 2.0f) {
+            if (LOG_ENABLED(LOG_PHYSICS, LOG_LEVEL_DEBUG)) {
+                char line[LOG_MESSAGE_MAX];
+                int len = snprintf(line, sizeof(line), "[T=%.1fs] Active vehicles: ", impl->elapsedTime);
+                for (int n = 0; n < pw->vehicle_count && len > 0 && len < (int)sizeof(line); n++) {
+                    const PhysicsVehicle* dv = &pw->vehicles[pw->live_vehicles[n]];
+                    len += snprintf(line + len, sizeof(line) - len, "[%d: thr=%.1f brk=%.1f] ",
+                                    dv->id, dv->throttle, dv->brake);
                 }
+                log_write(LOG_PHYSICS, LOG_LEVEL_DEBUG, "%s", line);
             }
-            printf("\n");
 
             // Debug drivetrain for vehicle 0 if using real drivetrain mode
-            if (pw->vehicles[0].active && pw->vehicles[0].impl && !pw->vehicles[0].config.use_linear_accel) {
-                PhysicsVehicle* v = &pw->vehicles[0];
+            PhysicsVehicle* v = physics_get_vehicle(pw, 0);
+            if (v && v->impl && !v->cold->config.use_linear_accel &&
+                LOG_ENABLED(LOG_DRIVETRAIN, LOG_LEVEL_DEBUG)) {
                 PhysicsVehicleImpl* vimpl = v->impl;
                 WheeledVehicleController* ctrl = static_cast<WheeledVehicleController*>(
                     vimpl->constraint->GetController());
@@ -314,33 +688,42 @@ void physics_step(PhysicsWorld* pw, float dt)
                     }
                 }
 
-                printf("  [Drivetrain] G:%d RPM:%.0f Clutch:%.2f Speed:%.0f mph\n", gear, rpm, clutch, speed_mph);
-                printf("    Slip: FL=%.2f%s FR=%.2f%s RL=%.2f%s RR=%.2f%s\n",
+                LOG_DEBUG(LOG_DRIVETRAIN, "  [Drivetrain] G:%d RPM:%.0f Clutch:%.2f Speed:%.0f mph", gear, rpm, clutch, speed_mph);
+                LOG_DEBUG(LOG_DRIVETRAIN, "    Slip: FL=%.2f%s FR=%.2f%s RL=%.2f%s RR=%.2f%s",
                        slip[0], contact[0] ? "" : "(air)",
                        slip[1], contact[1] ? "" : "(air)",
                        slip[2], contact[2] ? "" : "(air)",
                        slip[3], contact[3] ? "" : "(air)");
                 // Show steer angles if any wheel is turned
                 if (fabsf(steer[0]) > 0.01f || fabsf(steer[1]) > 0.01f) {
-                    printf("    Steer: FL=%.1f° FR=%.1f°\n",
+                    LOG_DEBUG(LOG_DRIVETRAIN, "    Steer: FL=%.1f° FR=%.1f°",
                            steer[0] * 57.2958f, steer[1] * 57.2958f);
                 }
 
                 // Show if slip would block upshift (>10%)
                 bool slipping = (slip[2] > 0.1f || slip[3] > 0.1f);
                 if (slipping) {
-                    printf("    -> SLIP BLOCKING UPSHIFT (slip > 10%%)\n");
+                    LOG_DEBUG(LOG_DRIVETRAIN, "    -> SLIP BLOCKING UPSHIFT (slip > 10%%)");
                 }
             }
-            fflush(stdout);
-            vehicleDebugTimer = 0;
+            impl->debugTimer = 0;
+        }
+
+        // Controllers (reflex scripts) see the last substep's telemetry and
+        // set this substep's controls
+        if (impl->preStepCallback)
+        {
+            PROFILE_SCOPE("Physics.PreStepHook");
+            impl->preStepCallback(pw, pw->step_size, impl->preStepUserData);
         }
 
         // Update vehicle inputs before stepping
-        for (int i = 0; i < MAX_PHYSICS_VEHICLES; i++)
+        PROFILE_BEGIN("Physics.PrePass");
+        for (int n = 0; n < pw->vehicle_count; n++)
         {
+            int i = pw->live_vehicles[n];
             PhysicsVehicle* v = &pw->vehicles[i];
-            if (!v->active || !v->impl) continue;
+            if (!v->impl) continue;
 
             auto* vimpl = v->impl;
             BodyInterface& bodyInterface = impl->physicsSystem->GetBodyInterface();
@@ -356,11 +739,9 @@ void physics_step(PhysicsWorld* pw, float dt)
             // Engine RPM tracks throttle position
             float targetRpm = v->throttle;
             // Debug: show what throttle physics is using (remove after testing)
-            static int debugCounter = 0;
-            if (++debugCounter % 60 == 0 && v->throttle > 0.1f) {
-                printf("[Physics] Vehicle %d: throttle=%.2f, engine_rpm=%.2f, target=%.2f\n",
-                       i, v->throttle, v->engine_rpm, targetRpm);
-                fflush(stdout);
+            if (++impl->rpmDebugCounter % 60 == 0 && v->throttle > 0.1f) {
+                LOG_DEBUG(LOG_PHYSICS, "[Physics] Vehicle %d: throttle=%.2f, engine_rpm=%.2f, target=%.2f",
+                          i, v->throttle, v->engine_rpm, targetRpm);
             }
             if (v->engine_rpm < targetRpm) {
                 v->engine_rpm = fminf(v->engine_rpm + rpmRampUp * stepDt, targetRpm);
@@ -384,8 +765,7 @@ void physics_step(PhysicsWorld* pw, float dt)
             if (v->cruise_enabled && v->brake > 0.0f) {
                 v->cruise_enabled = false;
                 v->cruise_target_ms = 0;
-                printf("Cruise: OFF (brake pressed)\n");
-                fflush(stdout);
+                if (!pw->quiet) LOG_INFO(LOG_PHYSICS, "Cruise: OFF (brake pressed)");
             }
 
             // Apply cruise control if enabled and no manual throttle input
@@ -423,7 +803,7 @@ void physics_step(PhysicsWorld* pw, float dt)
             // ========== KINEMATIC MANEUVER SYSTEM ==========
             // When maneuver is active, vehicle is in kinematic mode
             // Skip all normal physics and animate along calculated path
-            if (maneuver_is_active(&v->autopilot)) {
+            if (maneuver_is_active(&v->cold->autopilot)) {
                 // Ensure vehicle is in kinematic mode
                 if (!physics_vehicle_is_kinematic(pw, i)) {
                     physics_vehicle_set_kinematic(pw, i, true);
@@ -431,32 +811,32 @@ void physics_step(PhysicsWorld* pw, float dt)
 
                 // Update maneuver and get interpolated pose
                 bool complete = false;
-                ManeuverPose pose = maneuver_update(&v->autopilot, pw->step_size, &complete);
+                ManeuverPose pose = maneuver_update(&v->cold->autopilot, pw->step_size, &complete);
 
                 if (complete) {
                     // Maneuver complete - switch back to dynamic mode
                     physics_vehicle_set_kinematic(pw, i, false);
 
                     // Set exit velocity at TARGET speed (speed changed during turn)
-                    ::Vec3 exitVel = maneuver_get_exit_velocity(&v->autopilot);
+                    ::Vec3 exitVel = maneuver_get_exit_velocity(&v->cold->autopilot);
                     physics_vehicle_set_velocity(pw, i, exitVel);
 
                     // Apply pending cruise immediately - speed is already at target
-                    if (v->pending_cruise_active) {
+                    if (v->cold->pending_cruise_active) {
                         v->cruise_enabled = true;
-                        v->cruise_target_ms = v->pending_cruise_target_ms;
-                        v->pending_cruise_active = false;
-                        printf("Cruise: NOW %.0f mph (turn complete)\n", v->cruise_target_ms * 2.237f);
-                        fflush(stdout);
+                        v->cruise_target_ms = v->cold->pending_cruise_target_ms;
+                        v->cold->pending_cruise_active = false;
+                        if (!pw->quiet) {
+                            LOG_INFO(LOG_PHYSICS, "Cruise: NOW %.0f mph (turn complete)", v->cruise_target_ms * 2.237f);
+                        }
                     }
 
-                    printf("[Maneuver] Kinematic animation complete, returning control\n");
-                    fflush(stdout);
-
                     // Pause the world so user can inspect the final position
                     pw->paused = true;
-                    printf("[Physics] World PAUSED (maneuver complete)\n");
-                    fflush(stdout);
+                    if (!pw->quiet) {
+                        LOG_INFO(LOG_MANEUVER, "[Maneuver] Kinematic animation complete, returning control");
+                        LOG_INFO(LOG_PHYSICS, "[Physics] World PAUSED (maneuver complete)");
+                    }
                 } else {
                     // Move kinematic body to interpolated pose
                     physics_vehicle_move_kinematic(pw, i, pose.position, pose.heading, pw->step_size);
@@ -495,21 +875,21 @@ void physics_step(PhysicsWorld* pw, float dt)
             JPH::Vec3 vel = bodyInterface.GetLinearVelocity(vimpl->bodyId);
             float speed = vel.Length();
 
-            if (v->config.use_linear_accel) {
+            if (v->cold->config.use_linear_accel) {
                 // ========== MATCHBOX CAR MODE ==========
                 // Apply direct body force for acceleration - wheels are unpowered
                 // F = m * a gives constant acceleration regardless of speed
                 // Only apply force if any wheel is on ground (airborne check)
                 // TCS script handles actual slip-based traction control
 
-                if (forward > 0.0f && speed < v->config.top_speed_ms && anyWheelOnGround)
+                if (forward > 0.0f && speed < v->cold->config.top_speed_ms && anyWheelOnGround)
                 {
                     // Get vehicle's forward direction (Z axis in local space)
                     JPH::Quat rot = bodyInterface.GetRotation(vimpl->bodyId);
                     JPH::Vec3 forwardDir = rot.RotateAxisZ();
 
                     // Apply acceleration force proportional to throttle
-                    float force = v->config.accel_force * forward;
+                    float force = v->cold->config.accel_force * forward;
                     bodyInterface.AddForce(vimpl->bodyId, forwardDir * force);
                     v->last_applied_force = force;  // Store for debug display
                 }
@@ -518,7 +898,7 @@ void physics_step(PhysicsWorld* pw, float dt)
                     // Reverse - apply force in opposite direction
                     JPH::Quat rot = bodyInterface.GetRotation(vimpl->bodyId);
                     JPH::Vec3 forwardDir = rot.RotateAxisZ();
-                    float force = v->config.accel_force * (-forward);
+                    float force = v->cold->config.accel_force * (-forward);
                     bodyInterface.AddForce(vimpl->bodyId, -forwardDir * force);
                     v->last_applied_force = -force;  // Negative for reverse
                 }
@@ -528,7 +908,7 @@ void physics_step(PhysicsWorld* pw, float dt)
                 {
                     // Brake force opposes current velocity direction
                     JPH::Vec3 velDir = vel.Normalized();
-                    float brakeForce = v->config.brake_force * v->brake;
+                    float brakeForce = v->cold->config.brake_force * v->brake;
                     bodyInterface.AddForce(vimpl->bodyId, -velDir * brakeForce);
                 }
 
@@ -547,13 +927,13 @@ void physics_step(PhysicsWorld* pw, float dt)
                 float handBrake = v->handbrake;
 
                 controller->SetDriverInput(forwardInput, v->steering, v->brake, handBrake);
-                v->last_applied_force = forwardInput * v->config.engine_max_torque;  // Approximate for display
+                v->last_applied_force = forwardInput * v->cold->config.engine_max_torque;  // Approximate for display
             }
 
             // ========== ACCELERATION TEST ==========
             // Key-triggered test (T key), auto-ends at 60 mph
             // Timer only starts when throttle is applied (forward > 0)
-            if (v->accel_test_active)
+            if (v->cold->accel_test_active)
             {
                 BodyInterface& bodyInterface = impl->physicsSystem->GetBodyInterface();
                 JPH::Vec3 vel = bodyInterface.GetLinearVelocity(vimpl->bodyId);
@@ -561,24 +941,24 @@ void physics_step(PhysicsWorld* pw, float dt)
                 RVec3 pos = bodyInterface.GetPosition(vimpl->bodyId);
 
                 // Start timing only when throttle is applied
-                if (!v->accel_test_timing_started && forward > 0)
+                if (!v->cold->accel_test_timing_started && forward > 0)
                 {
-                    v->accel_test_timing_started = true;
-                    v->accel_test_start_pos = (::Vec3){(float)pos.GetX(), (float)pos.GetY(), (float)pos.GetZ()};
-                    v->accel_test_last_speed = speed;
-                    printf("[ACCEL TEST] Timing started (throttle detected)\n");
-                    fflush(stdout);
+                    v->cold->accel_test_timing_started = true;
+                    v->cold->accel_test_start_pos = (::Vec3){(float)pos.GetX(), (float)pos.GetY(), (float)pos.GetZ()};
+                    v->cold->accel_test_last_speed = speed;
+                    LOG_INFO(LOG_DRIVETRAIN, "[ACCEL TEST] Timing started (throttle detected)");
                 }
 
                 // Only count time once timing has started
-                if (v->accel_test_timing_started)
+                if (v->cold->accel_test_timing_started)
                 {
-                    v->accel_test_elapsed += pw->step_size;
+                    v->cold->accel_test_elapsed += pw->step_size;
 
                     // Detailed logging every 0.25s to catch gear shifts and pauses
-                    v->accel_test_print_timer += pw->step_size;
-                    if (v->accel_test_print_timer >= 0.25f) {
-                        v->accel_test_print_timer = 0;
+                    v->cold->accel_test_print_timer += pw->step_size;
+                    if (v->cold->accel_test_print_timer >= 0.25f &&
+                        LOG_ENABLED(LOG_DRIVETRAIN, LOG_LEVEL_DEBUG)) {
+                        v->cold->accel_test_print_timer = 0;
                         WheeledVehicleController* ctrl = static_cast<WheeledVehicleController*>(
                             vimpl->constraint->GetController());
                         int gear = ctrl->GetTransmission().GetCurrentGear();
@@ -594,26 +974,26 @@ void physics_step(PhysicsWorld* pw, float dt)
                             if (wv->mLongitudinalSlip > maxSlip) maxSlip = wv->mLongitudinalSlip;
                         }
 
-                        printf("[ACCEL] t=%.2fs %.0fmph G%d RPM:%.0f Clutch:%.2f Slip:%.2f Thr:%.2f\n",
-                               v->accel_test_elapsed, speedMph, gear, rpm, clutch, maxSlip, v->throttle);
-                        fflush(stdout);
+                        log_write(LOG_DRIVETRAIN, LOG_LEVEL_DEBUG,
+                                  "[ACCEL] t=%.2fs %.0fmph G%d RPM:%.0f Clutch:%.2f Slip:%.2f Thr:%.2f",
+                                  v->cold->accel_test_elapsed, speedMph, gear, rpm, clutch, maxSlip, v->throttle);
                     }
 
                     // Stop conditions: target speed (may be less than 60 for slow cars), collision, or timeout
-                    float targetSpeed = v->accel_test_target_ms;
+                    float targetSpeed = v->cold->accel_test_target_ms;
                     bool reachedTarget = speed >= targetSpeed;
-                    bool collision = (v->accel_test_last_speed > 5.0f && speed < v->accel_test_last_speed * 0.7f);
-                    bool timeout = v->accel_test_elapsed > 30.0f;
+                    bool collision = (v->cold->accel_test_last_speed > 5.0f && speed < v->cold->accel_test_last_speed * 0.7f);
+                    bool timeout = v->cold->accel_test_elapsed > 30.0f;
 
                     if (reachedTarget || collision || timeout)
                     {
-                        float avgAccel = speed / v->accel_test_elapsed;
+                        float avgAccel = speed / v->cold->accel_test_elapsed;
                         float speedMph = speed * 2.23694f;
                         float targetMph = targetSpeed * 2.23694f;
 
                         // Use vehicle's configured target (from PF/weight ratio)
-                        float targetAccel = v->config.target_accel_ms2;
-                        float target060 = v->config.target_0_60_seconds;
+                        float targetAccel = v->cold->config.target_accel_ms2;
+                        float target060 = v->cold->config.target_0_60_seconds;
                         if (targetAccel <= 0.0f) {
                             targetAccel = 4.47f;  // Fallback: 10 mph/s
                             target060 = 6.0f;
@@ -658,30 +1038,29 @@ void physics_step(PhysicsWorld* pw, float dt)
 
                         // Calculate result - pass if within bucket range
                         float accelPercent = (avgAccel / targetAccel) * 100.0f;
-                        bool passed = (v->accel_test_elapsed >= rangeMin && v->accel_test_elapsed <= rangeMax);
+                        bool passed = (v->cold->accel_test_elapsed >= rangeMin && v->cold->accel_test_elapsed <= rangeMax);
 
                         // Output with vehicle name and pass/fail
-                        printf("\n[ACCEL TEST] %s\n", v->config.vehicle_name[0] ? v->config.vehicle_name : "Vehicle");
+                        LOG_INFO(LOG_DRIVETRAIN, "\n[ACCEL TEST] %s", v->cold->config.vehicle_name[0] ? v->cold->config.vehicle_name : "Vehicle");
                         if (speedScale < 1.0f) {
-                            printf("  0-%.0f: %.2fs (bucket: %s, range: %.1f-%.1fs) %s\n",
-                                   targetMph, v->accel_test_elapsed, bucketName, rangeMin, rangeMax, passed ? "PASS" : "FAIL");
-                            printf("  (scaled from 0-60 by %.0f%%)\n", speedScale * 100.0f);
+                            LOG_INFO(LOG_DRIVETRAIN, "  0-%.0f: %.2fs (bucket: %s, range: %.1f-%.1fs) %s",
+                                     targetMph, v->cold->accel_test_elapsed, bucketName, rangeMin, rangeMax, passed ? "PASS" : "FAIL");
+                            LOG_INFO(LOG_DRIVETRAIN, "  (scaled from 0-60 by %.0f%%)", speedScale * 100.0f);
                         } else {
-                            printf("  0-60: %.2fs (bucket: %s, range: %.1f-%.1fs) %s\n",
-                                   v->accel_test_elapsed, bucketName, rangeMin, rangeMax, passed ? "PASS" : "FAIL");
+                            LOG_INFO(LOG_DRIVETRAIN, "  0-60: %.2fs (bucket: %s, range: %.1f-%.1fs) %s",
+                                     v->cold->accel_test_elapsed, bucketName, rangeMin, rangeMax, passed ? "PASS" : "FAIL");
                         }
-                        printf("  Avg Accel: %.2f m/s² (%.0f%% of target %.2f m/s²)\n",
-                               avgAccel, accelPercent, targetAccel);
-                        printf("  Final: %.0f mph\n", speedMph);
-                        if (collision) printf("  (ended early - collision detected)\n");
-                        if (timeout) printf("  (timeout - did not reach target speed)\n");
-                        fflush(stdout);
-
-                        v->accel_test_active = false;
-                        v->accel_test_timing_started = false;
+                        LOG_INFO(LOG_DRIVETRAIN, "  Avg Accel: %.2f m/s² (%.0f%% of target %.2f m/s²)",
+                                 avgAccel, accelPercent, targetAccel);
+                        LOG_INFO(LOG_DRIVETRAIN, "  Final: %.0f mph", speedMph);
+                        if (collision) LOG_INFO(LOG_DRIVETRAIN, "  (ended early - collision detected)");
+                        if (timeout) LOG_INFO(LOG_DRIVETRAIN, "  (timeout - did not reach target speed)");
+
+                        v->cold->accel_test_active = false;
+                        v->cold->accel_test_timing_started = false;
                     }
 
-                    v->accel_test_last_speed = speed;
+                    v->cold->accel_test_last_speed = speed;
                 }
             }
             // ========== END ACCELERATION TEST ==========
@@ -693,18 +1072,32 @@ void physics_step(PhysicsWorld* pw, float dt)
             }
         }
 
+        PROFILE_END();
+
         // Step physics
+        PROFILE_BEGIN("Physics.JoltUpdate");
         impl->physicsSystem->Update(pw->step_size, 1, impl->tempAllocator, impl->jobSystem);
+        PROFILE_END();
 
         // Update wheel states after stepping
-        for (int i = 0; i < MAX_PHYSICS_VEHICLES; i++)
+        PROFILE_BEGIN("Physics.WheelReadback");
+        for (int n = 0; n < pw->vehicle_count; n++)
         {
+            int i = pw->live_vehicles[n];
             PhysicsVehicle* v = &pw->vehicles[i];
-            if (!v->active || !v->impl) continue;
+            if (!v->impl) continue;
 
             auto* vimpl = v->impl;
             const Wheels& wheels = vimpl->constraint->GetWheels();
 
+            // Keep the last two steps' transforms for interpolated rendering
+            PhysicsRenderState* rs = &v->render_curr;
+            v->render_prev = *rs;
+            BodyInterface& bodyInterface = impl->physicsSystem->GetBodyInterface();
+            RVec3 chassisPos = bodyInterface.GetPosition(vimpl->bodyId);
+            rs->position = (::Vec3){(float)chassisPos.GetX(), (float)chassisPos.GetY(), (float)chassisPos.GetZ()};
+            store_quat(rs->rotation, bodyInterface.GetRotation(vimpl->bodyId));
+
             for (size_t w = 0; w < wheels.size() && w < 4; w++)
             {
                 const Wheel* wheel = wheels[w];
@@ -742,9 +1135,22 @@ void physics_step(PhysicsWorld* pw, float dt)
                 v->wheel_states[w].rot_matrix[9] = (float)pos.GetX();
                 v->wheel_states[w].rot_matrix[10] = (float)pos.GetY();
                 v->wheel_states[w].rot_matrix[11] = (float)pos.GetZ();
+
+                rs->wheel_position[w] = v->wheel_states[w].position;
+                store_quat(rs->wheel_rotation[w], rot.GetQuaternion());
+                rs->wheel_spin[w] = v->wheel_states[w].rotation;
             }
         }
 
+        PROFILE_END();
+
+        pw->step_index++;
+        if (pw->deterministic)
+        {
+            PROFILE_SCOPE("Physics.StateHash");
+            pw->state_hash = compute_state_hash(pw);
+        }
+
         pw->accumulator -= pw->step_size;
     }
 }
@@ -764,6 +1170,7 @@ void physics_set_ground(PhysicsWorld* pw, float y_level)
     }
 
     impl->groundLevel = y_level;
+    impl->layoutGeneration++;
 
     // Create ground plane as large box
     BoxShapeSettings groundShapeSettings(JPH::Vec3(500.0f, 1.0f, 500.0f));
@@ -779,32 +1186,21 @@ void physics_set_ground(PhysicsWorld* pw, float y_level)
     bodyInterface.AddBody(impl->groundBodyId, EActivation::DontActivate);
 }
 
-void physics_add_box_obstacle(PhysicsWorld* pw, ::Vec3 pos, ::Vec3 size)
+// Obstacle shapes in local space (box centered, ramp at its center-bottom)
+static ShapeRefC create_box_shape(::Vec3 size)
 {
-    if (!pw || !pw->impl) return;
-
-    auto* impl = pw->impl;
-    BodyInterface& bodyInterface = impl->physicsSystem->GetBodyInterface();
-
     BoxShapeSettings boxShapeSettings(JPH::Vec3(size.x * 0.5f, size.y * 0.5f, size.z * 0.5f));
     boxShapeSettings.SetEmbedded();
     ShapeSettings::ShapeResult boxShapeResult = boxShapeSettings.Create();
-    ShapeRefC boxShape = boxShapeResult.Get();
-
-    BodyCreationSettings boxSettings(boxShape, RVec3(pos.x, pos.y, pos.z),
-        Quat::sIdentity(), EMotionType::Static, Layers::NON_MOVING);
-
-    Body* box = bodyInterface.CreateBody(boxSettings);
-    bodyInterface.AddBody(box->GetID(), EActivation::DontActivate);
+    if (!boxShapeResult.IsValid()) {
+        std::cerr << "[Jolt] Failed to create box shape: " << boxShapeResult.GetError() << std::endl;
+        return nullptr;
+    }
+    return boxShapeResult.Get();
 }
 
-void physics_add_ramp_obstacle(PhysicsWorld* pw, ::Vec3 pos, ::Vec3 size, float rotation_y)
+static ShapeRefC create_ramp_shape(::Vec3 size)
 {
-    if (!pw || !pw->impl) return;
-
-    auto* impl = pw->impl;
-    BodyInterface& bodyInterface = impl->physicsSystem->GetBodyInterface();
-
     // Create a wedge/ramp shape using convex hull
     // size.x = width, size.y = height (at high end), size.z = length
     // Low end at -Z, high end at +Z (before rotation)
@@ -831,18 +1227,101 @@ void physics_add_ramp_obstacle(PhysicsWorld* pw, ::Vec3 pos, ::Vec3 size, float
     ShapeSettings::ShapeResult rampShapeResult = rampShapeSettings.Create();
     if (!rampShapeResult.IsValid()) {
         std::cerr << "[Jolt] Failed to create ramp shape: " << rampShapeResult.GetError() << std::endl;
-        return;
+        return nullptr;
     }
-    ShapeRefC rampShape = rampShapeResult.Get();
+    return rampShapeResult.Get();
+}
 
-    // Create rotation quaternion from Y angle
-    Quat rotation = Quat::sRotation(JPH::Vec3::sAxisY(), rotation_y);
+static void add_static_body(PhysicsWorldImpl* impl, const Shape* shape, RVec3 position, Quat rotation)
+{
+    BodyInterface& bodyInterface = impl->physicsSystem->GetBodyInterface();
+    BodyCreationSettings settings(shape, position, rotation, EMotionType::Static, Layers::NON_MOVING);
+    Body* body = bodyInterface.CreateBody(settings);
+    bodyInterface.AddBody(body->GetID(), EActivation::DontActivate);
+}
+
+void physics_add_box_obstacle(PhysicsWorld* pw, ::Vec3 pos, ::Vec3 size)
+{
+    if (!pw || !pw->impl) return;
+
+    auto* impl = pw->impl;
+
+    // Inside a static batch the body is built by physics_end_static_batch
+    if (!impl->staticBatchOpen)
+    {
+        ShapeRefC boxShape = create_box_shape(size);
+        if (!boxShape) return;
+        add_static_body(impl, boxShape, RVec3(pos.x, pos.y, pos.z), Quat::sIdentity());
+    }
+
+    impl->statics.push_back({false, pos, size, 0.0f});
+    impl->layoutGeneration++;
+}
+
+void physics_add_ramp_obstacle(PhysicsWorld* pw, ::Vec3 pos, ::Vec3 size, float rotation_y)
+{
+    if (!pw || !pw->impl) return;
+
+    auto* impl = pw->impl;
+
+    if (!impl->staticBatchOpen)
+    {
+        ShapeRefC rampShape = create_ramp_shape(size);
+        if (!rampShape) return;
 
-    BodyCreationSettings rampSettings(rampShape, RVec3(pos.x, pos.y, pos.z),
-        rotation, EMotionType::Static, Layers::NON_MOVING);
+        // Create rotation quaternion from Y angle
+        Quat rotation = Quat::sRotation(JPH::Vec3::sAxisY(), rotation_y);
+        add_static_body(impl, rampShape, RVec3(pos.x, pos.y, pos.z), rotation);
+    }
 
-    Body* ramp = bodyInterface.CreateBody(rampSettings);
-    bodyInterface.AddBody(ramp->GetID(), EActivation::DontActivate);
+    impl->statics.push_back({true, pos, size, rotation_y});
+    impl->layoutGeneration++;
+}
+
+void physics_begin_static_batch(PhysicsWorld* pw)
+{
+    if (!pw || !pw->impl || pw->impl->staticBatchOpen) return;
+
+    pw->impl->staticBatchOpen = true;
+    pw->impl->staticBatchStart = pw->impl->statics.size();
+}
+
+void physics_end_static_batch(PhysicsWorld* pw)
+{
+    if (!pw || !pw->impl || !pw->impl->staticBatchOpen) return;
+
+    auto* impl = pw->impl;
+    impl->staticBatchOpen = false;
+
+    // Every obstacle added since begin becomes a sub-shape at its own
+    // transform, so the compound body itself sits at the origin
+    StaticCompoundShapeSettings compoundSettings;
+    int shapeCount = 0;
+    for (size_t i = impl->staticBatchStart; i < impl->statics.size(); i++)
+    {
+        const StaticGeometryRecord& rec = impl->statics[i];
+        ShapeRefC shape = rec.isRamp ? create_ramp_shape(rec.size) : create_box_shape(rec.size);
+        if (!shape) continue;
+
+        Quat rotation = rec.isRamp ? Quat::sRotation(JPH::Vec3::sAxisY(), rec.rotationY) : Quat::sIdentity();
+        compoundSettings.AddShape(JPH::Vec3(rec.position.x, rec.position.y, rec.position.z), rotation, shape);
+        shapeCount++;
+    }
+
+    if (shapeCount > 0)
+    {
+        ShapeSettings::ShapeResult compoundResult = compoundSettings.Create();
+        if (compoundResult.IsValid()) {
+            add_static_body(impl, compoundResult.Get(), RVec3::sZero(), Quat::sIdentity());
+        } else {
+            std::cerr << "[Jolt] Failed to create static compound: " << compoundResult.GetError() << std::endl;
+        }
+    }
+
+    // Static layout is final: build the broadphase tree once instead of
+    // letting it be incrementally rebalanced during the first steps
+    impl->physicsSystem->OptimizeBroadPhase();
+    std::cout << "[Jolt] Merged " << shapeCount << " static shapes into one body" << std::endl;
 }
 
 void physics_add_arena_walls(PhysicsWorld* pw, float arena_size, float wall_height, float wall_thickness)
@@ -861,13 +1340,46 @@ void physics_add_arena_walls(PhysicsWorld* pw, float arena_size, float wall_heig
     physics_add_box_obstacle(pw, (::Vec3){-half - ht, hh, 0}, (::Vec3){wall_thickness, wall_height, arena_size});
 }
 
+// Grow the vehicle pool (doubling) until it has at least min_capacity slots
+static bool grow_vehicle_pool(PhysicsWorld* pw, int min_capacity)
+{
+    if (min_capacity <= pw->vehicle_capacity) return true;
+    if (min_capacity > MAX_PHYSICS_VEHICLES)
+    {
+        std::cerr << "[Jolt] Vehicle limit reached (" << MAX_PHYSICS_VEHICLES << ")" << std::endl;
+        return false;
+    }
+
+    int new_capacity = pw->vehicle_capacity;
+    while (new_capacity < min_capacity) new_capacity *= 2;
+    if (new_capacity > MAX_PHYSICS_VEHICLES) new_capacity = MAX_PHYSICS_VEHICLES;
+
+    PhysicsVehicle* grown = (PhysicsVehicle*)realloc(pw->vehicles, new_capacity * sizeof(PhysicsVehicle));
+    int* grown_live = (int*)realloc(pw->live_vehicles, new_capacity * sizeof(int));
+    if (grown) pw->vehicles = grown;
+    if (grown_live) pw->live_vehicles = grown_live;
+    if (!grown || !grown_live) return false;
+
+    memset(&pw->vehicles[pw->vehicle_capacity], 0,
+           (new_capacity - pw->vehicle_capacity) * sizeof(PhysicsVehicle));
+    for (int i = pw->vehicle_capacity; i < new_capacity; i++)
+    {
+        pw->vehicles[i].id = i;
+        pw->vehicles[i].live_index = -1;
+    }
+    pw->vehicle_capacity = new_capacity;
+    return true;
+}
+
+static int create_vehicle_in_slot(PhysicsWorld* pw, int slot, ::Vec3 position, float rotation_y, const VehicleConfig* config);
+
 int physics_create_vehicle(PhysicsWorld* pw, ::Vec3 position, float rotation_y, const VehicleConfig* config)
 {
     if (!pw || !pw->impl) return -1;
 
-    // Find free slot
+    // Find free slot, growing the pool when full
     int slot = -1;
-    for (int i = 0; i < MAX_PHYSICS_VEHICLES; i++)
+    for (int i = 0; i < pw->vehicle_capacity; i++)
     {
         if (!pw->vehicles[i].active)
         {
@@ -875,50 +1387,69 @@ int physics_create_vehicle(PhysicsWorld* pw, ::Vec3 position, float rotation_y,
             break;
         }
     }
-    if (slot < 0) return -1;
+    if (slot < 0)
+    {
+        slot = pw->vehicle_capacity;
+        if (!grow_vehicle_pool(pw, slot + 1)) return -1;
+    }
+
+    return create_vehicle_in_slot(pw, slot, position, rotation_y, config);
+}
 
+// Build a vehicle in a specific free slot (forks rebuild vehicles under their original ids)
+static int create_vehicle_in_slot(PhysicsWorld* pw, int slot, ::Vec3 position, float rotation_y, const VehicleConfig* config)
+{
     auto* impl = pw->impl;
     BodyInterface& bodyInterface = impl->physicsSystem->GetBodyInterface();
 
     PhysicsVehicle* v = &pw->vehicles[slot];
     v->active = true;
     v->impl = new PhysicsVehicleImpl();
-    v->config = *config;
-    v->spawn_position = position;
-    v->spawn_rotation = rotation_y;
+    v->cold = new PhysicsVehicleCold();
+    v->cold->config = *config;
+    v->cold->spawn_position = position;
+    v->cold->spawn_rotation = rotation_y;
     v->steering = 0;
     v->throttle = 0;
     v->reverse = 0;
     v->brake = 0;
     v->engine_rpm = 0;
     v->reverse_rpm = 0;
+    v->input_steering = 0;
+    v->input_throttle = 0;
+    v->input_brake = 0;
+    v->input_handbrake = 0;
 
     // Initialize acceleration test state
-    v->accel_test_active = false;
-    v->accel_test_timing_started = false;
-    v->accel_test_elapsed = 0.0f;
-    v->accel_test_print_timer = 0.0f;
-    v->accel_test_start_pos = (::Vec3){0, 0, 0};
-    v->accel_test_last_speed = 0.0f;
+    v->cold->accel_test_active = false;
+    v->cold->accel_test_timing_started = false;
+    v->cold->accel_test_elapsed = 0.0f;
+    v->cold->accel_test_print_timer = 0.0f;
+    v->cold->accel_test_start_pos = (::Vec3){0, 0, 0};
+    v->cold->accel_test_last_speed = 0.0f;
 
     // Reset cruise control
     v->cruise_enabled = false;
     v->cruise_target_ms = 0.0f;
-    v->pending_cruise_active = false;
-    v->pending_cruise_target_ms = 0.0f;
+    v->cold->pending_cruise_active = false;
+    v->cold->pending_cruise_target_ms = 0.0f;
 
     // Initialize handling system with calculated HC
-    handling_init(&v->handling, config->handling_class);
+    handling_init(&v->cold->handling, config->handling_class);
+    if (pw->deterministic)
+    {
+        handling_seed_rng(&v->cold->handling, vehicle_dice_seed(pw->match_seed, slot));
+    }
 
     // Initialize autopilot to idle state
-    memset(&v->autopilot, 0, sizeof(v->autopilot));
-    v->autopilot.state = AUTOPILOT_IDLE;
-
-    // Reset kinematic flag for this slot
-    sVehicleKinematicMode[slot] = false;
+    memset(&v->cold->autopilot, 0, sizeof(v->cold->autopilot));
+    v->cold->autopilot.state = AUTOPILOT_IDLE;
 
     auto* vimpl = v->impl;
 
+    // Reset kinematic flag for this slot
+    vimpl->kinematicMode = false;
+
     // Vehicle dimensions
     float halfLength = config->chassis_length * 0.5f;
     float halfWidth = config->chassis_width * 0.5f;
@@ -1208,7 +1739,10 @@ int physics_create_vehicle(PhysicsWorld* pw, ::Vec3 position, float rotation_y,
     impl->physicsSystem->AddConstraint(vimpl->constraint);
     impl->physicsSystem->AddStepListener(vimpl->constraint);
 
-    pw->vehicle_count++;
+    v->live_index = pw->vehicle_count;
+    pw->live_vehicles[pw->vehicle_count++] = slot;
+    impl->layoutGeneration++;
+    snap_render_state(pw, v);
 
     std::cout << "[Jolt] Created vehicle " << slot << " at ("
               << position.x << ", " << position.y << ", " << position.z << ")" << std::endl;
@@ -1219,10 +1753,8 @@ int physics_create_vehicle(PhysicsWorld* pw, ::Vec3 position, float rotation_y,
 void physics_destroy_vehicle(PhysicsWorld* pw, int vehicle_id)
 {
     if (!pw || !pw->impl) return;
-    if (vehicle_id < 0 || vehicle_id >= MAX_PHYSICS_VEHICLES) return;
-
-    PhysicsVehicle* v = &pw->vehicles[vehicle_id];
-    if (!v->active) return;
+    PhysicsVehicle* v = physics_get_vehicle(pw, vehicle_id);
+    if (!v) return;
 
     auto* impl = pw->impl;
     auto* vimpl = v->impl;
@@ -1241,88 +1773,379 @@ void physics_destroy_vehicle(PhysicsWorld* pw, int vehicle_id)
     }
 
     delete vimpl;
+    delete v->cold;
     v->impl = nullptr;
+    v->cold = nullptr;
     v->active = false;
-    sVehicleKinematicMode[vehicle_id] = false;
-    pw->vehicle_count--;
+
+    // Swap-remove from the dense live list
+    int last = pw->live_vehicles[--pw->vehicle_count];
+    pw->live_vehicles[v->live_index] = last;
+    pw->vehicles[last].live_index = v->live_index;
+    v->live_index = -1;
+    impl->layoutGeneration++;
 }
 
-void physics_vehicle_set_steering(PhysicsWorld* pw, int vehicle_id, float steering)
+PhysicsVehicle* physics_get_vehicle(PhysicsWorld* pw, int vehicle_id)
 {
-    if (!pw || vehicle_id < 0 || vehicle_id >= MAX_PHYSICS_VEHICLES) return;
+    if (!pw || !pw->vehicles || vehicle_id < 0 || vehicle_id >= pw->vehicle_capacity) return nullptr;
     PhysicsVehicle* v = &pw->vehicles[vehicle_id];
-    if (!v->active) return;
+    return v->active ? v : nullptr;
+}
+
+// ========== DETERMINISTIC LOCKSTEP ==========
+
+void physics_set_deterministic(PhysicsWorld* pw, bool enabled, uint64_t match_seed)
+{
+    if (!pw || !pw->impl) return;
+
+    pw->deterministic = enabled;
+    pw->match_seed = match_seed;
+
+    // The setting that orders contacts/constraints. On, Jolt sorts islands
+    // and constraints so results do not depend on job thread count; off
+    // skips that sorting.
+    PhysicsSettings settings = pw->impl->physicsSystem->GetPhysicsSettings();
+    settings.mDeterministicSimulation = enabled;
+    pw->impl->physicsSystem->SetPhysicsSettings(settings);
+
+    // Reseed dice for vehicles that already exist
+    if (enabled)
+    {
+        for (int n = 0; n < pw->vehicle_count; n++)
+        {
+            PhysicsVehicle* v = &pw->vehicles[pw->live_vehicles[n]];
+            handling_seed_rng(&v->cold->handling, vehicle_dice_seed(match_seed, v->id));
+        }
+    }
+
+    pw->state_hash = enabled ? compute_state_hash(pw) : 0;
+
+    std::cout << "[Jolt] Deterministic mode " << (enabled ? "on" : "off")
+              << " (seed " << match_seed << ")" << std::endl;
+}
+
+uint64_t physics_get_state_hash(PhysicsWorld* pw)
+{
+    if (!pw || !pw->impl) return 0;
+    return pw->state_hash;
+}
+
+// ========== SNAPSHOT / REWIND ==========
+
+PhysicsSnapshot* physics_snapshot_create(void)
+{
+    PhysicsSnapshot* snap = new PhysicsSnapshot();
+    snap->valid = false;
+    return snap;
+}
+
+void physics_snapshot_destroy(PhysicsSnapshot* snap)
+{
+    delete snap;
+}
+
+bool physics_save_state(PhysicsWorld* pw, PhysicsSnapshot* snap)
+{
+    if (!pw || !pw->impl || !snap) return false;
+
+    // Jolt side: every body, contact cache and constraint. VehicleConstraint
+    // saves its wheels and controller (engine, transmission, differentials).
+    snap->joltState.Clear();
+    pw->impl->physicsSystem->SaveState(snap->joltState);
+
+    // Our side: control inputs, engine spin-up, cruise, handling, autopilot
+    snap->vehicles.resize(pw->vehicle_count);
+    for (int n = 0; n < pw->vehicle_count; n++)
+    {
+        const PhysicsVehicle* v = &pw->vehicles[pw->live_vehicles[n]];
+        VehicleSnapshot& vs = snap->vehicles[n];
+        vs.id = v->id;
+        vs.hot = *v;
+        vs.cold = *v->cold;
+        vs.kinematicMode = v->impl ? v->impl->kinematicMode : false;
+    }
+
+    snap->accumulator = pw->accumulator;
+    snap->paused = pw->paused;
+    snap->stepIndex = pw->step_index;
+    snap->stateHash = pw->state_hash;
+    snap->valid = true;
+    return true;
+}
+
+bool physics_restore_state(PhysicsWorld* pw, PhysicsSnapshot* snap)
+{
+    if (!pw || !pw->impl || !snap || !snap->valid) return false;
+
+    // Only the same set of vehicles can be restored (no re-creation here)
+    if ((int)snap->vehicles.size() != pw->vehicle_count)
+    {
+        std::cerr << "[Jolt] Restore failed: vehicle count changed ("
+                  << snap->vehicles.size() << " saved, " << pw->vehicle_count << " live)" << std::endl;
+        return false;
+    }
+    for (const VehicleSnapshot& vs : snap->vehicles)
+    {
+        PhysicsVehicle* v = physics_get_vehicle(pw, vs.id);
+        if (!v || !v->impl)
+        {
+            std::cerr << "[Jolt] Restore failed: vehicle " << vs.id << " no longer exists" << std::endl;
+            return false;
+        }
+    }
+
+    snap->joltState.Rewind();
+    if (!pw->impl->physicsSystem->RestoreState(snap->joltState))
+    {
+        std::cerr << "[Jolt] Restore failed: body/constraint layout differs from snapshot" << std::endl;
+        return false;
+    }
+
+    for (const VehicleSnapshot& vs : snap->vehicles)
+    {
+        PhysicsVehicle* v = physics_get_vehicle(pw, vs.id);
+        PhysicsVehicleImpl* vimpl = v->impl;
+        PhysicsVehicleCold* cold = v->cold;
+        int liveIndex = v->live_index;
+
+        *v = vs.hot;
+        v->impl = vimpl;
+        v->cold = cold;
+        v->live_index = liveIndex;
+        *cold = vs.cold;
+        vimpl->kinematicMode = vs.kinematicMode;
+        snap_render_state(pw, v);
+    }
+
+    pw->accumulator = snap->accumulator;
+    pw->paused = snap->paused;
+    pw->step_index = snap->stepIndex;
+    pw->state_hash = snap->stateHash;
+    return true;
+}
+
+// ========== WORLD FORK ==========
+
+PhysicsFork* physics_fork_create(void)
+{
+    PhysicsFork* fork = new PhysicsFork();
+    fork->valid = false;
+    return fork;
+}
+
+void physics_fork_destroy(PhysicsFork* fork)
+{
+    delete fork;
+}
+
+bool physics_fork_capture(PhysicsWorld* src, PhysicsFork* fork)
+{
+    if (!src || !src->impl || !fork) return false;
+
+    auto* impl = src->impl;
+    BodyInterface& bodyInterface = impl->physicsSystem->GetBodyInterface();
+
+    fork->sourceSerial = impl->serial;
+    fork->layoutGeneration = impl->layoutGeneration;
+    fork->hasGround = !impl->groundBodyId.IsInvalid();
+    fork->groundLevel = impl->groundLevel;
+    fork->statics = impl->statics;
+
+    fork->vehicles.resize(src->vehicle_count);
+    for (int n = 0; n < src->vehicle_count; n++)
+    {
+        const PhysicsVehicle* v = &src->vehicles[src->live_vehicles[n]];
+        ForkVehicle& fv = fork->vehicles[n];
+        fv.id = v->id;
+        fv.hot = *v;
+        fv.cold = *v->cold;
+        fv.kinematicMode = v->impl->kinematicMode;
+
+        BodyID id = v->impl->bodyId;
+        fv.position = bodyInterface.GetPosition(id);
+        fv.rotation = bodyInterface.GetRotation(id);
+        fv.linearVelocity = bodyInterface.GetLinearVelocity(id);
+        fv.angularVelocity = bodyInterface.GetAngularVelocity(id);
+        fv.bodyActive = bodyInterface.IsActive(id);
+
+        StateRecorderImpl recorder;
+        v->impl->constraint->SaveState(recorder);
+        fv.constraintState = recorder.GetData();
+    }
+
+    fork->stepSize = src->step_size;
+    fork->accumulator = src->accumulator;
+    fork->paused = src->paused;
+    fork->deterministic = src->deterministic;
+    fork->matchSeed = src->match_seed;
+    fork->stepIndex = src->step_index;
+    fork->stateHash = src->state_hash;
+    fork->valid = true;
+    return true;
+}
+
+bool physics_fork_apply(PhysicsWorld* dst, const PhysicsFork* fork, PhysicsJobPool* pool)
+{
+    if (!dst || !fork || !fork->valid) return false;
+
+    // Rebuild bodies only when the source layout changed since the last apply
+    bool rebuild = !dst->impl ||
+                   dst->impl->forkSourceSerial != fork->sourceSerial ||
+                   dst->impl->forkLayoutGeneration != fork->layoutGeneration;
+    if (rebuild)
+    {
+        bool quiet = dst->quiet;
+        if (dst->impl) physics_destroy(dst);
+        if (!physics_init_with_pool(dst, pool)) return false;
+        dst->quiet = quiet;
+        if (fork->deterministic) physics_set_deterministic(dst, true, fork->matchSeed);
+
+        if (fork->hasGround) physics_set_ground(dst, fork->groundLevel);
+        physics_begin_static_batch(dst);
+        for (const StaticGeometryRecord& rec : fork->statics)
+        {
+            if (rec.isRamp)
+                physics_add_ramp_obstacle(dst, rec.position, rec.size, rec.rotationY);
+            else
+                physics_add_box_obstacle(dst, rec.position, rec.size);
+        }
+        physics_end_static_batch(dst);
+        for (const ForkVehicle& fv : fork->vehicles)
+        {
+            if (!grow_vehicle_pool(dst, fv.id + 1) ||
+                create_vehicle_in_slot(dst, fv.id, fv.cold.spawn_position, fv.cold.spawn_rotation, &fv.cold.config) < 0)
+            {
+                physics_destroy(dst);
+                return false;
+            }
+        }
+
+        dst->impl->forkSourceSerial = fork->sourceSerial;
+        dst->impl->forkLayoutGeneration = fork->layoutGeneration;
+    }
+
+    // Copy state onto the matching bodies and constraints
+    BodyInterface& bodyInterface = dst->impl->physicsSystem->GetBodyInterface();
+    for (const ForkVehicle& fv : fork->vehicles)
+    {
+        PhysicsVehicle* v = physics_get_vehicle(dst, fv.id);
+        PhysicsVehicleImpl* vimpl = v->impl;
+        PhysicsVehicleCold* cold = v->cold;
+        int liveIndex = v->live_index;
+
+        BodyID id = vimpl->bodyId;
+        bodyInterface.SetPositionAndRotation(id, fv.position, fv.rotation, EActivation::DontActivate);
+        bodyInterface.SetLinearAndAngularVelocity(id, fv.linearVelocity, fv.angularVelocity);
+        if (fv.bodyActive)
+            bodyInterface.ActivateBody(id);
+        else
+            bodyInterface.DeactivateBody(id);
+
+        StateRecorderImpl recorder;
+        recorder.WriteBytes(fv.constraintState.data(), fv.constraintState.size());
+        vimpl->constraint->RestoreState(recorder);
+
+        *v = fv.hot;
+        v->impl = vimpl;
+        v->cold = cold;
+        v->live_index = liveIndex;
+        *cold = fv.cold;
+        vimpl->kinematicMode = fv.kinematicMode;
+    }
+
+    dst->step_size = fork->stepSize;
+    dst->accumulator = fork->accumulator;
+    dst->paused = fork->paused;
+    dst->deterministic = fork->deterministic;
+    dst->match_seed = fork->matchSeed;
+    dst->step_index = fork->stepIndex;
+    dst->state_hash = fork->stateHash;
+    return true;
+}
+
+void physics_vehicle_set_steering(PhysicsWorld* pw, int vehicle_id, float steering)
+{
+    PhysicsVehicle* v = physics_get_vehicle(pw, vehicle_id);
+    if (!v) return;
+    v->input_steering = steering;
     v->steering = steering;
 }
 
 void physics_vehicle_set_throttle(PhysicsWorld* pw, int vehicle_id, float throttle)
 {
-    if (!pw || vehicle_id < 0 || vehicle_id >= MAX_PHYSICS_VEHICLES) return;
-    PhysicsVehicle* v = &pw->vehicles[vehicle_id];
-    if (!v->active) return;
+    PhysicsVehicle* v = physics_get_vehicle(pw, vehicle_id);
+    if (!v) return;
+    v->input_throttle = throttle;
     v->throttle = throttle;
 }
 
 void physics_vehicle_set_reverse(PhysicsWorld* pw, int vehicle_id, float reverse)
 {
-    if (!pw || vehicle_id < 0 || vehicle_id >= MAX_PHYSICS_VEHICLES) return;
-    PhysicsVehicle* v = &pw->vehicles[vehicle_id];
-    if (!v->active) return;
+    PhysicsVehicle* v = physics_get_vehicle(pw, vehicle_id);
+    if (!v) return;
     v->reverse = reverse;
 }
 
 void physics_vehicle_set_brake(PhysicsWorld* pw, int vehicle_id, float brake)
 {
-    if (!pw || vehicle_id < 0 || vehicle_id >= MAX_PHYSICS_VEHICLES) return;
-    PhysicsVehicle* v = &pw->vehicles[vehicle_id];
-    if (!v->active) return;
+    PhysicsVehicle* v = physics_get_vehicle(pw, vehicle_id);
+    if (!v) return;
+    v->input_brake = brake;
     v->brake = brake;
 }
 
 void physics_vehicle_set_handbrake(PhysicsWorld* pw, int vehicle_id, float handbrake)
 {
-    if (!pw || vehicle_id < 0 || vehicle_id >= MAX_PHYSICS_VEHICLES) return;
-    PhysicsVehicle* v = &pw->vehicles[vehicle_id];
-    if (!v->active) return;
+    PhysicsVehicle* v = physics_get_vehicle(pw, vehicle_id);
+    if (!v) return;
+    v->input_handbrake = handbrake;
     v->handbrake = handbrake;
 }
 
 void physics_vehicle_set_wheel_brake(PhysicsWorld* pw, int vehicle_id, int wheel_idx, float brake)
 {
-    if (!pw || vehicle_id < 0 || vehicle_id >= MAX_PHYSICS_VEHICLES) return;
     if (wheel_idx < 0 || wheel_idx >= 4) return;
-    PhysicsVehicle* v = &pw->vehicles[vehicle_id];
-    if (!v->active) return;
+    PhysicsVehicle* v = physics_get_vehicle(pw, vehicle_id);
+    if (!v) return;
     v->wheel_brake[wheel_idx] = brake;
     v->use_per_wheel_brake = true;
 }
 
 void physics_vehicle_clear_per_wheel_brake(PhysicsWorld* pw, int vehicle_id)
 {
-    if (!pw || vehicle_id < 0 || vehicle_id >= MAX_PHYSICS_VEHICLES) return;
-    PhysicsVehicle* v = &pw->vehicles[vehicle_id];
-    if (!v->active) return;
+    PhysicsVehicle* v = physics_get_vehicle(pw, vehicle_id);
+    if (!v) return;
     v->use_per_wheel_brake = false;
     for (int i = 0; i < 4; i++) {
         v->wheel_brake[i] = 0.0f;
     }
 }
 
+void physics_vehicle_set_assisted_controls(PhysicsWorld* pw, int vehicle_id, float steering,
+                                           float throttle, float brake, float handbrake)
+{
+    PhysicsVehicle* v = physics_get_vehicle(pw, vehicle_id);
+    if (!v) return;
+    v->steering = steering;
+    v->throttle = throttle;
+    v->brake = brake;
+    v->handbrake = handbrake;
+}
+
 void physics_vehicle_respawn(PhysicsWorld* pw, int vehicle_id)
 {
     if (!pw || !pw->impl) return;
-    if (vehicle_id < 0 || vehicle_id >= MAX_PHYSICS_VEHICLES) return;
-
-    PhysicsVehicle* v = &pw->vehicles[vehicle_id];
-    if (!v->active || !v->impl) return;
+    PhysicsVehicle* v = physics_get_vehicle(pw, vehicle_id);
+    if (!v || !v->impl) return;
 
     auto* impl = pw->impl;
     auto* vimpl = v->impl;
     BodyInterface& bodyInterface = impl->physicsSystem->GetBodyInterface();
 
-    Quat rotation = Quat::sRotation(JPH::Vec3::sAxisY(), v->spawn_rotation);
+    Quat rotation = Quat::sRotation(JPH::Vec3::sAxisY(), v->cold->spawn_rotation);
     bodyInterface.SetPositionAndRotation(vimpl->bodyId,
-        RVec3(v->spawn_position.x, v->spawn_position.y, v->spawn_position.z),
+        RVec3(v->cold->spawn_position.x, v->cold->spawn_position.y, v->cold->spawn_position.z),
         rotation, EActivation::Activate);
     bodyInterface.SetLinearVelocity(vimpl->bodyId, JPH::Vec3::sZero());
     bodyInterface.SetAngularVelocity(vimpl->bodyId, JPH::Vec3::sZero());
@@ -1333,27 +2156,31 @@ void physics_vehicle_respawn(PhysicsWorld* pw, int vehicle_id)
     v->brake = 0;
     v->engine_rpm = 0;
     v->reverse_rpm = 0;
+    v->input_steering = 0;
+    v->input_throttle = 0;
+    v->input_brake = 0;
+    v->input_handbrake = 0;
 
     // Reset acceleration test for new run
-    v->accel_test_active = false;
-    v->accel_test_timing_started = false;
-    v->accel_test_elapsed = 0.0f;
-    v->accel_test_print_timer = 0.0f;
+    v->cold->accel_test_active = false;
+    v->cold->accel_test_timing_started = false;
+    v->cold->accel_test_elapsed = 0.0f;
+    v->cold->accel_test_print_timer = 0.0f;
 
     // Reset cruise control
     v->cruise_enabled = false;
     v->cruise_target_ms = 0.0f;
-    v->pending_cruise_active = false;
-    v->pending_cruise_target_ms = 0.0f;
+    v->cold->pending_cruise_active = false;
+    v->cold->pending_cruise_target_ms = 0.0f;
+
+    snap_render_state(pw, v);
 }
 
 void physics_vehicle_nudge_lateral(PhysicsWorld* pw, int vehicle_id, float offset_meters)
 {
     if (!pw || !pw->impl) return;
-    if (vehicle_id < 0 || vehicle_id >= MAX_PHYSICS_VEHICLES) return;
-
-    PhysicsVehicle* v = &pw->vehicles[vehicle_id];
-    if (!v->active || !v->impl) return;
+    PhysicsVehicle* v = physics_get_vehicle(pw, vehicle_id);
+    if (!v || !v->impl) return;
 
     auto* impl = pw->impl;
     auto* vimpl = v->impl;
@@ -1377,6 +2204,7 @@ void physics_vehicle_nudge_lateral(PhysicsWorld* pw, int vehicle_id, float offse
 
     // Set new position, keeping rotation and velocity
     bodyInterface.SetPosition(vimpl->bodyId, pos, EActivation::Activate);
+    snap_render_state(pw, v);
 
     printf("[Physics] Nudged vehicle %d lateral by %.2fm\n", vehicle_id, offset_meters);
 }
@@ -1384,10 +2212,8 @@ void physics_vehicle_nudge_lateral(PhysicsWorld* pw, int vehicle_id, float offse
 void physics_vehicle_set_heading(PhysicsWorld* pw, int vehicle_id, float heading_radians)
 {
     if (!pw || !pw->impl) return;
-    if (vehicle_id < 0 || vehicle_id >= MAX_PHYSICS_VEHICLES) return;
-
-    PhysicsVehicle* v = &pw->vehicles[vehicle_id];
-    if (!v->active || !v->impl) return;
+    PhysicsVehicle* v = physics_get_vehicle(pw, vehicle_id);
+    if (!v || !v->impl) return;
 
     auto* impl = pw->impl;
     auto* vimpl = v->impl;
@@ -1417,6 +2243,7 @@ void physics_vehicle_set_heading(PhysicsWorld* pw, int vehicle_id, float heading
     bodyInterface.SetPositionAndRotation(vimpl->bodyId, pos, rotation, EActivation::Activate);
     bodyInterface.SetLinearVelocity(vimpl->bodyId, new_vel);
     bodyInterface.SetAngularVelocity(vimpl->bodyId, JPH::Vec3::sZero());
+    snap_render_state(pw, v);
 
     printf("[Physics] Set vehicle %d heading to %.1f° (was %.1f°, delta %.1f°)\n",
            vehicle_id, heading_radians * 180.0f / 3.14159f,
@@ -1426,10 +2253,8 @@ void physics_vehicle_set_heading(PhysicsWorld* pw, int vehicle_id, float heading
 void physics_vehicle_flip(PhysicsWorld* pw, int vehicle_id)
 {
     if (!pw || !pw->impl) return;
-    if (vehicle_id < 0 || vehicle_id >= MAX_PHYSICS_VEHICLES) return;
-
-    PhysicsVehicle* v = &pw->vehicles[vehicle_id];
-    if (!v->active || !v->impl) return;
+    PhysicsVehicle* v = physics_get_vehicle(pw, vehicle_id);
+    if (!v || !v->impl) return;
 
     auto* impl = pw->impl;
     auto* vimpl = v->impl;
@@ -1451,6 +2276,7 @@ void physics_vehicle_flip(PhysicsWorld* pw, int vehicle_id)
     bodyInterface.SetPositionAndRotation(vimpl->bodyId, new_pos, new_rot, EActivation::Activate);
     bodyInterface.SetLinearVelocity(vimpl->bodyId, JPH::Vec3::sZero());
     bodyInterface.SetAngularVelocity(vimpl->bodyId, JPH::Vec3::sZero());
+    snap_render_state(pw, v);
 
     printf("[Physics] Flipped vehicle %d upside down (lifted to y=%.2f)\n",
            vehicle_id, static_cast<float>(new_pos.GetY()));
@@ -1459,44 +2285,37 @@ void physics_vehicle_flip(PhysicsWorld* pw, int vehicle_id)
 void physics_vehicle_set_kinematic(PhysicsWorld* pw, int vehicle_id, bool kinematic)
 {
     if (!pw || !pw->impl) return;
-    if (vehicle_id < 0 || vehicle_id >= MAX_PHYSICS_VEHICLES) return;
-
-    PhysicsVehicle* v = &pw->vehicles[vehicle_id];
-    if (!v->active || !v->impl) return;
+    PhysicsVehicle* v = physics_get_vehicle(pw, vehicle_id);
+    if (!v || !v->impl) return;
 
     // NOTE: We DON'T use Jolt's EMotionType::Kinematic because the
     // WheeledVehicleConstraint doesn't support it (asserts on dynamic type).
     // Instead, we track kinematic state ourselves and skip force application
     // when in kinematic mode, directly setting position/rotation instead.
-    sVehicleKinematicMode[vehicle_id] = kinematic;
+    v->impl->kinematicMode = kinematic;
 
-    if (kinematic) {
-        printf("[Physics] Vehicle %d set to KINEMATIC mode (soft)\n", vehicle_id);
-    } else {
-        printf("[Physics] Vehicle %d set to DYNAMIC mode\n", vehicle_id);
+    if (!pw->quiet) {
+        LOG_DEBUG(LOG_MANEUVER, "[Physics] Vehicle %d set to %s mode", vehicle_id,
+                  kinematic ? "KINEMATIC (soft)" : "DYNAMIC");
     }
 }
 
 bool physics_vehicle_is_kinematic(PhysicsWorld* pw, int vehicle_id)
 {
     if (!pw || !pw->impl) return false;
-    if (vehicle_id < 0 || vehicle_id >= MAX_PHYSICS_VEHICLES) return false;
-
-    PhysicsVehicle* v = &pw->vehicles[vehicle_id];
-    if (!v->active || !v->impl) return false;
+    PhysicsVehicle* v = physics_get_vehicle(pw, vehicle_id);
+    if (!v || !v->impl) return false;
 
     // Check our tracked kinematic state (not Jolt's motion type)
-    return sVehicleKinematicMode[vehicle_id];
+    return v->impl->kinematicMode;
 }
 
 void physics_vehicle_move_kinematic(PhysicsWorld* pw, int vehicle_id,
                                     ::Vec3 target_pos, float target_heading, float dt)
 {
     if (!pw || !pw->impl) return;
-    if (vehicle_id < 0 || vehicle_id >= MAX_PHYSICS_VEHICLES) return;
-
-    PhysicsVehicle* v = &pw->vehicles[vehicle_id];
-    if (!v->active || !v->impl) return;
+    PhysicsVehicle* v = physics_get_vehicle(pw, vehicle_id);
+    if (!v || !v->impl) return;
 
     auto* impl = pw->impl;
     auto* vimpl = v->impl;
@@ -1530,10 +2349,8 @@ void physics_vehicle_move_kinematic(PhysicsWorld* pw, int vehicle_id,
 void physics_vehicle_set_velocity(PhysicsWorld* pw, int vehicle_id, ::Vec3 velocity)
 {
     if (!pw || !pw->impl) return;
-    if (vehicle_id < 0 || vehicle_id >= MAX_PHYSICS_VEHICLES) return;
-
-    PhysicsVehicle* v = &pw->vehicles[vehicle_id];
-    if (!v->active || !v->impl) return;
+    PhysicsVehicle* v = physics_get_vehicle(pw, vehicle_id);
+    if (!v || !v->impl) return;
 
     auto* impl = pw->impl;
     auto* vimpl = v->impl;
@@ -1543,17 +2360,17 @@ void physics_vehicle_set_velocity(PhysicsWorld* pw, int vehicle_id, ::Vec3 veloc
     bodyInterface.SetLinearVelocity(vimpl->bodyId, vel);
     bodyInterface.SetAngularVelocity(vimpl->bodyId, JPH::Vec3::sZero());
 
-    printf("[Physics] Set vehicle %d velocity to (%.1f, %.1f, %.1f) m/s\n",
-           vehicle_id, velocity.x, velocity.y, velocity.z);
+    if (!pw->quiet) {
+        LOG_DEBUG(LOG_PHYSICS, "[Physics] Set vehicle %d velocity to (%.1f, %.1f, %.1f) m/s",
+                  vehicle_id, velocity.x, velocity.y, velocity.z);
+    }
 }
 
 void physics_vehicle_start_accel_test(PhysicsWorld* pw, int vehicle_id)
 {
     if (!pw || !pw->impl) return;
-    if (vehicle_id < 0 || vehicle_id >= MAX_PHYSICS_VEHICLES) return;
-
-    PhysicsVehicle* v = &pw->vehicles[vehicle_id];
-    if (!v->active || !v->impl) return;
+    PhysicsVehicle* v = physics_get_vehicle(pw, vehicle_id);
+    if (!v || !v->impl) return;
 
     auto* impl = pw->impl;
     auto* vimpl = v->impl;
@@ -1565,9 +2382,9 @@ void physics_vehicle_start_accel_test(PhysicsWorld* pw, int vehicle_id)
     float speed = vel.Length();
 
     // If already running, stop and report
-    if (v->accel_test_active) {
+    if (v->cold->accel_test_active) {
         printf("[ACCEL TEST] Test cancelled\n");
-        v->accel_test_active = false;
+        v->cold->accel_test_active = false;
         return;
     }
 
@@ -1576,22 +2393,22 @@ void physics_vehicle_start_accel_test(PhysicsWorld* pw, int vehicle_id)
     v->cruise_target_ms = 0.0f;
 
     // Start the test
-    v->accel_test_active = true;
-    v->accel_test_timing_started = false;  // Wait for throttle before timing
-    v->accel_test_elapsed = 0.0f;
-    v->accel_test_print_timer = 0.0f;
-    v->accel_test_start_pos = (::Vec3){(float)pos.GetX(), (float)pos.GetY(), (float)pos.GetZ()};
-    v->accel_test_last_speed = speed;
+    v->cold->accel_test_active = true;
+    v->cold->accel_test_timing_started = false;  // Wait for throttle before timing
+    v->cold->accel_test_elapsed = 0.0f;
+    v->cold->accel_test_print_timer = 0.0f;
+    v->cold->accel_test_start_pos = (::Vec3){(float)pos.GetX(), (float)pos.GetY(), (float)pos.GetZ()};
+    v->cold->accel_test_last_speed = speed;
 
     // Set target to min(60 mph, top_speed) - some vehicles can't reach 60
     const float SIXTY_MPH_MS = 26.82f;
-    float top_speed = v->config.top_speed_ms;
+    float top_speed = v->cold->config.top_speed_ms;
     if (top_speed > 0.0f && top_speed < SIXTY_MPH_MS) {
-        v->accel_test_target_ms = top_speed;
+        v->cold->accel_test_target_ms = top_speed;
         printf("[ACCEL TEST] Started - floor it! (target: %.0f mph / %.2f m/s - top speed limited)\n",
                top_speed * 2.237f, top_speed);
     } else {
-        v->accel_test_target_ms = SIXTY_MPH_MS;
+        v->cold->accel_test_target_ms = SIXTY_MPH_MS;
         printf("[ACCEL TEST] Started - floor it! (target: 60 mph / 26.82 m/s)\n");
     }
     fflush(stdout);
@@ -1600,10 +2417,8 @@ void physics_vehicle_start_accel_test(PhysicsWorld* pw, int vehicle_id)
 void physics_vehicle_get_position(PhysicsWorld* pw, int vehicle_id, ::Vec3* pos)
 {
     if (!pw || !pw->impl || !pos) return;
-    if (vehicle_id < 0 || vehicle_id >= MAX_PHYSICS_VEHICLES) return;
-
-    PhysicsVehicle* v = &pw->vehicles[vehicle_id];
-    if (!v->active || !v->impl) return;
+    PhysicsVehicle* v = physics_get_vehicle(pw, vehicle_id);
+    if (!v || !v->impl) return;
 
     auto* impl = pw->impl;
     auto* vimpl = v->impl;
@@ -1618,10 +2433,8 @@ void physics_vehicle_get_position(PhysicsWorld* pw, int vehicle_id, ::Vec3* pos)
 void physics_vehicle_get_rotation(PhysicsWorld* pw, int vehicle_id, float* rotation_y)
 {
     if (!pw || !pw->impl || !rotation_y) return;
-    if (vehicle_id < 0 || vehicle_id >= MAX_PHYSICS_VEHICLES) return;
-
-    PhysicsVehicle* v = &pw->vehicles[vehicle_id];
-    if (!v->active || !v->impl) return;
+    PhysicsVehicle* v = physics_get_vehicle(pw, vehicle_id);
+    if (!v || !v->impl) return;
 
     auto* impl = pw->impl;
     auto* vimpl = v->impl;
@@ -1639,10 +2452,8 @@ void physics_vehicle_get_rotation(PhysicsWorld* pw, int vehicle_id, float* rotat
 void physics_vehicle_get_rotation_matrix(PhysicsWorld* pw, int vehicle_id, float* rot_matrix)
 {
     if (!pw || !pw->impl || !rot_matrix) return;
-    if (vehicle_id < 0 || vehicle_id >= MAX_PHYSICS_VEHICLES) return;
-
-    PhysicsVehicle* v = &pw->vehicles[vehicle_id];
-    if (!v->active || !v->impl) return;
+    PhysicsVehicle* v = physics_get_vehicle(pw, vehicle_id);
+    if (!v || !v->impl) return;
 
     auto* impl = pw->impl;
     auto* vimpl = v->impl;
@@ -1660,10 +2471,8 @@ void physics_vehicle_get_rotation_matrix(PhysicsWorld* pw, int vehicle_id, float
 void physics_vehicle_get_velocity(PhysicsWorld* pw, int vehicle_id, float* speed_ms)
 {
     if (!pw || !pw->impl || !speed_ms) return;
-    if (vehicle_id < 0 || vehicle_id >= MAX_PHYSICS_VEHICLES) return;
-
-    PhysicsVehicle* v = &pw->vehicles[vehicle_id];
-    if (!v->active || !v->impl) return;
+    PhysicsVehicle* v = physics_get_vehicle(pw, vehicle_id);
+    if (!v || !v->impl) return;
 
     auto* impl = pw->impl;
     auto* vimpl = v->impl;
@@ -1676,10 +2485,8 @@ void physics_vehicle_get_velocity(PhysicsWorld* pw, int vehicle_id, float* speed
 void physics_vehicle_get_lateral_velocity(PhysicsWorld* pw, int vehicle_id, float* lateral_ms)
 {
     if (!pw || !pw->impl || !lateral_ms) return;
-    if (vehicle_id < 0 || vehicle_id >= MAX_PHYSICS_VEHICLES) return;
-
-    PhysicsVehicle* v = &pw->vehicles[vehicle_id];
-    if (!v->active || !v->impl) return;
+    PhysicsVehicle* v = physics_get_vehicle(pw, vehicle_id);
+    if (!v || !v->impl) return;
 
     auto* impl = pw->impl;
     auto* vimpl = v->impl;
@@ -1706,145 +2513,105 @@ void physics_vehicle_get_lateral_velocity(PhysicsWorld* pw, int vehicle_id, floa
 void physics_vehicle_get_wheel_states(PhysicsWorld* pw, int vehicle_id, WheelState* wheels)
 {
     if (!pw || !wheels) return;
-    if (vehicle_id < 0 || vehicle_id >= MAX_PHYSICS_VEHICLES) return;
-
-    PhysicsVehicle* v = &pw->vehicles[vehicle_id];
-    if (!v->active) return;
+    PhysicsVehicle* v = physics_get_vehicle(pw, vehicle_id);
+    if (!v) return;
 
     memcpy(wheels, v->wheel_states, sizeof(WheelState) * 4);
 }
 
-void physics_debug_draw(PhysicsWorld* pw, struct LineRenderer* lr)
+float physics_get_render_alpha(PhysicsWorld* pw)
 {
-    if (!pw || !pw->impl || !lr) return;
+    if (!pw || pw->step_size <= 0.0f) return 1.0f;
 
-    // Draw ground grid
-    float gridSize = 50.0f;
-    float gridStep = 5.0f;
-    float y = pw->impl->groundLevel + 0.01f;
+    float alpha = pw->accumulator / pw->step_size;
+    if (alpha < 0.0f) alpha = 0.0f;
+    if (alpha > 1.0f) alpha = 1.0f;
+    return alpha;
+}
 
-    for (float x = -gridSize; x <= gridSize; x += gridStep)
-    {
-        line_renderer_draw_line(lr,
-            (::Vec3){x, y, -gridSize}, (::Vec3){x, y, gridSize},
-            (::Vec3){0.3f, 0.5f, 0.3f}, 1.0f);
-        line_renderer_draw_line(lr,
-            (::Vec3){-gridSize, y, x}, (::Vec3){gridSize, y, x},
-            (::Vec3){0.3f, 0.5f, 0.3f}, 1.0f);
+void physics_render_state_blend(const PhysicsRenderState* a, const PhysicsRenderState* b,
+                                float alpha, ::Vec3* pos, float* rot_matrix)
+{
+    if (!a || !b) return;
+
+    if (pos) {
+        pos->x = a->position.x + (b->position.x - a->position.x) * alpha;
+        pos->y = a->position.y + (b->position.y - a->position.y) * alpha;
+        pos->z = a->position.z + (b->position.z - a->position.z) * alpha;
     }
 
-    // Draw vehicles
-    for (int i = 0; i < MAX_PHYSICS_VEHICLES; i++)
-    {
-        PhysicsVehicle* v = &pw->vehicles[i];
-        if (!v->active || !v->impl) continue;
+    if (rot_matrix) {
+        Quat q = load_quat(a->rotation).SLERP(load_quat(b->rotation), alpha);
+        Mat44 rot = Mat44::sRotation(q);
 
-        auto* vimpl = v->impl;
-        auto* impl = pw->impl;
-        BodyInterface& bodyInterface = impl->physicsSystem->GetBodyInterface();
+        // 3x3 row-major, as physics_vehicle_get_rotation_matrix
+        rot_matrix[0] = rot(0, 0); rot_matrix[1] = rot(0, 1); rot_matrix[2] = rot(0, 2);
+        rot_matrix[3] = rot(1, 0); rot_matrix[4] = rot(1, 1); rot_matrix[5] = rot(1, 2);
+        rot_matrix[6] = rot(2, 0); rot_matrix[7] = rot(2, 1); rot_matrix[8] = rot(2, 2);
+    }
+}
 
-        RMat44 transform = bodyInterface.GetWorldTransform(vimpl->bodyId);
-        RVec3 pos = transform.GetTranslation();
+void physics_render_state_blend_wheels(const PhysicsRenderState* a, const PhysicsRenderState* b,
+                                       float alpha, WheelState* wheels)
+{
+    if (!a || !b || !wheels) return;
 
-        // Draw chassis box outline
-        float hw = v->config.chassis_width * 0.5f;
-        float hh = v->config.chassis_height * 0.5f;
-        float hl = v->config.chassis_length * 0.5f;
+    for (int w = 0; w < 4; w++)
+    {
+        ::Vec3 p0 = a->wheel_position[w];
+        ::Vec3 p1 = b->wheel_position[w];
+        ::Vec3 p = {p0.x + (p1.x - p0.x) * alpha,
+                    p0.y + (p1.y - p0.y) * alpha,
+                    p0.z + (p1.z - p0.z) * alpha};
+        wheels[w].position = p;
+
+        // Spin angle wraps, so blend along the shorter way round
+        float spinDelta = remainderf(b->wheel_spin[w] - a->wheel_spin[w], 2.0f * JPH_PI);
+        wheels[w].rotation = a->wheel_spin[w] + spinDelta * alpha;
+
+        Quat q = load_quat(a->wheel_rotation[w]).SLERP(load_quat(b->wheel_rotation[w]), alpha);
+        Mat44 rot = Mat44::sRotation(q);
+
+        // 3x4 column-major, as filled by physics_step
+        wheels[w].rot_matrix[0] = rot(0, 0);
+        wheels[w].rot_matrix[1] = rot(1, 0);
+        wheels[w].rot_matrix[2] = rot(2, 0);
+        wheels[w].rot_matrix[3] = rot(0, 1);
+        wheels[w].rot_matrix[4] = rot(1, 1);
+        wheels[w].rot_matrix[5] = rot(2, 1);
+        wheels[w].rot_matrix[6] = rot(0, 2);
+        wheels[w].rot_matrix[7] = rot(1, 2);
+        wheels[w].rot_matrix[8] = rot(2, 2);
+        wheels[w].rot_matrix[9] = p.x;
+        wheels[w].rot_matrix[10] = p.y;
+        wheels[w].rot_matrix[11] = p.z;
+    }
+}
 
-        ::Vec3 corners[8];
-        ::Vec3 localCorners[8] = {
-            {-hw, -hh, -hl}, {hw, -hh, -hl}, {hw, hh, -hl}, {-hw, hh, -hl},
-            {-hw, -hh, hl}, {hw, -hh, hl}, {hw, hh, hl}, {-hw, hh, hl}
-        };
+void physics_vehicle_get_render_transform(PhysicsWorld* pw, int vehicle_id, float alpha, ::Vec3* pos, float* rot_matrix)
+{
+    if (!pw || !pw->impl) return;
+    PhysicsVehicle* v = physics_get_vehicle(pw, vehicle_id);
+    if (!v || !v->impl) return;
 
-        for (int c = 0; c < 8; c++)
-        {
-            ::Vec3 local = localCorners[c];
-            RVec3 world = transform * JPH::Vec3(local.x, local.y, local.z);
-            corners[c] = (::Vec3){(float)world.GetX(), (float)world.GetY(), (float)world.GetZ()};
-        }
+    physics_render_state_blend(&v->render_prev, &v->render_curr, alpha, pos, rot_matrix);
+}
 
-        ::Vec3 red = {0.8f, 0.2f, 0.2f};
-        ::Vec3 green = {0.2f, 0.8f, 0.2f};
-
-        // Back face (corners 0-3 at z=-hl) - RED
-        line_renderer_draw_line(lr, corners[0], corners[1], red, 1.0f);
-        line_renderer_draw_line(lr, corners[1], corners[2], red, 1.0f);
-        line_renderer_draw_line(lr, corners[2], corners[3], red, 1.0f);
-        line_renderer_draw_line(lr, corners[3], corners[0], red, 1.0f);
-
-        // Front face (corners 4-7 at z=+hl) - GREEN (physics forward)
-        line_renderer_draw_line(lr, corners[4], corners[5], green, 1.0f);
-        line_renderer_draw_line(lr, corners[5], corners[6], green, 1.0f);
-        line_renderer_draw_line(lr, corners[6], corners[7], green, 1.0f);
-        line_renderer_draw_line(lr, corners[7], corners[4], green, 1.0f);
-
-        // Verticals - RED for back, GREEN for front
-        line_renderer_draw_line(lr, corners[0], corners[4], red, 1.0f);
-        line_renderer_draw_line(lr, corners[1], corners[5], red, 1.0f);
-        line_renderer_draw_line(lr, corners[2], corners[6], green, 1.0f);
-        line_renderer_draw_line(lr, corners[3], corners[7], green, 1.0f);
-
-        // Draw forward arrow from center in +Z direction (physics forward)
-        RVec3 center = transform.GetTranslation();
-        JPH::Vec3 localForward(0, 0, hl * 1.5f);  // Arrow extends past front
-        JPH::Vec3 localArrowL(-hw * 0.3f, 0, hl * 1.2f);  // Arrow head left
-        JPH::Vec3 localArrowR(hw * 0.3f, 0, hl * 1.2f);   // Arrow head right
-        RVec3 worldFwd = transform * localForward;
-        RVec3 worldArrowL = transform * localArrowL;
-        RVec3 worldArrowR = transform * localArrowR;
-        ::Vec3 ctr = {(float)center.GetX(), (float)center.GetY(), (float)center.GetZ()};
-        ::Vec3 fwd = {(float)worldFwd.GetX(), (float)worldFwd.GetY(), (float)worldFwd.GetZ()};
-        ::Vec3 arrL = {(float)worldArrowL.GetX(), (float)worldArrowL.GetY(), (float)worldArrowL.GetZ()};
-        ::Vec3 arrR = {(float)worldArrowR.GetX(), (float)worldArrowR.GetY(), (float)worldArrowR.GetZ()};
-        line_renderer_draw_line(lr, ctr, fwd, green, 2.0f);
-        line_renderer_draw_line(lr, fwd, arrL, green, 2.0f);
-        line_renderer_draw_line(lr, fwd, arrR, green, 2.0f);
-
-        // Draw wheels - use stored wheel rotation matrix from Jolt
-        // POC draws cylinder in local X-Z plane with Y as axle direction
-        ::Vec3 blue = {0.2f, 0.2f, 0.8f};
-        for (int w = 0; w < 4; w++)
-        {
-            float radius = v->config.use_per_wheel_config ?
-                v->config.wheel_radii[w] : v->config.wheel_radius;
-
-            // Get wheel world position
-            ::Vec3 wpos = v->wheel_states[w].position;
-
-            // Get wheel orientation from stored rotation matrix
-            // rot_matrix layout: [0-2]=col0(X/right), [3-5]=col1(Y/axle), [6-8]=col2(Z/forward)
-            float* rm = v->wheel_states[w].rot_matrix;
-
-            // Wheel circle is in local X-Z plane (perpendicular to Y axle)
-            // X column = horizontal extent of circle
-            ::Vec3 wheelX = {rm[0], rm[1], rm[2]};
-            // Z column = vertical extent of circle
-            ::Vec3 wheelZ = {rm[6], rm[7], rm[8]};
-
-            // Draw circle: local p = (cos*r, 0, sin*r) transformed to world
-            // world p = pos + cos*r*X_col + sin*r*Z_col
-            const int segments = 16;
-            for (int s = 0; s < segments; s++)
-            {
-                float a1 = (float)s / segments * 2.0f * 3.14159f;
-                float a2 = (float)(s + 1) / segments * 2.0f * 3.14159f;
-
-                ::Vec3 p1 = {
-                    wpos.x + cosf(a1) * radius * wheelX.x + sinf(a1) * radius * wheelZ.x,
-                    wpos.y + cosf(a1) * radius * wheelX.y + sinf(a1) * radius * wheelZ.y,
-                    wpos.z + cosf(a1) * radius * wheelX.z + sinf(a1) * radius * wheelZ.z
-                };
-                ::Vec3 p2 = {
-                    wpos.x + cosf(a2) * radius * wheelX.x + sinf(a2) * radius * wheelZ.x,
-                    wpos.y + cosf(a2) * radius * wheelX.y + sinf(a2) * radius * wheelZ.y,
-                    wpos.z + cosf(a2) * radius * wheelX.z + sinf(a2) * radius * wheelZ.z
-                };
-
-                line_renderer_draw_line(lr, p1, p2, blue, 1.0f);
-            }
-        }
-    }
+void physics_vehicle_get_render_wheel_states(PhysicsWorld* pw, int vehicle_id, float alpha, WheelState* wheels)
+{
+    if (!pw || !pw->impl || !wheels) return;
+    PhysicsVehicle* v = physics_get_vehicle(pw, vehicle_id);
+    if (!v || !v->impl) return;
+
+    // Non-transform fields (slip, contact, ...) come from the latest step
+    memcpy(wheels, v->wheel_states, sizeof(WheelState) * 4);
+    physics_render_state_blend_wheels(&v->render_prev, &v->render_curr, alpha, wheels);
+}
+
+float physics_get_ground_level(PhysicsWorld* pw)
+{
+    if (!pw || !pw->impl) return 0.0f;
+    return pw->impl->groundLevel;
 }
 
 // ========== CRUISE CONTROL ==========
@@ -1862,10 +2629,8 @@ static float mph_to_ms(float mph) {
 void physics_vehicle_cruise_hold(PhysicsWorld* pw, int vehicle_id)
 {
     if (!pw || !pw->impl) return;
-    if (vehicle_id < 0 || vehicle_id >= MAX_PHYSICS_VEHICLES) return;
-
-    PhysicsVehicle* v = &pw->vehicles[vehicle_id];
-    if (!v->active || !v->impl) return;
+    PhysicsVehicle* v = physics_get_vehicle(pw, vehicle_id);
+    if (!v || !v->impl) return;
 
     auto* impl = pw->impl;
     auto* vimpl = v->impl;
@@ -1878,38 +2643,32 @@ void physics_vehicle_cruise_hold(PhysicsWorld* pw, int vehicle_id)
     v->cruise_enabled = true;
     v->cruise_target_ms = speed;
 
-    printf("Cruise: HOLD at %.0f mph (%.1f m/s)\n", ms_to_mph(speed), speed);
-    fflush(stdout);
+    if (!pw->quiet) LOG_INFO(LOG_PHYSICS, "Cruise: HOLD at %.0f mph (%.1f m/s)", ms_to_mph(speed), speed);
 }
 
 void physics_vehicle_cruise_set(PhysicsWorld* pw, int vehicle_id, float target_ms)
 {
     if (!pw || !pw->impl) return;
-    if (vehicle_id < 0 || vehicle_id >= MAX_PHYSICS_VEHICLES) return;
-
-    PhysicsVehicle* v = &pw->vehicles[vehicle_id];
-    if (!v->active || !v->impl) return;
+    PhysicsVehicle* v = physics_get_vehicle(pw, vehicle_id);
+    if (!v || !v->impl) return;
 
     // Clamp to top speed
     float clamped = target_ms;
-    if (v->config.top_speed_ms > 0 && clamped > v->config.top_speed_ms) {
-        clamped = v->config.top_speed_ms;
+    if (v->cold->config.top_speed_ms > 0 && clamped > v->cold->config.top_speed_ms) {
+        clamped = v->cold->config.top_speed_ms;
     }
 
     v->cruise_enabled = true;
     v->cruise_target_ms = clamped;
 
-    printf("Cruise: SET to %.0f mph (%.1f m/s)\n", ms_to_mph(clamped), clamped);
-    fflush(stdout);
+    if (!pw->quiet) LOG_INFO(LOG_PHYSICS, "Cruise: SET to %.0f mph (%.1f m/s)", ms_to_mph(clamped), clamped);
 }
 
 void physics_vehicle_cruise_snap_up(PhysicsWorld* pw, int vehicle_id)
 {
     if (!pw || !pw->impl) return;
-    if (vehicle_id < 0 || vehicle_id >= MAX_PHYSICS_VEHICLES) return;
-
-    PhysicsVehicle* v = &pw->vehicles[vehicle_id];
-    if (!v->active || !v->impl) return;
+    PhysicsVehicle* v = physics_get_vehicle(pw, vehicle_id);
+    if (!v || !v->impl) return;
 
     auto* impl = pw->impl;
     auto* vimpl = v->impl;
@@ -1928,7 +2687,7 @@ void physics_vehicle_cruise_snap_up(PhysicsWorld* pw, int vehicle_id)
     float next_mph = ceilf((base_mph + 0.5f) / 10.0f) * 10.0f;
 
     // Clamp to top speed
-    float top_mph = ms_to_mph(v->config.top_speed_ms);
+    float top_mph = ms_to_mph(v->cold->config.top_speed_ms);
     if (next_mph > top_mph && top_mph > 0) {
         next_mph = top_mph;
     }
@@ -1936,17 +2695,14 @@ void physics_vehicle_cruise_snap_up(PhysicsWorld* pw, int vehicle_id)
     v->cruise_enabled = true;
     v->cruise_target_ms = mph_to_ms(next_mph);
 
-    printf("Cruise: UP to %.0f mph (was %.0f mph)\n", next_mph, base_mph);
-    fflush(stdout);
+    if (!pw->quiet) LOG_INFO(LOG_PHYSICS, "Cruise: UP to %.0f mph (was %.0f mph)", next_mph, base_mph);
 }
 
 void physics_vehicle_cruise_snap_down(PhysicsWorld* pw, int vehicle_id)
 {
     if (!pw || !pw->impl) return;
-    if (vehicle_id < 0 || vehicle_id >= MAX_PHYSICS_VEHICLES) return;
-
-    PhysicsVehicle* v = &pw->vehicles[vehicle_id];
-    if (!v->active || !v->impl) return;
+    PhysicsVehicle* v = physics_get_vehicle(pw, vehicle_id);
+    if (!v || !v->impl) return;
 
     auto* impl = pw->impl;
     auto* vimpl = v->impl;
@@ -1968,33 +2724,27 @@ void physics_vehicle_cruise_snap_down(PhysicsWorld* pw, int vehicle_id)
     v->cruise_enabled = true;
     v->cruise_target_ms = mph_to_ms(prev_mph);
 
-    printf("Cruise: DOWN to %.0f mph (was %.0f mph)\n", prev_mph, base_mph);
-    fflush(stdout);
+    if (!pw->quiet) LOG_INFO(LOG_PHYSICS, "Cruise: DOWN to %.0f mph (was %.0f mph)", prev_mph, base_mph);
 }
 
 void physics_vehicle_cruise_cancel(PhysicsWorld* pw, int vehicle_id)
 {
     if (!pw || !pw->impl) return;
-    if (vehicle_id < 0 || vehicle_id >= MAX_PHYSICS_VEHICLES) return;
-
-    PhysicsVehicle* v = &pw->vehicles[vehicle_id];
-    if (!v->active) return;
+    PhysicsVehicle* v = physics_get_vehicle(pw, vehicle_id);
+    if (!v) return;
 
     if (v->cruise_enabled) {
         v->cruise_enabled = false;
         v->cruise_target_ms = 0;
-        printf("Cruise: OFF\n");
-        fflush(stdout);
+        if (!pw->quiet) LOG_INFO(LOG_PHYSICS, "Cruise: OFF");
     }
 }
 
 bool physics_vehicle_cruise_active(PhysicsWorld* pw, int vehicle_id)
 {
     if (!pw || !pw->impl) return false;
-    if (vehicle_id < 0 || vehicle_id >= MAX_PHYSICS_VEHICLES) return false;
-
-    PhysicsVehicle* v = &pw->vehicles[vehicle_id];
-    if (!v->active) return false;
+    PhysicsVehicle* v = physics_get_vehicle(pw, vehicle_id);
+    if (!v) return false;
 
     return v->cruise_enabled;
 }
@@ -2002,10 +2752,8 @@ bool physics_vehicle_cruise_active(PhysicsWorld* pw, int vehicle_id)
 float physics_vehicle_cruise_target(PhysicsWorld* pw, int vehicle_id)
 {
     if (!pw || !pw->impl) return 0;
-    if (vehicle_id < 0 || vehicle_id >= MAX_PHYSICS_VEHICLES) return 0;
-
-    PhysicsVehicle* v = &pw->vehicles[vehicle_id];
-    if (!v->active) return 0;
+    PhysicsVehicle* v = physics_get_vehicle(pw, vehicle_id);
+    if (!v) return 0;
 
     return v->cruise_target_ms;
 }
@@ -2013,36 +2761,31 @@ float physics_vehicle_cruise_target(PhysicsWorld* pw, int vehicle_id)
 void physics_vehicle_cruise_set_pending(PhysicsWorld* pw, int vehicle_id, float target_ms)
 {
     if (!pw || !pw->impl) return;
-    if (vehicle_id < 0 || vehicle_id >= MAX_PHYSICS_VEHICLES) return;
-
-    PhysicsVehicle* v = &pw->vehicles[vehicle_id];
-    if (!v->active || !v->impl) return;
+    PhysicsVehicle* v = physics_get_vehicle(pw, vehicle_id);
+    if (!v || !v->impl) return;
 
     // Clamp to top speed
     float clamped = target_ms;
-    if (v->config.top_speed_ms > 0 && clamped > v->config.top_speed_ms) {
-        clamped = v->config.top_speed_ms;
+    if (v->cold->config.top_speed_ms > 0 && clamped > v->cold->config.top_speed_ms) {
+        clamped = v->cold->config.top_speed_ms;
     }
 
     // Store as pending - will be applied when maneuver completes
-    v->pending_cruise_active = true;
-    v->pending_cruise_target_ms = clamped;
+    v->cold->pending_cruise_active = true;
+    v->cold->pending_cruise_target_ms = clamped;
 
     // Also set the autopilot's target speed so exit velocity uses it
     // (speed change happens DURING the turn, not after)
-    v->autopilot.target_speed_ms = clamped;
+    v->cold->autopilot.target_speed_ms = clamped;
 
-    printf("Cruise: PENDING %.0f mph (speed changes during turn)\n", ms_to_mph(clamped));
-    fflush(stdout);
+    if (!pw->quiet) LOG_INFO(LOG_PHYSICS, "Cruise: PENDING %.0f mph (speed changes during turn)", ms_to_mph(clamped));
 }
 
 void physics_vehicle_get_traction_info(PhysicsWorld* pw, int vehicle_id, float* force_n, float* traction)
 {
     if (!pw || !pw->impl) return;
-    if (vehicle_id < 0 || vehicle_id >= MAX_PHYSICS_VEHICLES) return;
-
-    PhysicsVehicle* v = &pw->vehicles[vehicle_id];
-    if (!v->active) return;
+    PhysicsVehicle* v = physics_get_vehicle(pw, vehicle_id);
+    if (!v) return;
 
     if (force_n) *force_n = v->last_applied_force;
     if (traction) *traction = v->last_traction;
@@ -2051,22 +2794,18 @@ void physics_vehicle_get_traction_info(PhysicsWorld* pw, int vehicle_id, float*
 void physics_vehicle_get_handling(PhysicsWorld* pw, int vehicle_id, int* hs, int* hc)
 {
     if (!pw || !pw->impl) return;
-    if (vehicle_id < 0 || vehicle_id >= MAX_PHYSICS_VEHICLES) return;
+    PhysicsVehicle* v = physics_get_vehicle(pw, vehicle_id);
+    if (!v) return;
 
-    PhysicsVehicle* v = &pw->vehicles[vehicle_id];
-    if (!v->active) return;
-
-    if (hs) *hs = v->handling.handling_status;
-    if (hc) *hc = v->handling.handling_class;
+    if (hs) *hs = v->cold->handling.handling_status;
+    if (hc) *hc = v->cold->handling.handling_class;
 }
 
 void physics_vehicle_get_drivetrain_info(PhysicsWorld* pw, int vehicle_id, int* gear, float* rpm, int* raw_gear, bool* is_matchbox)
 {
     if (!pw || !pw->impl) return;
-    if (vehicle_id < 0 || vehicle_id >= MAX_PHYSICS_VEHICLES) return;
-
-    PhysicsVehicle* v = &pw->vehicles[vehicle_id];
-    if (!v->active || !v->impl) {
+    PhysicsVehicle* v = physics_get_vehicle(pw, vehicle_id);
+    if (!v || !v->impl) {
         if (gear) *gear = 0;
         if (rpm) *rpm = 0.0f;
         if (raw_gear) *raw_gear = 0;
@@ -2076,7 +2815,7 @@ void physics_vehicle_get_drivetrain_info(PhysicsWorld* pw, int vehicle_id, int*
 
     // Report if matchbox mode is active (wheels unpowered, no real drivetrain)
     if (is_matchbox) {
-        *is_matchbox = v->config.use_linear_accel;
+        *is_matchbox = v->cold->config.use_linear_accel;
     }
 
     PhysicsVehicleImpl* vimpl = v->impl;
@@ -2115,16 +2854,14 @@ void physics_pause(PhysicsWorld* pw)
 {
     if (!pw) return;
     pw->paused = true;
-    printf("[Physics] World PAUSED\n");
-    fflush(stdout);
+    if (!pw->quiet) LOG_INFO(LOG_PHYSICS, "[Physics] World PAUSED");
 }
 
 void physics_unpause(PhysicsWorld* pw)
 {
     if (!pw) return;
     pw->paused = false;
-    printf("[Physics] World UNPAUSED\n");
-    fflush(stdout);
+    if (!pw->quiet) LOG_INFO(LOG_PHYSICS, "[Physics] World UNPAUSED");
 }
 
 bool physics_is_paused(PhysicsWorld* pw)
@@ -2150,10 +2887,8 @@ bool physics_vehicle_start_maneuver_ex(PhysicsWorld* pw, int vehicle_id,
                                        const ManeuverRequest* request)
 {
     if (!pw || !pw->impl) return false;
-    if (vehicle_id < 0 || vehicle_id >= MAX_PHYSICS_VEHICLES) return false;
-
-    PhysicsVehicle* v = &pw->vehicles[vehicle_id];
-    if (!v->active || !v->impl) return false;
+    PhysicsVehicle* v = physics_get_vehicle(pw, vehicle_id);
+    if (!v || !v->impl) return false;
 
     auto* impl = pw->impl;
     auto* vimpl = v->impl;
@@ -2172,18 +2907,20 @@ bool physics_vehicle_start_maneuver_ex(PhysicsWorld* pw, int vehicle_id,
     float currentHeading = atan2f(fwd.GetX(), fwd.GetZ());
 
     // Start the maneuver
-    bool success = maneuver_start(&v->autopilot, request, currentPos, currentHeading, speed);
+    v->cold->autopilot.quiet = pw->quiet;
+    v->cold->handling.quiet = pw->quiet;
+    bool success = maneuver_start(&v->cold->autopilot, request, currentPos, currentHeading, speed);
 
     if (success) {
         // Reset handling status at start of new turn
-        handling_reset_turn(&v->handling);
+        handling_reset_turn(&v->cold->handling);
 
         // Apply handling difficulty
         int difficulty = maneuver_get_difficulty(request->type, request->direction,
                                                   request->bend_angle > 0 ? request->bend_angle : request->skid_distance);
-        ControlResult result = handling_apply_maneuver(&v->handling, difficulty);
+        ControlResult result = handling_apply_maneuver(&v->cold->handling, difficulty);
 
-        if (result == CONTROL_ROLL_FAILED) {
+        if (result == CONTROL_ROLL_FAILED && !pw->quiet) {
             // Maneuver failed - need to handle crash table
             // For now, just log it - crash table implementation comes later
             printf("[Maneuver] Control roll FAILED - crash table needed (not implemented)\n");
@@ -2201,11 +2938,9 @@ bool physics_vehicle_start_turn(PhysicsWorld* pw, int vehicle_id,
                                 int num_phases)
 {
     if (!pw || !pw->impl) return false;
-    if (vehicle_id < 0 || vehicle_id >= MAX_PHYSICS_VEHICLES) return false;
     if (num_phases < 1 || num_phases > MAX_TURN_PHASES) return false;
-
-    PhysicsVehicle* v = &pw->vehicles[vehicle_id];
-    if (!v->active || !v->impl) return false;
+    PhysicsVehicle* v = physics_get_vehicle(pw, vehicle_id);
+    if (!v || !v->impl) return false;
 
     auto* impl = pw->impl;
     auto* vimpl = v->impl;
@@ -2224,12 +2959,14 @@ bool physics_vehicle_start_turn(PhysicsWorld* pw, int vehicle_id,
     float currentHeading = atan2f(fwd.GetX(), fwd.GetZ());
 
     // Start the multi-phase turn
-    bool success = maneuver_start_turn(&v->autopilot, phase_indices, requests,
+    v->cold->autopilot.quiet = pw->quiet;
+    v->cold->handling.quiet = pw->quiet;
+    bool success = maneuver_start_turn(&v->cold->autopilot, phase_indices, requests,
                                         num_phases, currentPos, currentHeading, speed);
 
     if (success) {
         // Reset handling status at start of new turn
-        handling_reset_turn(&v->handling);
+        handling_reset_turn(&v->cold->handling);
 
         // Apply handling difficulty for each phase
         for (int i = 0; i < num_phases; i++) {
@@ -2240,8 +2977,8 @@ bool physics_vehicle_start_turn(PhysicsWorld* pw, int vehicle_id,
                 requests[i].bend_angle > 0 ? requests[i].bend_angle : requests[i].skid_distance);
 
             if (difficulty > 0) {
-                ControlResult result = handling_apply_maneuver(&v->handling, difficulty);
-                if (result == CONTROL_ROLL_FAILED) {
+                ControlResult result = handling_apply_maneuver(&v->cold->handling, difficulty);
+                if (result == CONTROL_ROLL_FAILED && !pw->quiet) {
                     printf("[Turn] P%d control roll FAILED - crash table needed\n", phase_indices[i] + 1);
                     fflush(stdout);
                     // Continue anyway for testing
@@ -2256,34 +2993,28 @@ bool physics_vehicle_start_turn(PhysicsWorld* pw, int vehicle_id,
 void physics_vehicle_cancel_maneuver(PhysicsWorld* pw, int vehicle_id)
 {
     if (!pw) return;
-    if (vehicle_id < 0 || vehicle_id >= MAX_PHYSICS_VEHICLES) return;
+    PhysicsVehicle* v = physics_get_vehicle(pw, vehicle_id);
+    if (!v) return;
 
-    PhysicsVehicle* v = &pw->vehicles[vehicle_id];
-    if (!v->active) return;
-
-    maneuver_cancel(&v->autopilot);
+    maneuver_cancel(&v->cold->autopilot);
 }
 
 bool physics_vehicle_maneuver_active(PhysicsWorld* pw, int vehicle_id)
 {
     if (!pw) return false;
-    if (vehicle_id < 0 || vehicle_id >= MAX_PHYSICS_VEHICLES) return false;
-
-    PhysicsVehicle* v = &pw->vehicles[vehicle_id];
-    if (!v->active) return false;
+    PhysicsVehicle* v = physics_get_vehicle(pw, vehicle_id);
+    if (!v) return false;
 
-    return maneuver_is_active(&v->autopilot);
+    return maneuver_is_active(&v->cold->autopilot);
 }
 
 const ManeuverAutopilot* physics_vehicle_get_autopilot(PhysicsWorld* pw, int vehicle_id)
 {
     if (!pw) return nullptr;
-    if (vehicle_id < 0 || vehicle_id >= MAX_PHYSICS_VEHICLES) return nullptr;
-
-    PhysicsVehicle* v = &pw->vehicles[vehicle_id];
-    if (!v->active) return nullptr;
+    PhysicsVehicle* v = physics_get_vehicle(pw, vehicle_id);
+    if (!v) return nullptr;
 
-    return &v->autopilot;
+    return &v->cold->autopilot;
 }
 
 } // extern "C"
@@ -7,12 +7,15 @@
 #define JOLT_PHYSICS_H
 
 #include <stdbool.h>
+#include <stdint.h>
 #include "../math/vec3.h"
 #include "../game/handling.h"
 #include "../game/maneuver.h"
 
-// Maximum vehicles in physics world
-#define MAX_PHYSICS_VEHICLES 8
+// Maximum vehicles in physics world (hard cap on vehicle ids)
+#define MAX_PHYSICS_VEHICLES 256
+// Initial vehicle pool size (doubles when full)
+#define PHYSICS_VEHICLE_POOL_INITIAL 16
 
 // Wheel indices
 #define WHEEL_FL 0  // Front Left
@@ -124,25 +127,19 @@ typedef struct {
 struct PhysicsWorldImpl;
 struct PhysicsVehicleImpl;
 
-// Physics vehicle handle
+// Chassis and wheel transforms at the end of one fixed step. The last two are
+// kept so rendering can interpolate between them (see physics_get_render_alpha).
+typedef struct {
+    Vec3 position;
+    float rotation[4];            // Chassis quaternion (x, y, z, w)
+    Vec3 wheel_position[4];
+    float wheel_rotation[4][4];   // Wheel world quaternions (x, y, z, w)
+    float wheel_spin[4];          // Wheel spin angle (radians)
+} PhysicsRenderState;
+
+// Cold per-vehicle data: configuration and bookkeeping that the per-step
+// loop rarely touches. Allocated once per vehicle so pointers stay stable.
 typedef struct {
-    int id;
-    bool active;
-
-    struct PhysicsVehicleImpl* impl;
-
-    // Current state
-    WheelState wheel_states[4];
-    float steering;          // Current steering input (-1 to 1)
-    float throttle;          // Current throttle (0 to 1)
-    float reverse;           // Current reverse (0 to 1)
-    float brake;             // Current brake (0 to 1)
-    float wheel_brake[4];    // Per-wheel brake (0 to 1), for ABS control
-    bool use_per_wheel_brake; // If true, use wheel_brake[] instead of brake
-    float handbrake;         // Handbrake (0 to 1), affects handbrake axles only
-    float engine_rpm;        // Engine spin-up state (0-1): ramps up 1.5s, decays 3s
-    float reverse_rpm;       // Reverse engine state (0-1): same behavior
-
     // Spawn state (for respawn)
     Vec3 spawn_position;
     float spawn_rotation;
@@ -159,36 +156,84 @@ typedef struct {
     float accel_test_last_speed;
     float accel_test_target_ms;  // Target speed in m/s (min of 60mph or top_speed)
 
-    // Cruise control state
-    bool cruise_enabled;         // Is cruise control active?
-    float cruise_target_ms;      // Target speed in m/s
-
     // Pending cruise (deferred until maneuver completes)
     bool pending_cruise_active;  // Is there a pending cruise change?
     float pending_cruise_target_ms; // Deferred target speed
 
-    // Debug: last applied force (for status bar display)
-    float last_applied_force;    // Force in Newtons applied this frame
-    float last_traction;         // Traction factor (0-1, wheels on ground)
-
     // tabletop handling state (runtime)
     VehicleHandling handling;    // HC/HS tracking and control rolls
 
     // Maneuver autopilot (for executing tabletop maneuvers via physics)
     ManeuverAutopilot autopilot;
+} PhysicsVehicleCold;
+
+// Physics vehicle handle (hot per-step state, stored contiguously in the pool)
+typedef struct {
+    int id;
+    bool active;
+    int live_index;          // Position in PhysicsWorld.live_vehicles (-1 if free)
+
+    struct PhysicsVehicleImpl* impl;
+    PhysicsVehicleCold* cold;
+
+    // Current state
+    WheelState wheel_states[4];
+    float steering;          // Current steering input (-1 to 1)
+    float throttle;          // Current throttle (0 to 1)
+    float reverse;           // Current reverse (0 to 1)
+    float brake;             // Current brake (0 to 1)
+    float wheel_brake[4];    // Per-wheel brake (0 to 1), for ABS control
+    bool use_per_wheel_brake; // If true, use wheel_brake[] instead of brake
+    float handbrake;         // Handbrake (0 to 1), affects handbrake axles only
+
+    // Driver input as last set by physics_vehicle_set_*. Scripts filter this
+    // every step; the fields above hold the result (see
+    // physics_vehicle_set_assisted_controls), so assists never compound.
+    float input_steering;
+    float input_throttle;
+    float input_brake;
+    float input_handbrake;
+
+    float engine_rpm;        // Engine spin-up state (0-1): ramps up 1.5s, decays 3s
+    float reverse_rpm;       // Reverse engine state (0-1): same behavior
+
+    // Cruise control state
+    bool cruise_enabled;         // Is cruise control active?
+    float cruise_target_ms;      // Target speed in m/s
+
+    // Debug: last applied force (for status bar display)
+    float last_applied_force;    // Force in Newtons applied this frame
+    float last_traction;         // Traction factor (0-1, wheels on ground)
+
+    // Transforms after the previous and the latest fixed step (written every step)
+    PhysicsRenderState render_prev;
+    PhysicsRenderState render_curr;
 } PhysicsVehicle;
 
 // Physics world
 typedef struct {
     struct PhysicsWorldImpl* impl;
 
-    PhysicsVehicle vehicles[MAX_PHYSICS_VEHICLES];
+    // Vehicle pool: slots are indexed by vehicle id and grow on demand
+    // (up to MAX_PHYSICS_VEHICLES). Ids stay stable; freed slots are reused.
+    PhysicsVehicle* vehicles;
+    int vehicle_capacity;
+
+    // Dense list of live vehicle ids - iterate this instead of scanning slots
+    int* live_vehicles;
     int vehicle_count;
 
     float step_size;         // Physics timestep
     float accumulator;       // Time accumulator for fixed timestep
 
     bool paused;             // World paused (for turn-based, maneuver setup)
+    bool quiet;              // No console output (prediction worlds the player never sees)
+
+    // Deterministic lockstep (see physics_set_deterministic)
+    bool deterministic;      // Pinned solver settings, seeded dice, per-step state hash
+    uint64_t match_seed;     // Seeds every vehicle's handling dice
+    uint64_t step_index;     // Fixed steps taken since init
+    uint64_t state_hash;     // Hash of body + vehicle state after the last step
 } PhysicsWorld;
 
 #ifdef __cplusplus
@@ -200,17 +245,78 @@ bool physics_init(PhysicsWorld* pw);
 void physics_destroy(PhysicsWorld* pw);
 void physics_step(PhysicsWorld* pw, float dt);
 
+// Hook run inside physics_step once per fixed substep, before vehicle inputs
+// are applied (dt is step_size). Controllers installed here act at the physics
+// rate however many substeps a frame takes. NULL removes it; not copied by forks.
+typedef void (*PhysicsPreStepCallback)(PhysicsWorld* pw, float dt, void* user_data);
+void physics_set_pre_step_callback(PhysicsWorld* pw, PhysicsPreStepCallback callback, void* user_data);
+
+// Run fn(index, user_data) for every index in [0, count) as jobs on pw's job
+// system (its pool's, if shared) and wait for all of them. The caller helps
+// run jobs while it waits. Use outside Jolt's update, e.g. from the pre-step hook.
+typedef void (*PhysicsParallelFn)(int index, void* user_data);
+void physics_parallel_for(PhysicsWorld* pw, int count, PhysicsParallelFn fn, void* user_data);
+
+// Batch simulation - many independent worlds stepped concurrently
+// Worlds created with physics_init_with_pool share the pool's worker threads
+// instead of each spawning their own. A NULL pool behaves like physics_init.
+typedef struct PhysicsJobPool PhysicsJobPool;
+PhysicsJobPool* physics_job_pool_create(int thread_count);  // -1 = hardware threads - 1
+void physics_job_pool_destroy(PhysicsJobPool* pool);        // Destroy worlds using it first
+bool physics_init_with_pool(PhysicsWorld* pw, PhysicsJobPool* pool);
+// Advance every world by dt in parallel (one job per world); returns when all are done
+void physics_step_batch(PhysicsJobPool* pool, PhysicsWorld** worlds, int world_count, float dt);
+
+// Deterministic lockstep
+// Same scene, creation order, per-step inputs and seed give bit-identical steps
+// (across machines too when built with ARENA_CROSS_PLATFORM_DETERMINISTIC).
+// Call after physics_init, before adding bodies and vehicles.
+void physics_set_deterministic(PhysicsWorld* pw, bool enabled, uint64_t match_seed);
+// 64-bit hash of all body and vehicle state after the last fixed step (0 when off).
+// Peers compare this once per step to detect desync.
+uint64_t physics_get_state_hash(PhysicsWorld* pw);
+
+// Snapshot / rewind
+// Captures the whole world in memory: Jolt bodies and constraints (including
+// vehicle wheel, engine and transmission state), vehicle controls, handling and
+// autopilot. Restoring requires the same bodies and vehicles to still exist.
+typedef struct PhysicsSnapshot PhysicsSnapshot;
+PhysicsSnapshot* physics_snapshot_create(void);
+void physics_snapshot_destroy(PhysicsSnapshot* snap);
+bool physics_save_state(PhysicsWorld* pw, PhysicsSnapshot* snap);     // Reuses snap's buffers
+bool physics_restore_state(PhysicsWorld* pw, PhysicsSnapshot* snap);  // False if layout changed
+
+// World fork - a self-contained copy of a world's layout and state.
+// Capture on the thread that owns the source world, then apply into a separate
+// PhysicsWorld (e.g. on a worker thread). Apply rebuilds the destination's bodies
+// only when the source layout changed, otherwise it just copies state across.
+typedef struct PhysicsFork PhysicsFork;
+PhysicsFork* physics_fork_create(void);
+void physics_fork_destroy(PhysicsFork* fork);
+bool physics_fork_capture(PhysicsWorld* src, PhysicsFork* fork);
+// dst must be zeroed or a world previously used with physics_fork_apply
+bool physics_fork_apply(PhysicsWorld* dst, const PhysicsFork* fork, PhysicsJobPool* pool);
+
 // Ground/arena setup
 void physics_set_ground(PhysicsWorld* pw, float y_level);
 void physics_add_box_obstacle(PhysicsWorld* pw, Vec3 pos, Vec3 size);
 void physics_add_ramp_obstacle(PhysicsWorld* pw, Vec3 pos, Vec3 size, float rotation_y);  // size: x=width, y=height, z=length
 void physics_add_arena_walls(PhysicsWorld* pw, float arena_size, float wall_height, float wall_thickness);
+float physics_get_ground_level(PhysicsWorld* pw);
+
+// Scene-build mode: box/ramp/wall obstacles added between begin and end are
+// merged into a single static compound body, and the broadphase is optimized
+// once at the end. Keeps collision cost flat as arenas grow.
+void physics_begin_static_batch(PhysicsWorld* pw);
+void physics_end_static_batch(PhysicsWorld* pw);
 
 // Vehicle management
 int physics_create_vehicle(PhysicsWorld* pw, Vec3 position, float rotation_y, const VehicleConfig* config);
 void physics_destroy_vehicle(PhysicsWorld* pw, int vehicle_id);
+// Live vehicle by id, or NULL if the id is out of range or the slot is free
+PhysicsVehicle* physics_get_vehicle(PhysicsWorld* pw, int vehicle_id);
 
-// Vehicle control
+// Vehicle control (driver input: sets both the input and the effective control)
 void physics_vehicle_set_steering(PhysicsWorld* pw, int vehicle_id, float steering);  // -1 to 1
 void physics_vehicle_set_throttle(PhysicsWorld* pw, int vehicle_id, float throttle);  // 0 to 1
 void physics_vehicle_set_reverse(PhysicsWorld* pw, int vehicle_id, float reverse);    // 0 to 1
@@ -218,6 +324,9 @@ void physics_vehicle_set_brake(PhysicsWorld* pw, int vehicle_id, float brake);
 void physics_vehicle_set_handbrake(PhysicsWorld* pw, int vehicle_id, float handbrake); // 0 to 1 (affects handbrake axles)
 void physics_vehicle_set_wheel_brake(PhysicsWorld* pw, int vehicle_id, int wheel_idx, float brake); // Per-wheel brake for ABS
 void physics_vehicle_clear_per_wheel_brake(PhysicsWorld* pw, int vehicle_id);  // Disable per-wheel mode, use global brake
+// Script output: effective controls only, the driver input is kept for the next step
+void physics_vehicle_set_assisted_controls(PhysicsWorld* pw, int vehicle_id, float steering,
+                                           float throttle, float brake, float handbrake);
 void physics_vehicle_respawn(PhysicsWorld* pw, int vehicle_id);  // Reset to spawn position
 void physics_vehicle_start_accel_test(PhysicsWorld* pw, int vehicle_id);  // Start 0-60 acceleration test
 
@@ -242,6 +351,23 @@ void physics_vehicle_get_traction_info(PhysicsWorld* pw, int vehicle_id, float*
 void physics_vehicle_get_handling(PhysicsWorld* pw, int vehicle_id, int* hs, int* hc);  // Current HS and base HC
 void physics_vehicle_get_drivetrain_info(PhysicsWorld* pw, int vehicle_id, int* gear, float* rpm, int* raw_gear, bool* is_matchbox);  // Drivetrain debug
 
+// Interpolated render state. Rendering lags physics by up to one step and
+// blends the last two steps by alpha, so motion stays smooth at any frame
+// rate independent of step_size.
+// Fraction of a step left in the accumulator (0-1)
+float physics_get_render_alpha(PhysicsWorld* pw);
+// Chassis position and 3x3 row-major rotation (same layout as get_rotation_matrix)
+void physics_vehicle_get_render_transform(PhysicsWorld* pw, int vehicle_id, float alpha, Vec3* pos, float* rot_matrix);
+// Wheel states with position, spin and rot_matrix interpolated
+void physics_vehicle_get_render_wheel_states(PhysicsWorld* pw, int vehicle_id, float alpha, WheelState* wheels);
+// Blend two captured render states directly (e.g. copies handed to another
+// thread). Same output layouts as above; pos/rot_matrix may be NULL. wheels
+// must hold the latest wheel states - only their pose fields are replaced.
+void physics_render_state_blend(const PhysicsRenderState* prev, const PhysicsRenderState* curr,
+                                float alpha, Vec3* pos, float* rot_matrix);
+void physics_render_state_blend_wheels(const PhysicsRenderState* prev, const PhysicsRenderState* curr,
+                                       float alpha, WheelState* wheels);
+
 // World pause/unpause (for turn-based and maneuver execution)
 void physics_pause(PhysicsWorld* pw);
 void physics_unpause(PhysicsWorld* pw);
@@ -284,10 +410,6 @@ void physics_vehicle_set_heading(PhysicsWorld* pw, int vehicle_id, float heading
 // Debug: flip vehicle upside down (for testing physics behavior)
 void physics_vehicle_flip(PhysicsWorld* pw, int vehicle_id);
 
-// Debug visualization - call between line_renderer_begin/end
-struct LineRenderer;  // Forward declare
-void physics_debug_draw(PhysicsWorld* pw, struct LineRenderer* lr);
-
 #ifdef __cplusplus
 }
 #endif
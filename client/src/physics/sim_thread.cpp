@@ -0,0 +1,459 @@
+/*
+ * Simulation Thread Implementation
+ *
+ * Commands and particle spawns travel through single-producer single-consumer
+ * rings (main -> sim and sim -> main), so neither side takes a lock per frame.
+ * Frames use the classic triple buffer: the sim writes the back buffer and
+ * exchanges it with the middle one (flagged dirty); the main thread exchanges
+ * its front buffer with the middle one only when it is dirty. Each side always
+ * owns one buffer outright, so a frame is never torn or waited on.
+ *
+ * The mutex is only taken to sleep between ticks and by sim_thread_call.
+ */
+
+#include "sim_thread.h"
+#include "../util/profiler.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+// Middle buffer index flag: published but not yet acquired
+#define SIM_FRAME_DIRTY 4u
+
+// Ticks the sim may fall behind before it stops trying to catch up
+#define SIM_MAX_LAG_STEPS 5
+
+typedef std::chrono::steady_clock SimClock;
+
+typedef enum {
+    SIM_CMD_CONTROLS,
+    SIM_CMD_WATCH_TURN,
+    SIM_CMD_CALL
+} SimCommandType;
+
+typedef struct {
+    SimCommandType type;
+    int vehicleId;
+    float throttle;
+    float reverse;
+    float brake;
+    float steering;
+    SimCallFn fn;
+    void* user;
+    uint64_t callId;
+} SimCommand;
+
+typedef struct {
+    char effect[SIM_EFFECT_NAME_MAX];
+    float x, y, z;
+    float intensity;
+} SimParticle;
+
+// Bounded single-producer single-consumer ring (N is a power of two)
+template <typename T, uint32_t N>
+struct SpscRing
+{
+    T items[N];
+    alignas(64) std::atomic<uint32_t> head{0};  // Next write (producer only)
+    alignas(64) std::atomic<uint32_t> tail{0};  // Next read (consumer only)
+
+    bool push(const T& item)
+    {
+        uint32_t h = head.load(std::memory_order_relaxed);
+        if (h - tail.load(std::memory_order_acquire) == N) return false;
+        items[h & (N - 1)] = item;
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool pop(T* out)
+    {
+        uint32_t t = tail.load(std::memory_order_relaxed);
+        if (t == head.load(std::memory_order_acquire)) return false;
+        *out = items[t & (N - 1)];
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+};
+
+struct SimThread
+{
+    PhysicsWorld* pw;
+    ReflexScriptEngine* engine;
+    std::thread thread;
+    SimClock::time_point epoch;
+
+    SpscRing<SimCommand, SIM_COMMAND_QUEUE_SIZE> commands;
+    SpscRing<SimParticle, SIM_PARTICLE_QUEUE_SIZE> particles;
+
+    // Triple buffer
+    SimFrame* frames;                   // [3]
+    std::atomic<uint32_t> middle;       // Index | SIM_FRAME_DIRTY
+    uint32_t back;                      // Sim-owned
+    uint32_t front;                     // Main-owned
+
+    // Sim-owned
+    uint64_t sequence;
+    double stepTime;        // Sim clock when the last step was published
+    uint32_t turnsCompleted;
+    int turnWatchId;
+
+    // Sleep/wake and blocking calls (guarded by mutex)
+    std::mutex mutex;
+    std::condition_variable wakeCv;
+    std::condition_variable doneCv;
+    bool wake;
+    bool quit;
+    uint64_t callsDone;
+
+    // Main-owned
+    uint64_t callsIssued;
+};
+
+static double sim_clock_seconds(const SimThread* st)
+{
+    return std::chrono::duration<double>(SimClock::now() - st->epoch).count();
+}
+
+static void fill_vehicle_state(PhysicsWorld* pw, PhysicsVehicle* v, SimVehicleState* out)
+{
+    int id = v->id;
+    const VehicleConfig* cfg = &v->cold->config;
+
+    out->id = id;
+    out->render_prev = v->render_prev;
+    out->render_curr = v->render_curr;
+    memcpy(out->wheels, v->wheel_states, sizeof(out->wheels));
+    physics_vehicle_get_rotation(pw, id, &out->heading);
+
+    out->chassis_length = cfg->chassis_length;
+    out->chassis_width = cfg->chassis_width;
+    out->chassis_height = cfg->chassis_height;
+    for (int w = 0; w < 4; w++) {
+        out->wheel_radius[w] = cfg->use_per_wheel_config ? cfg->wheel_radii[w] : cfg->wheel_radius;
+        out->wheel_width[w] = cfg->use_per_wheel_config ? cfg->wheel_widths[w] : cfg->wheel_width;
+    }
+
+    physics_vehicle_get_velocity(pw, id, &out->speed_ms);
+    out->throttle = v->throttle;
+    out->brake = v->brake;
+    physics_vehicle_get_traction_info(pw, id, &out->applied_force_n, &out->traction);
+    physics_vehicle_get_drivetrain_info(pw, id, &out->gear, &out->rpm, &out->raw_gear, &out->is_matchbox);
+    physics_vehicle_get_handling(pw, id, &out->handling_status, &out->handling_class);
+    out->cruise_active = physics_vehicle_cruise_active(pw, id);
+    out->cruise_target_ms = physics_vehicle_cruise_target(pw, id);
+
+    out->maneuver_active = physics_vehicle_maneuver_active(pw, id);
+    const ManeuverAutopilot* ap = out->maneuver_active ? physics_vehicle_get_autopilot(pw, id) : NULL;
+    out->maneuver_progress = ap ? ap->progress : 0.0f;
+    out->maneuver_start_speed_ms = ap ? ap->start_speed_ms : 0.0f;
+    out->maneuver_target_speed_ms = ap ? ap->target_speed_ms : 0.0f;
+}
+
+// Fill the back buffer from the world and swap it into the middle.
+// stepped: a fixed step just finished. Frames published for a command keep
+// the last step's time, so render alpha does not jump back mid-step.
+static void publish_frame(SimThread* st, bool stepped)
+{
+    PROFILE_SCOPE("Sim.Publish");
+    PhysicsWorld* pw = st->pw;
+    SimFrame* f = &st->frames[st->back];
+
+    // Only clear the ids this buffer held last time
+    for (int n = 0; n < f->vehicle_count; n++) {
+        f->index_of[f->vehicles[n].id] = -1;
+    }
+
+    f->sequence = ++st->sequence;
+    f->step_index = pw->step_index;
+    f->step_size = pw->step_size;
+    f->ground_level = physics_get_ground_level(pw);
+    f->paused = physics_is_paused(pw);
+    f->turns_completed = st->turnsCompleted;
+
+    int count = 0;
+    for (int n = 0; n < pw->vehicle_count; n++) {
+        PhysicsVehicle* v = physics_get_vehicle(pw, pw->live_vehicles[n]);
+        if (!v || !v->impl) continue;
+        fill_vehicle_state(pw, v, &f->vehicles[count]);
+        f->index_of[v->id] = (int16_t)count;
+        count++;
+    }
+    f->vehicle_count = count;
+    if (stepped) st->stepTime = sim_clock_seconds(st);
+    f->publish_time = st->stepTime;
+
+    uint32_t prev = st->middle.exchange(st->back | SIM_FRAME_DIRTY, std::memory_order_acq_rel);
+    st->back = prev & ~SIM_FRAME_DIRTY;
+}
+
+static void drain_commands(SimThread* st)
+{
+    SimCommand cmd;
+    while (st->commands.pop(&cmd)) {
+        switch (cmd.type) {
+        case SIM_CMD_CONTROLS:
+            physics_vehicle_set_throttle(st->pw, cmd.vehicleId, cmd.throttle);
+            physics_vehicle_set_reverse(st->pw, cmd.vehicleId, cmd.reverse);
+            physics_vehicle_set_brake(st->pw, cmd.vehicleId, cmd.brake);
+            physics_vehicle_set_steering(st->pw, cmd.vehicleId, cmd.steering);
+            break;
+
+        case SIM_CMD_WATCH_TURN:
+            st->turnWatchId = cmd.vehicleId;
+            break;
+
+        case SIM_CMD_CALL:
+            cmd.fn(st->pw, st->engine, cmd.user);
+            publish_frame(st, false);
+            {
+                std::lock_guard<std::mutex> lock(st->mutex);
+                st->callsDone = cmd.callId;
+            }
+            st->doneCv.notify_all();
+            break;
+        }
+    }
+}
+
+// Script particle spawns arrive here on the sim thread
+static void queue_particle(const char* effect_name, float x, float y, float z, float intensity, void* user_data)
+{
+    SimThread* st = (SimThread*)user_data;
+    SimParticle p;
+    snprintf(p.effect, sizeof(p.effect), "%s", effect_name ? effect_name : "");
+    p.x = x;
+    p.y = y;
+    p.z = z;
+    p.intensity = intensity;
+    st->particles.push(p);  // Full: the renderer is behind, drop the puff
+}
+
+static void sim_tick(SimThread* st)
+{
+    PhysicsWorld* pw = st->pw;
+    float dt = pw->step_size;
+
+    {
+        PROFILE_SCOPE("Sim.Commands");
+        drain_commands(st);
+    }
+
+    // Exactly one fixed step (the accumulator returns to zero). Scripts run
+    // in its pre-step hook.
+    {
+        PROFILE_SCOPE("Sim.PhysicsStep");
+        physics_step(pw, dt);
+    }
+
+    // Without scripts there is no turn to wait for
+    if (st->turnWatchId >= 0 &&
+        (!st->engine || !reflex_is_turn_active(st->engine, st->turnWatchId))) {
+        physics_pause(pw);
+        st->turnWatchId = -1;
+        st->turnsCompleted++;
+    }
+
+    publish_frame(st, true);
+}
+
+static void sim_main(SimThread* st)
+{
+    PROFILE_THREAD_NAME("Sim");
+    SimClock::time_point next = SimClock::now();
+
+    for (;;) {
+        sim_tick(st);
+
+        SimClock::duration step = std::chrono::duration_cast<SimClock::duration>(
+            std::chrono::duration<double>(st->pw->step_size));
+        next += step;
+
+        // Too far behind (debugger, hitch): drop the missed ticks instead of
+        // running a burst of steps
+        SimClock::time_point now = SimClock::now();
+        if (now - next > step * SIM_MAX_LAG_STEPS) {
+            next = now;
+        }
+
+        // Sleep until the next tick, waking early to serve blocking calls
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock(st->mutex);
+                st->wakeCv.wait_until(lock, next, [st] { return st->quit || st->wake; });
+                if (st->quit) return;
+                if (!st->wake) break;  // Tick deadline reached
+                st->wake = false;
+            }
+            drain_commands(st);
+        }
+    }
+}
+
+extern "C" {
+
+SimThread* sim_thread_create(PhysicsWorld* pw, ReflexScriptEngine* engine)
+{
+    if (!pw || !pw->impl || pw->step_size <= 0.0f) {
+        fprintf(stderr, "[Sim] Physics world not initialized\n");
+        return NULL;
+    }
+
+    SimThread* st = new SimThread();
+    st->pw = pw;
+    st->engine = engine;
+    st->epoch = SimClock::now();
+
+    st->frames = (SimFrame*)calloc(3, sizeof(SimFrame));
+    for (int i = 0; i < 3; i++) {
+        memset(st->frames[i].index_of, 0xff, sizeof(st->frames[i].index_of));  // -1
+    }
+    st->front = 0;
+    st->middle.store(1, std::memory_order_relaxed);
+    st->back = 2;
+
+    st->sequence = 0;
+    st->turnsCompleted = 0;
+    st->turnWatchId = -1;
+    st->wake = false;
+    st->quit = false;
+    st->callsDone = 0;
+    st->callsIssued = 0;
+
+    if (engine) {
+        reflex_bind_physics_step(engine, pw);
+        reflex_set_particle_callback(engine, queue_particle, st);
+    }
+
+    // The first acquire must already see the world
+    publish_frame(st, true);
+
+    st->thread = std::thread(sim_main, st);
+    printf("[Sim] Simulation thread running at %.0f Hz\n", 1.0f / pw->step_size);
+    return st;
+}
+
+void sim_thread_destroy(SimThread* st)
+{
+    if (!st) return;
+
+    {
+        std::lock_guard<std::mutex> lock(st->mutex);
+        st->quit = true;
+    }
+    st->wakeCv.notify_one();
+    st->thread.join();
+
+    if (st->engine) {
+        reflex_bind_physics_step(NULL, st->pw);
+        reflex_set_particle_callback(st->engine, NULL, NULL);
+    }
+    free(st->frames);
+    delete st;
+}
+
+const SimFrame* sim_thread_acquire_frame(SimThread* st)
+{
+    if (st->middle.load(std::memory_order_acquire) & SIM_FRAME_DIRTY) {
+        uint32_t prev = st->middle.exchange(st->front, std::memory_order_acq_rel);
+        st->front = prev & ~SIM_FRAME_DIRTY;
+    }
+    return &st->frames[st->front];
+}
+
+float sim_thread_render_alpha(SimThread* st, const SimFrame* frame)
+{
+    if (!st || !frame || frame->step_size <= 0.0f) return 1.0f;
+
+    float alpha = (float)((sim_clock_seconds(st) - frame->publish_time) / frame->step_size);
+    if (alpha < 0.0f) alpha = 0.0f;
+    if (alpha > 1.0f) alpha = 1.0f;
+    return alpha;
+}
+
+const SimVehicleState* sim_frame_vehicle(const SimFrame* frame, int vehicle_id)
+{
+    if (!frame || vehicle_id < 0 || vehicle_id >= MAX_PHYSICS_VEHICLES) return NULL;
+    int index = frame->index_of[vehicle_id];
+    return index >= 0 ? &frame->vehicles[index] : NULL;
+}
+
+void sim_vehicle_render_transform(const SimVehicleState* v, float alpha, Vec3* pos, float* rot_matrix)
+{
+    if (!v) return;
+    physics_render_state_blend(&v->render_prev, &v->render_curr, alpha, pos, rot_matrix);
+}
+
+void sim_vehicle_render_wheels(const SimVehicleState* v, float alpha, WheelState* wheels)
+{
+    if (!v || !wheels) return;
+    memcpy(wheels, v->wheels, sizeof(WheelState) * 4);
+    physics_render_state_blend_wheels(&v->render_prev, &v->render_curr, alpha, wheels);
+}
+
+bool sim_thread_set_controls(SimThread* st, int vehicle_id,
+                             float throttle, float reverse, float brake, float steering)
+{
+    if (!st) return false;
+
+    SimCommand cmd = {};
+    cmd.type = SIM_CMD_CONTROLS;
+    cmd.vehicleId = vehicle_id;
+    cmd.throttle = throttle;
+    cmd.reverse = reverse;
+    cmd.brake = brake;
+    cmd.steering = steering;
+    return st->commands.push(cmd);
+}
+
+bool sim_thread_pause_after_turn(SimThread* st, int vehicle_id)
+{
+    if (!st) return false;
+
+    SimCommand cmd = {};
+    cmd.type = SIM_CMD_WATCH_TURN;
+    cmd.vehicleId = vehicle_id;
+    return st->commands.push(cmd);
+}
+
+void sim_thread_call(SimThread* st, SimCallFn fn, void* user)
+{
+    if (!st || !fn) return;
+
+    SimCommand cmd = {};
+    cmd.type = SIM_CMD_CALL;
+    cmd.fn = fn;
+    cmd.user = user;
+    cmd.callId = ++st->callsIssued;
+
+    // Rare: only when the sim has stalled with a full queue
+    while (!st->commands.push(cmd)) {
+        std::this_thread::yield();
+    }
+
+    std::unique_lock<std::mutex> lock(st->mutex);
+    st->wake = true;
+    st->wakeCv.notify_one();
+    st->doneCv.wait(lock, [st, &cmd] { return st->callsDone >= cmd.callId; });
+}
+
+int sim_thread_drain_particles(SimThread* st, ParticleSpawnCallback callback, void* user_data)
+{
+    if (!st) return 0;
+
+    int count = 0;
+    SimParticle p;
+    while (st->particles.pop(&p)) {
+        if (callback) callback(p.effect, p.x, p.y, p.z, p.intensity, user_data);
+        count++;
+    }
+    return count;
+}
+
+} // extern "C"
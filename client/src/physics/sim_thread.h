@@ -0,0 +1,159 @@
+/*
+ * Simulation Thread
+ * Runs reflex scripts and physics at the fixed step rate on a dedicated
+ * thread, so rendering a frame and simulating the next step overlap.
+ *
+ * Main thread -> sim:   lock-free command queue (controls, turn watch) and
+ *                       blocking calls for rare operations (sim_thread_call)
+ * Sim -> main thread:   triple-buffered SimFrame (poses, wheel states, HUD
+ *                       telemetry) plus a queue of script particle spawns
+ *
+ * While the thread runs, only it touches the PhysicsWorld and the script
+ * engine. Everything on the main side goes through this API.
+ *
+ * Usage (main thread):
+ *   frame = sim_thread_acquire_frame(st)   once per frame (and after calls)
+ *   sim_thread_set_controls(...)           per frame for the driven vehicle
+ *   sim_thread_run(st, [&](PhysicsWorld* pw, ReflexScriptEngine* e) { ... });
+ */
+
+#ifndef SIM_THREAD_H
+#define SIM_THREAD_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "../math/vec3.h"
+#include "../script/reflex_script.h"
+#include "jolt_physics.h"
+
+// Queue capacities (powers of two)
+#define SIM_COMMAND_QUEUE_SIZE 256
+#define SIM_PARTICLE_QUEUE_SIZE 512
+#define SIM_EFFECT_NAME_MAX 32
+
+// One vehicle as of the last published step
+typedef struct {
+    int id;
+
+    // Pose: blend prev -> curr with sim_thread_render_alpha
+    PhysicsRenderState render_prev;
+    PhysicsRenderState render_curr;
+    WheelState wheels[4];           // Latest step (slip, contact, compression)
+    float heading;                  // Yaw in radians (as physics_vehicle_get_rotation)
+
+    // Dimensions for drawing
+    float chassis_length;
+    float chassis_width;
+    float chassis_height;
+    float wheel_radius[4];
+    float wheel_width[4];
+
+    // HUD telemetry
+    float speed_ms;                 // Signed forward speed
+    float throttle;                 // After scripts (reflects TCS)
+    float brake;
+    float applied_force_n;
+    float traction;                 // 0-1, wheels on ground
+    int gear;
+    int raw_gear;
+    float rpm;
+    bool is_matchbox;
+    int handling_status;
+    int handling_class;
+    bool cruise_active;
+    float cruise_target_ms;
+
+    // Kinematic maneuver in progress
+    bool maneuver_active;
+    float maneuver_progress;        // 0-1
+    float maneuver_start_speed_ms;
+    float maneuver_target_speed_ms; // <= 0 keeps start speed
+} SimVehicleState;
+
+// Everything the renderer reads, published after every sim tick
+typedef struct {
+    uint64_t sequence;              // Publish count
+    uint64_t step_index;            // PhysicsWorld.step_index
+    double publish_time;            // Seconds on the sim clock (see sim_thread_render_alpha)
+    float step_size;
+    float ground_level;
+    bool paused;
+
+    // Scripted turns finished by sim_thread_pause_after_turn so far
+    uint32_t turns_completed;
+
+    int vehicle_count;
+    SimVehicleState vehicles[MAX_PHYSICS_VEHICLES];  // Dense, in live order
+    int16_t index_of[MAX_PHYSICS_VEHICLES];          // Vehicle id -> vehicles[] index, -1 if none
+} SimFrame;
+
+typedef struct SimThread SimThread;
+
+// Runs on the sim thread between steps, with exclusive access to both
+typedef void (*SimCallFn)(PhysicsWorld* pw, ReflexScriptEngine* engine, void* user);
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Take over stepping pw (at pw->step_size) and running engine's vehicle
+// scripts (engine may be NULL). Script particle spawns are queued for
+// sim_thread_drain_particles. Returns NULL if the world is not initialized.
+SimThread* sim_thread_create(PhysicsWorld* pw, ReflexScriptEngine* engine);
+
+// Stop and join the thread; pw and engine belong to the caller again
+void sim_thread_destroy(SimThread* st);
+
+// Newest published frame. The pointer stays valid until the next acquire.
+const SimFrame* sim_thread_acquire_frame(SimThread* st);
+
+// How far rendering is between frame's previous and current step (0-1)
+float sim_thread_render_alpha(SimThread* st, const SimFrame* frame);
+
+// Vehicle by id in frame, or NULL if it did not exist at that step
+const SimVehicleState* sim_frame_vehicle(const SimFrame* frame, int vehicle_id);
+
+// Interpolated chassis transform (rot_matrix 3x3 row-major) and wheel states
+void sim_vehicle_render_transform(const SimVehicleState* v, float alpha, Vec3* pos, float* rot_matrix);
+void sim_vehicle_render_wheels(const SimVehicleState* v, float alpha, WheelState* wheels);
+
+// Queue driver inputs, applied before the next step.
+// Returns false (input dropped) if the queue is full.
+bool sim_thread_set_controls(SimThread* st, int vehicle_id,
+                             float throttle, float reverse, float brake, float steering);
+
+// Pause the world in the step where vehicle_id's scripted turn ends
+// (reflex_is_turn_active goes false), then bump SimFrame.turns_completed.
+// -1 cancels the watch.
+bool sim_thread_pause_after_turn(SimThread* st, int vehicle_id);
+
+// Run fn on the sim thread before the next step and wait for it. A fresh frame
+// is published before this returns, so re-acquire to see fn's effects.
+void sim_thread_call(SimThread* st, SimCallFn fn, void* user);
+
+// Hand queued script particle spawns to callback (main thread, once per frame).
+// callback may be NULL to discard. Returns the number delivered.
+int sim_thread_drain_particles(SimThread* st, ParticleSpawnCallback callback, void* user_data);
+
+// Debug visualization of frame's vehicles - call between line_renderer_begin/end
+// Implemented in render/physics_debug_draw.cpp (not part of the headless arena_sim library)
+struct LineRenderer;  // Forward declare
+void physics_debug_draw(const SimFrame* frame, float alpha, struct LineRenderer* lr);
+
+#ifdef __cplusplus
+}
+
+#include <type_traits>
+
+// sim_thread_call with a lambda: fn(PhysicsWorld*, ReflexScriptEngine*)
+template <typename F>
+void sim_thread_run(SimThread* st, F&& fn)
+{
+    typedef typename std::remove_reference<F>::type Fn;
+    sim_thread_call(st, [](PhysicsWorld* pw, ReflexScriptEngine* engine, void* user) {
+        (*(Fn*)user)(pw, engine);
+    }, (void*)&fn);
+}
+#endif
+
+#endif // SIM_THREAD_H
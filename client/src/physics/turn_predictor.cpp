@@ -0,0 +1,227 @@
+/*
+ * Turn Outcome Predictor Implementation
+ *
+ * The main thread captures a PhysicsFork under the request lock (cheap: a few
+ * bodies and constraint states). The worker swaps it out, applies it to its own
+ * PhysicsWorld and steps that world as fast as it can. Only the worker touches
+ * the forked world, so the live world is never read off the main thread.
+ */
+
+#include "turn_predictor.h"
+#include "../util/profiler.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+struct PredictionRequest
+{
+    int generation;
+    int vehicleId;
+    int phaseIndices[MAX_TURN_PHASES];
+    ManeuverRequest requests[MAX_TURN_PHASES];
+    int numPhases;
+    float cruiseTargetMs;
+    float duration;
+};
+
+struct TurnPredictor
+{
+    std::thread worker;
+    std::mutex mutex;
+    std::condition_variable wake;
+    bool quit;
+
+    // Request handoff (guarded by mutex)
+    PhysicsFork* pendingFork;
+    PredictionRequest pendingRequest;
+    bool hasPending;
+    int nextGeneration;
+    std::atomic<int> latestGeneration;  // Lets the worker abandon stale runs
+
+    // Latest finished result (guarded by mutex)
+    TurnPrediction result;
+    bool hasResult;
+
+    // Worker-owned
+    PhysicsFork* workingFork;
+    PhysicsJobPool* pool;
+    PhysicsWorld world;
+};
+
+// Step the forked world through the planned turn, recording the trajectory.
+// Returns false if a newer request arrived and the run was abandoned.
+static bool simulate_turn(TurnPredictor* tp, const PredictionRequest* req, TurnPrediction* out)
+{
+    PROFILE_SCOPE("TurnPredictor.Simulate");
+    PhysicsWorld* pw = &tp->world;
+
+    memset(out, 0, sizeof(*out));
+    out->generation = req->generation;
+    out->vehicle_id = req->vehicleId;
+
+    // Planning happens while paused; the prediction runs the turn as if executed.
+    // The world is quiet, so none of this is reported.
+    physics_unpause(pw);
+    if (req->cruiseTargetMs >= 0.0f) {
+        physics_vehicle_cruise_set(pw, req->vehicleId, req->cruiseTargetMs);
+    }
+    out->accepted = physics_vehicle_start_turn(pw, req->vehicleId, req->phaseIndices,
+                                               req->requests, req->numPhases);
+
+    float dt = pw->step_size;
+    int steps = (int)ceilf(req->duration / dt);
+    if (steps < 1) steps = 1;
+    int stride = (steps + TURN_PREDICTION_MAX_POINTS - 2) / (TURN_PREDICTION_MAX_POINTS - 1);
+    if (stride < 1) stride = 1;
+
+    physics_vehicle_get_position(pw, req->vehicleId, &out->points[out->point_count++]);
+    for (int step = 1; step <= steps; step++) {
+        if (tp->latestGeneration.load(std::memory_order_relaxed) != req->generation) {
+            return false;
+        }
+        physics_step(pw, dt);
+        if ((step % stride == 0 || step == steps) && out->point_count < TURN_PREDICTION_MAX_POINTS) {
+            physics_vehicle_get_position(pw, req->vehicleId, &out->points[out->point_count++]);
+        }
+    }
+
+    physics_vehicle_get_position(pw, req->vehicleId, &out->final_position);
+    physics_vehicle_get_rotation(pw, req->vehicleId, &out->final_heading);
+    physics_vehicle_get_velocity(pw, req->vehicleId, &out->final_speed_ms);
+    int hc = 0;
+    physics_vehicle_get_handling(pw, req->vehicleId, &out->final_handling_status, &hc);
+    return true;
+}
+
+static void worker_main(TurnPredictor* tp)
+{
+    TurnPrediction local;
+    PROFILE_THREAD_NAME("TurnPredictor");
+
+    for (;;) {
+        PredictionRequest req;
+        {
+            std::unique_lock<std::mutex> lock(tp->mutex);
+            tp->wake.wait(lock, [tp] { return tp->quit || tp->hasPending; });
+            if (tp->quit) return;
+
+            PhysicsFork* swap = tp->workingFork;
+            tp->workingFork = tp->pendingFork;
+            tp->pendingFork = swap;
+            req = tp->pendingRequest;
+            tp->hasPending = false;
+        }
+
+        if (!physics_fork_apply(&tp->world, tp->workingFork, tp->pool)) {
+            fprintf(stderr, "[Predictor] Failed to fork physics world\n");
+            continue;
+        }
+        if (!simulate_turn(tp, &req, &local)) continue;
+
+        std::lock_guard<std::mutex> lock(tp->mutex);
+        if (!tp->hasResult || local.generation > tp->result.generation) {
+            tp->result = local;
+            tp->hasResult = true;
+        }
+    }
+}
+
+extern "C" {
+
+TurnPredictor* turn_predictor_create(void)
+{
+    TurnPredictor* tp = new TurnPredictor();
+    tp->quit = false;
+    tp->pendingFork = physics_fork_create();
+    tp->workingFork = physics_fork_create();
+    tp->hasPending = false;
+    tp->nextGeneration = 1;
+    tp->latestGeneration.store(0);
+    tp->hasResult = false;
+    memset(&tp->world, 0, sizeof(tp->world));
+    tp->world.quiet = true;  // Planned turns never ran - keep their messages off the console
+
+    // One worker thread is plenty for a handful of vehicles and keeps the
+    // predictor from competing with the live world's job system
+    tp->pool = physics_job_pool_create(1);
+    tp->worker = std::thread(worker_main, tp);
+    return tp;
+}
+
+void turn_predictor_destroy(TurnPredictor* tp)
+{
+    if (!tp) return;
+
+    {
+        std::lock_guard<std::mutex> lock(tp->mutex);
+        tp->quit = true;
+        tp->latestGeneration.store(-1);
+    }
+    tp->wake.notify_one();
+    tp->worker.join();
+
+    physics_destroy(&tp->world);
+    physics_job_pool_destroy(tp->pool);
+    physics_fork_destroy(tp->pendingFork);
+    physics_fork_destroy(tp->workingFork);
+    delete tp;
+}
+
+int turn_predictor_request(TurnPredictor* tp, PhysicsWorld* pw, int vehicle_id,
+                           const int* phase_indices,
+                           const ManeuverRequest* requests,
+                           int num_phases,
+                           float cruise_target_ms,
+                           float duration)
+{
+    if (!tp || !pw || !phase_indices || !requests) return 0;
+    if (num_phases < 1 || num_phases > MAX_TURN_PHASES) return 0;
+    if (!physics_get_vehicle(pw, vehicle_id)) return 0;
+
+    int generation;
+    {
+        std::lock_guard<std::mutex> lock(tp->mutex);
+        if (!physics_fork_capture(pw, tp->pendingFork)) return 0;
+
+        generation = tp->nextGeneration++;
+        PredictionRequest* req = &tp->pendingRequest;
+        req->generation = generation;
+        req->vehicleId = vehicle_id;
+        memcpy(req->phaseIndices, phase_indices, num_phases * sizeof(int));
+        memcpy(req->requests, requests, num_phases * sizeof(ManeuverRequest));
+        req->numPhases = num_phases;
+        req->cruiseTargetMs = cruise_target_ms;
+        req->duration = duration;
+        tp->hasPending = true;
+        tp->latestGeneration.store(generation);
+    }
+    tp->wake.notify_one();
+    return generation;
+}
+
+bool turn_predictor_poll(TurnPredictor* tp, int last_generation, TurnPrediction* out)
+{
+    if (!tp || !out) return false;
+
+    std::lock_guard<std::mutex> lock(tp->mutex);
+    if (!tp->hasResult || tp->result.generation <= last_generation) return false;
+    *out = tp->result;
+    return true;
+}
+
+void turn_predictor_clear(TurnPredictor* tp)
+{
+    if (!tp) return;
+
+    std::lock_guard<std::mutex> lock(tp->mutex);
+    tp->hasResult = false;
+    tp->hasPending = false;
+    tp->latestGeneration.store(0);
+}
+
+} // extern "C"
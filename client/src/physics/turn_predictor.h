@@ -0,0 +1,74 @@
+/*
+ * Turn Outcome Predictor
+ * Simulates a planned turn on a worker thread against a forked copy of the
+ * physics world, so the ghost path can show where the vehicle will actually
+ * end up without stalling the render loop.
+ *
+ * Usage (main thread):
+ *   turn_predictor_request(...) whenever the plan changes  (forks the world)
+ *   turn_predictor_poll(...)    every frame                (latest finished result)
+ */
+
+#ifndef TURN_PREDICTOR_H
+#define TURN_PREDICTOR_H
+
+#include <stdbool.h>
+#include "../math/vec3.h"
+#include "../game/maneuver.h"
+#include "jolt_physics.h"
+
+#define TURN_PREDICTION_MAX_POINTS 128
+
+// Predicted outcome of one planned turn
+typedef struct {
+    int generation;             // Request this answers (from turn_predictor_request)
+    int vehicle_id;
+    bool accepted;              // physics_vehicle_start_turn accepted the plan
+
+    // Trajectory (chassis positions, evenly spaced in time)
+    Vec3 points[TURN_PREDICTION_MAX_POINTS];
+    int point_count;
+
+    // Final pose after the simulated time
+    Vec3 final_position;
+    float final_heading;        // Radians
+    float final_speed_ms;
+
+    // Handling after the turn's maneuvers
+    int final_handling_status;
+} TurnPrediction;
+
+typedef struct TurnPredictor TurnPredictor;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Starts the worker thread (and its own single-thread physics job pool)
+TurnPredictor* turn_predictor_create(void);
+void turn_predictor_destroy(TurnPredictor* tp);
+
+// Fork pw's current state and queue a prediction of the given turn.
+// Replaces any request not yet started; a running one is abandoned.
+// cruise_target_ms < 0 leaves cruise control as it is.
+// duration: seconds to simulate (a turn is 1.0s).
+// Returns the request generation (> 0), or 0 on failure.
+int turn_predictor_request(TurnPredictor* tp, PhysicsWorld* pw, int vehicle_id,
+                           const int* phase_indices,
+                           const ManeuverRequest* requests,
+                           int num_phases,
+                           float cruise_target_ms,
+                           float duration);
+
+// Copy the newest finished prediction into out.
+// Returns true if it is newer than last_generation.
+bool turn_predictor_poll(TurnPredictor* tp, int last_generation, TurnPrediction* out);
+
+// Forget any finished prediction (e.g. when the plan is cancelled)
+void turn_predictor_clear(TurnPredictor* tp);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TURN_PREDICTOR_H
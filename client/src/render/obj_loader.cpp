@@ -1,10 +1,14 @@
 #include "obj_loader.h"
+#include "../game/config_cache.h"
+#include "../util/mapped_file.h"
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
 #include <string.h>
 #include <float.h>
+#include <filesystem>
 
-// Dynamic arrays for parsing
+// Dynamic arrays for parsing (reserved up front from a line count)
 typedef struct {
     float* data;
     int count;
@@ -17,13 +21,13 @@ typedef struct {
     int capacity;
 } IntArray;
 
-static void float_array_init(FloatArray* arr) {
-    arr->data = NULL;
+static void float_array_init(FloatArray* arr, int capacity) {
+    arr->data = capacity > 0 ? (float*)malloc(capacity * sizeof(float)) : NULL;
     arr->count = 0;
-    arr->capacity = 0;
+    arr->capacity = arr->data ? capacity : 0;
 }
 
-static void float_array_push(FloatArray* arr, float value) {
+static inline void float_array_push(FloatArray* arr, float value) {
     if (arr->count >= arr->capacity) {
         arr->capacity = arr->capacity == 0 ? 64 : arr->capacity * 2;
         arr->data = (float*)realloc(arr->data, arr->capacity * sizeof(float));
@@ -38,13 +42,13 @@ static void float_array_free(FloatArray* arr) {
     arr->capacity = 0;
 }
 
-static void int_array_init(IntArray* arr) {
-    arr->data = NULL;
+static void int_array_init(IntArray* arr, int capacity) {
+    arr->data = capacity > 0 ? (int*)malloc(capacity * sizeof(int)) : NULL;
     arr->count = 0;
-    arr->capacity = 0;
+    arr->capacity = arr->data ? capacity : 0;
 }
 
-static void int_array_push(IntArray* arr, int value) {
+static inline void int_array_push(IntArray* arr, int value) {
     if (arr->count >= arr->capacity) {
         arr->capacity = arr->capacity == 0 ? 64 : arr->capacity * 2;
         arr->data = (int*)realloc(arr->data, arr->capacity * sizeof(int));
@@ -59,30 +63,140 @@ static void int_array_free(IntArray* arr) {
     arr->capacity = 0;
 }
 
-// Parse a face index like "1/2/3" or "1//3" or "1"
-static void parse_face_vertex(const char* str, int* v, int* vt, int* vn) {
-    *v = 0;
+// ============================================================================
+// Text scanning (the mapped file is not NUL-terminated: always pass end)
+// ============================================================================
+
+static inline bool is_blank(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\v' || c == '\f';
+}
+
+static inline bool is_digit(char c) {
+    return (unsigned)(c - '0') < 10u;
+}
+
+static inline const char* skip_blanks(const char* p, const char* end) {
+    while (p < end && is_blank(*p)) p++;
+    return p;
+}
+
+static inline const char* token_end(const char* p, const char* end) {
+    while (p < end && !is_blank(*p)) p++;
+    return p;
+}
+
+// Exact powers of ten (doubles are exact up to 1e22)
+static const double POW10[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+// Parse the next float on the line and advance past it (0 if there is none).
+// Plain decimals with up to 15 significant digits, as exporters write them,
+// take one multiply or divide; anything else goes through strtof.
+static float parse_float(const char** pp, const char* end) {
+    const char* p = skip_blanks(*pp, end);
+    const char* start = p;
+
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = (*p == '-');
+        p++;
+    }
+
+    uint64_t mantissa = 0;
+    int digits = 0;         // Significant digits in mantissa
+    int exponent = 0;
+    bool any = false;
+    for (; p < end && is_digit(*p); p++) {
+        any = true;
+        if (digits < 19) {
+            mantissa = mantissa * 10 + (uint64_t)(*p - '0');
+            if (mantissa) digits++;
+        } else {
+            exponent++;
+        }
+    }
+    if (p < end && *p == '.') {
+        for (p++; p < end && is_digit(*p); p++) {
+            any = true;
+            if (digits < 19) {
+                mantissa = mantissa * 10 + (uint64_t)(*p - '0');
+                if (mantissa) digits++;
+                exponent--;
+            }
+        }
+    }
+    if (any && p < end && (*p == 'e' || *p == 'E')) {
+        const char* e = p + 1;
+        bool exp_negative = false;
+        if (e < end && (*e == '-' || *e == '+')) {
+            exp_negative = (*e == '-');
+            e++;
+        }
+        if (e < end && is_digit(*e)) {
+            int value = 0;
+            for (; e < end && is_digit(*e); e++) {
+                if (value < 1000) value = value * 10 + (*e - '0');
+            }
+            exponent += exp_negative ? -value : value;
+            p = e;
+        }
+    }
+
+    if (!any || digits > 15 || exponent < -22 || exponent > 22 || (p < end && !is_blank(*p))) {
+        // Long mantissa, large exponent, inf/nan or garbage
+        char buf[64];
+        const char* stop = token_end(start, end);
+        size_t len = (size_t)(stop - start);
+        if (len >= sizeof(buf)) len = sizeof(buf) - 1;
+        memcpy(buf, start, len);
+        buf[len] = '\0';
+        *pp = stop;
+        return strtof(buf, NULL);
+    }
+
+    double value = (double)mantissa;
+    value = exponent < 0 ? value / POW10[-exponent] : value * POW10[exponent];
+    *pp = p;
+    return (float)(negative ? -value : value);
+}
+
+// atoi on [p, end): optional sign and digits, 0 if none
+static int parse_int(const char* p, const char* end) {
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = (*p == '-');
+        p++;
+    }
+    int value = 0;
+    for (; p < end && is_digit(*p); p++) value = value * 10 + (*p - '0');
+    return negative ? -value : value;
+}
+
+// Parse a face index like "1/2/3" or "1//3" or "1" in [p, end)
+static void parse_face_vertex(const char* p, const char* end, int* v, int* vt, int* vn) {
     *vt = 0;
     *vn = 0;
 
     // Parse vertex index
-    *v = atoi(str);
+    *v = parse_int(p, end);
 
     // Find first slash
-    const char* slash1 = strchr(str, '/');
+    const char* slash1 = (const char*)memchr(p, '/', (size_t)(end - p));
     if (!slash1) return;
 
     // Parse texture index (may be empty)
-    if (slash1[1] != '/') {
-        *vt = atoi(slash1 + 1);
+    if (slash1 + 1 < end && slash1[1] != '/') {
+        *vt = parse_int(slash1 + 1, end);
     }
 
     // Find second slash
-    const char* slash2 = strchr(slash1 + 1, '/');
+    const char* slash2 = (const char*)memchr(slash1 + 1, '/', (size_t)(end - slash1 - 1));
     if (!slash2) return;
 
     // Parse normal index
-    *vn = atoi(slash2 + 1);
+    *vn = parse_int(slash2 + 1, end);
 }
 
 // Helper to check if a group name is in the filter list
@@ -94,20 +208,25 @@ static bool group_in_filter(const char* group_name, const char** groups, int num
     return false;
 }
 
-bool obj_load_groups(LoadedMesh* mesh, const char* filepath, const char** groups, int num_groups) {
-    mesh->valid = false;
-    mesh->vao = 0;
-    mesh->vbo = 0;
-    mesh->uv_vbo = 0;
-    mesh->has_uvs = false;
-    mesh->vertex_count = 0;
-    mesh->bounds_min = vec3(FLT_MAX, FLT_MAX, FLT_MAX);
-    mesh->bounds_max = vec3(-FLT_MAX, -FLT_MAX, -FLT_MAX);
-
-    FILE* file = fopen(filepath, "r");
-    if (!file) {
-        fprintf(stderr, "Failed to open OBJ file: %s\n", filepath);
-        return false;
+// Parse OBJ text into a de-indexed triangle soup
+static bool parse_obj(ObjMeshData* data, const char* text, size_t size, const char* filepath,
+                      const char** groups, int num_groups) {
+    const char* text_end = text + size;
+
+    // Count elements first so every array is allocated once
+    int position_lines = 0, normal_lines = 0, texcoord_lines = 0, face_lines = 0;
+    for (const char* line = text; line < text_end; ) {
+        const char* nl = (const char*)memchr(line, '\n', (size_t)(text_end - line));
+        const char* line_end = nl ? nl : text_end;
+        if (line_end - line >= 2) {
+            if (line[0] == 'v') {
+                position_lines += (line[1] == ' ');
+                normal_lines += (line[1] == 'n');
+                texcoord_lines += (line[1] == 't');
+            }
+            face_lines += (line[0] == 'f' && line[1] == ' ');
+        }
+        line = line_end + 1;
     }
 
     // Temporary storage for parsed data
@@ -116,107 +235,100 @@ bool obj_load_groups(LoadedMesh* mesh, const char* filepath, const char** groups
     // Track which vertices are actually used for bounds calculation
     IntArray used_vertices;
 
-    float_array_init(&positions);
-    float_array_init(&normals);
-    float_array_init(&texcoords);
-    int_array_init(&face_v);
-    int_array_init(&face_vt);
-    int_array_init(&face_vn);
-    int_array_init(&used_vertices);
+    float_array_init(&positions, position_lines * 3);
+    float_array_init(&normals, normal_lines * 3);
+    float_array_init(&texcoords, texcoord_lines * 2);
+    int_array_init(&face_v, face_lines * 6);
+    int_array_init(&face_vt, face_lines * 6);
+    int_array_init(&face_vn, face_lines * 6);
+    int_array_init(&used_vertices, face_lines * 4);
 
     // Current group tracking
     char current_group[64] = "";
     bool include_current_group = (groups == NULL || num_groups == 0);
 
-    char line[512];
-    while (fgets(line, sizeof(line), file)) {
+    for (const char* line = text; line < text_end; ) {
+        const char* nl = (const char*)memchr(line, '\n', (size_t)(text_end - line));
+        const char* line_end = nl ? nl : text_end;
+        const char* next_line = line_end + 1;
+        char c0 = line[0];
+        char c1 = (line + 1 < line_end) ? line[1] : '\0';
+        char c2 = (line + 2 < line_end) ? line[2] : '\0';
+
         // Skip comments and empty lines
-        if (line[0] == '#' || line[0] == '\n' || line[0] == '\r') {
+        if (c0 == '#' || c0 == '\n' || c0 == '\r') {
+            line = next_line;
             continue;
         }
 
         // Group declaration
-        if (line[0] == 'g' && line[1] == ' ') {
-            sscanf(line + 2, "%63s", current_group);
+        if (c0 == 'g' && c1 == ' ') {
+            const char* name = skip_blanks(line + 2, line_end);
+            size_t len = (size_t)(token_end(name, line_end) - name);
+            if (len > 0) {
+                if (len > sizeof(current_group) - 1) len = sizeof(current_group) - 1;
+                memcpy(current_group, name, len);
+                current_group[len] = '\0';
+            }
             include_current_group = group_in_filter(current_group, groups, num_groups);
+            line = next_line;
             continue;
         }
 
         // Vertex position (may have vertex colors: v x y z r g b)
-        if (line[0] == 'v' && line[1] == ' ') {
-            float x, y, z;
-            sscanf(line + 2, "%f %f %f", &x, &y, &z);
-            float_array_push(&positions, x);
-            float_array_push(&positions, y);
-            float_array_push(&positions, z);
+        if (c0 == 'v' && c1 == ' ') {
+            const char* p = line + 2;
+            float_array_push(&positions, parse_float(&p, line_end));
+            float_array_push(&positions, parse_float(&p, line_end));
+            float_array_push(&positions, parse_float(&p, line_end));
             // Note: bounds calculated later from used vertices only
         }
         // Vertex normal
-        else if (line[0] == 'v' && line[1] == 'n' && line[2] == ' ') {
-            float x, y, z;
-            sscanf(line + 3, "%f %f %f", &x, &y, &z);
-            float_array_push(&normals, x);
-            float_array_push(&normals, y);
-            float_array_push(&normals, z);
+        else if (c0 == 'v' && c1 == 'n' && c2 == ' ') {
+            const char* p = line + 3;
+            float_array_push(&normals, parse_float(&p, line_end));
+            float_array_push(&normals, parse_float(&p, line_end));
+            float_array_push(&normals, parse_float(&p, line_end));
         }
         // Texture coordinate
-        else if (line[0] == 'v' && line[1] == 't' && line[2] == ' ') {
-            float u, v;
-            sscanf(line + 3, "%f %f", &u, &v);
-            float_array_push(&texcoords, u);
-            float_array_push(&texcoords, v);
+        else if (c0 == 'v' && c1 == 't' && c2 == ' ') {
+            const char* p = line + 3;
+            float_array_push(&texcoords, parse_float(&p, line_end));
+            float_array_push(&texcoords, parse_float(&p, line_end));
         }
-        // Face (triangles only for now) - only include if in active group
-        else if (line[0] == 'f' && line[1] == ' ' && include_current_group) {
-            char v1[64], v2[64], v3[64], v4[64];
-            int count = sscanf(line + 2, "%s %s %s %s", v1, v2, v3, v4);
+        // Face (triangles and quads) - only include if in active group
+        else if (c0 == 'f' && c1 == ' ' && include_current_group) {
+            int vi[4], vt[4], vn[4];
+            int count = 0;
+            const char* p = line + 2;
+            while (count < 4) {
+                p = skip_blanks(p, line_end);
+                if (p >= line_end) break;
+                const char* end = token_end(p, line_end);
+                parse_face_vertex(p, end, &vi[count], &vt[count], &vn[count]);
+                count++;
+                p = end;
+            }
 
             if (count >= 3) {
-                int vi1, vt1, vn1;
-                int vi2, vt2, vn2;
-                int vi3, vt3, vn3;
-
-                parse_face_vertex(v1, &vi1, &vt1, &vn1);
-                parse_face_vertex(v2, &vi2, &vt2, &vn2);
-                parse_face_vertex(v3, &vi3, &vt3, &vn3);
-
-                // First triangle
-                int_array_push(&face_v, vi1);
-                int_array_push(&face_vt, vt1);
-                int_array_push(&face_vn, vn1);
-                int_array_push(&face_v, vi2);
-                int_array_push(&face_vt, vt2);
-                int_array_push(&face_vn, vn2);
-                int_array_push(&face_v, vi3);
-                int_array_push(&face_vt, vt3);
-                int_array_push(&face_vn, vn3);
+                // First triangle, then the second half of a quad
+                static const int QUAD_CORNERS[6] = { 0, 1, 2, 0, 2, 3 };
+                int corners = (count >= 4) ? 6 : 3;
+                for (int k = 0; k < corners; k++) {
+                    int corner = QUAD_CORNERS[k];
+                    int_array_push(&face_v, vi[corner]);
+                    int_array_push(&face_vt, vt[corner]);
+                    int_array_push(&face_vn, vn[corner]);
+                }
 
                 // Track used vertices for bounds
-                int_array_push(&used_vertices, vi1);
-                int_array_push(&used_vertices, vi2);
-                int_array_push(&used_vertices, vi3);
-
-                // If quad, add second triangle
-                if (count >= 4) {
-                    int vi4, vt4, vn4;
-                    parse_face_vertex(v4, &vi4, &vt4, &vn4);
-
-                    int_array_push(&face_v, vi1);
-                    int_array_push(&face_vt, vt1);
-                    int_array_push(&face_vn, vn1);
-                    int_array_push(&face_v, vi3);
-                    int_array_push(&face_vt, vt3);
-                    int_array_push(&face_vn, vn3);
-                    int_array_push(&face_v, vi4);
-                    int_array_push(&face_vt, vt4);
-                    int_array_push(&face_vn, vn4);
-
-                    int_array_push(&used_vertices, vi4);
+                for (int k = 0; k < count; k++) {
+                    int_array_push(&used_vertices, vi[k]);
                 }
             }
         }
+        line = next_line;
     }
-    fclose(file);
 
     // Calculate bounds from used vertices only
     for (int i = 0; i < used_vertices.count; i++) {
@@ -225,12 +337,12 @@ bool obj_load_groups(LoadedMesh* mesh, const char* filepath, const char** groups
             float x = positions.data[vi * 3 + 0];
             float y = positions.data[vi * 3 + 1];
             float z = positions.data[vi * 3 + 2];
-            if (x < mesh->bounds_min.x) mesh->bounds_min.x = x;
-            if (y < mesh->bounds_min.y) mesh->bounds_min.y = y;
-            if (z < mesh->bounds_min.z) mesh->bounds_min.z = z;
-            if (x > mesh->bounds_max.x) mesh->bounds_max.x = x;
-            if (y > mesh->bounds_max.y) mesh->bounds_max.y = y;
-            if (z > mesh->bounds_max.z) mesh->bounds_max.z = z;
+            if (x < data->bounds_min.x) data->bounds_min.x = x;
+            if (y < data->bounds_min.y) data->bounds_min.y = y;
+            if (z < data->bounds_min.z) data->bounds_min.z = z;
+            if (x > data->bounds_max.x) data->bounds_max.x = x;
+            if (y > data->bounds_max.y) data->bounds_max.y = y;
+            if (z > data->bounds_max.z) data->bounds_max.z = z;
         }
     }
     int_array_free(&used_vertices);
@@ -291,23 +403,6 @@ bool obj_load_groups(LoadedMesh* mesh, const char* filepath, const char** groups
         }
     }
 
-    // Create VAO and VBO
-    glGenVertexArrays(1, &mesh->vao);
-    glGenBuffers(1, &mesh->vbo);
-
-    glBindVertexArray(mesh->vao);
-
-    glBindBuffer(GL_ARRAY_BUFFER, mesh->vbo);
-    glBufferData(GL_ARRAY_BUFFER, num_face_verts * 6 * sizeof(float), vertex_data, GL_STATIC_DRAW);
-
-    // Position attribute (location 0)
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-
-    // Normal attribute (location 1)
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-
     // Create UV buffer if texcoords are available
     bool has_valid_uvs = (texcoords.count > 0);
     // Check if any face actually references texture coordinates
@@ -334,26 +429,14 @@ bool obj_load_groups(LoadedMesh* mesh, const char* filepath, const char** groups
                 }
             }
 
-            glGenBuffers(1, &mesh->uv_vbo);
-            glBindBuffer(GL_ARRAY_BUFFER, mesh->uv_vbo);
-            glBufferData(GL_ARRAY_BUFFER, num_face_verts * 2 * sizeof(float), uv_data, GL_STATIC_DRAW);
-
-            // UV attribute (location 2)
-            glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
-            glEnableVertexAttribArray(2);
-
-            free(uv_data);
-            mesh->has_uvs = true;
+            data->uvs = uv_data;
         }
     }
 
-    glBindVertexArray(0);
-
-    mesh->vertex_count = num_face_verts;
-    mesh->valid = true;
+    data->vertices = vertex_data;
+    data->vertex_count = num_face_verts;
 
     // Cleanup
-    free(vertex_data);
     float_array_free(&positions);
     float_array_free(&normals);
     float_array_free(&texcoords);
@@ -361,11 +444,196 @@ bool obj_load_groups(LoadedMesh* mesh, const char* filepath, const char** groups
     int_array_free(&face_vt);
     int_array_free(&face_vn);
 
-    printf("Loaded OBJ: %s (%d vertices%s)\n", filepath, mesh->vertex_count,
-           mesh->has_uvs ? ", with UVs" : "");
     return true;
 }
 
+// ============================================================================
+// Baked meshes
+// ============================================================================
+// Parsed meshes are stored in the config cache (config_cache.h) as
+// ObjBakedHeader + vertices + uvs, keyed by path, mtime, size and group
+// filter, so an unchanged OBJ loads with one read and no parsing.
+
+typedef struct {
+    int32_t vertex_count;
+    int32_t has_uvs;
+    float bounds_min[3];
+    float bounds_max[3];
+} ObjBakedHeader;
+
+static bool obj_bake_key(uint64_t* key, const char* filepath, const char** groups, int num_groups) {
+    if (!config_cache_enabled()) return false;
+
+    std::error_code ec;
+    int64_t mtime = (int64_t)std::filesystem::last_write_time(filepath, ec).time_since_epoch().count();
+    if (ec) return false;
+    uint64_t size = (uint64_t)std::filesystem::file_size(filepath, ec);
+    if (ec) return false;
+
+    *key = config_cache_key("mesh", sizeof(ObjBakedHeader));
+    *key = config_cache_hash(*key, filepath, strlen(filepath) + 1);
+    *key = config_cache_hash(*key, &mtime, sizeof(mtime));
+    *key = config_cache_hash(*key, &size, sizeof(size));
+    for (int i = 0; groups && i < num_groups; i++) {
+        *key = config_cache_hash(*key, groups[i], strlen(groups[i]) + 1);
+    }
+    return true;
+}
+
+static bool obj_load_baked(ObjMeshData* data, uint64_t key) {
+    ConfigBlob blob;
+    if (!config_cache_open("mesh", key, &blob)) return false;
+
+    ObjBakedHeader header;
+    const char* payload = (const char*)blob.payload;
+    bool ok = blob.payload_size >= sizeof(header);
+    if (ok) {
+        memcpy(&header, payload, sizeof(header));
+        size_t n = (size_t)(header.vertex_count > 0 ? header.vertex_count : 0);
+        size_t vertices_size = n * 6 * sizeof(float);
+        size_t uvs_size = header.has_uvs ? n * 2 * sizeof(float) : 0;
+        ok = n > 0 && blob.payload_size == sizeof(header) + vertices_size + uvs_size;
+        if (ok) {
+            data->vertices = (float*)malloc(vertices_size);
+            data->uvs = uvs_size ? (float*)malloc(uvs_size) : NULL;
+            ok = data->vertices && (data->uvs || !uvs_size);
+        }
+        if (ok) {
+            memcpy(data->vertices, payload + sizeof(header), vertices_size);
+            if (uvs_size) memcpy(data->uvs, payload + sizeof(header) + vertices_size, uvs_size);
+            data->vertex_count = (int)n;
+            data->bounds_min = vec3(header.bounds_min[0], header.bounds_min[1], header.bounds_min[2]);
+            data->bounds_max = vec3(header.bounds_max[0], header.bounds_max[1], header.bounds_max[2]);
+        }
+    }
+    config_cache_close(&blob);
+    if (!ok) {
+        free(data->vertices);
+        free(data->uvs);
+        data->vertices = NULL;
+        data->uvs = NULL;
+    }
+    return ok;
+}
+
+static void obj_store_baked(const ObjMeshData* data, uint64_t key) {
+    ObjBakedHeader header;
+    header.vertex_count = data->vertex_count;
+    header.has_uvs = data->uvs != NULL;
+    header.bounds_min[0] = data->bounds_min.x;
+    header.bounds_min[1] = data->bounds_min.y;
+    header.bounds_min[2] = data->bounds_min.z;
+    header.bounds_max[0] = data->bounds_max.x;
+    header.bounds_max[1] = data->bounds_max.y;
+    header.bounds_max[2] = data->bounds_max.z;
+
+    size_t vertices_size = (size_t)data->vertex_count * 6 * sizeof(float);
+    size_t uvs_size = data->uvs ? (size_t)data->vertex_count * 2 * sizeof(float) : 0;
+    size_t size = sizeof(header) + vertices_size + uvs_size;
+    char* buffer = (char*)malloc(size);
+    if (!buffer) return;
+
+    memcpy(buffer, &header, sizeof(header));
+    memcpy(buffer + sizeof(header), data->vertices, vertices_size);
+    if (uvs_size) memcpy(buffer + sizeof(header) + vertices_size, data->uvs, uvs_size);
+    config_cache_store("mesh", key, buffer, size);
+    free(buffer);
+}
+
+bool obj_parse_groups(ObjMeshData* data, const char* filepath, const char** groups, int num_groups) {
+    memset(data, 0, sizeof(*data));
+    data->bounds_min = vec3(FLT_MAX, FLT_MAX, FLT_MAX);
+    data->bounds_max = vec3(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+
+    uint64_t key = 0;
+    bool cacheable = obj_bake_key(&key, filepath, groups, num_groups);
+    if (cacheable && obj_load_baked(data, key)) {
+        printf("Loaded OBJ: %s (%d vertices%s, baked)\n", filepath, data->vertex_count,
+               data->uvs ? ", with UVs" : "");
+        return true;
+    }
+
+    MappedFile file;
+    if (!mapped_file_open(&file, filepath)) {
+        fprintf(stderr, "Failed to open OBJ file: %s\n", filepath);
+        return false;
+    }
+    bool ok = parse_obj(data, file.data, file.size, filepath, groups, num_groups);
+    mapped_file_close(&file);
+    if (!ok) return false;
+
+    if (cacheable) obj_store_baked(data, key);
+    printf("Loaded OBJ: %s (%d vertices%s)\n", filepath, data->vertex_count,
+           data->uvs ? ", with UVs" : "");
+    return true;
+}
+
+bool obj_upload(LoadedMesh* mesh, const ObjMeshData* data) {
+    mesh->valid = false;
+    mesh->vao = 0;
+    mesh->vbo = 0;
+    mesh->uv_vbo = 0;
+    mesh->has_uvs = false;
+    mesh->vertex_count = 0;
+    mesh->bounds_min = data->bounds_min;
+    mesh->bounds_max = data->bounds_max;
+    if (!data->vertices || data->vertex_count == 0) return false;
+
+    // Create VAO and VBO
+    glGenVertexArrays(1, &mesh->vao);
+    glGenBuffers(1, &mesh->vbo);
+
+    glBindVertexArray(mesh->vao);
+
+    glBindBuffer(GL_ARRAY_BUFFER, mesh->vbo);
+    glBufferData(GL_ARRAY_BUFFER, data->vertex_count * 6 * sizeof(float), data->vertices, GL_STATIC_DRAW);
+
+    // Position attribute (location 0)
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+
+    // Normal attribute (location 1)
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)(3 * sizeof(float)));
+    glEnableVertexAttribArray(1);
+
+    if (data->uvs) {
+        glGenBuffers(1, &mesh->uv_vbo);
+        glBindBuffer(GL_ARRAY_BUFFER, mesh->uv_vbo);
+        glBufferData(GL_ARRAY_BUFFER, data->vertex_count * 2 * sizeof(float), data->uvs, GL_STATIC_DRAW);
+
+        // UV attribute (location 2)
+        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+        glEnableVertexAttribArray(2);
+        mesh->has_uvs = true;
+    }
+
+    glBindVertexArray(0);
+
+    mesh->vertex_count = data->vertex_count;
+    mesh->valid = true;
+    return true;
+}
+
+void obj_data_free(ObjMeshData* data) {
+    free(data->vertices);
+    free(data->uvs);
+    memset(data, 0, sizeof(*data));
+}
+
+bool obj_load_groups(LoadedMesh* mesh, const char* filepath, const char** groups, int num_groups) {
+    ObjMeshData data;
+    bool ok = obj_parse_groups(&data, filepath, groups, num_groups);
+    if (ok) {
+        ok = obj_upload(mesh, &data);
+    } else {
+        memset(mesh, 0, sizeof(*mesh));
+        mesh->bounds_min = data.bounds_min;
+        mesh->bounds_max = data.bounds_max;
+    }
+    obj_data_free(&data);
+    return ok;
+}
+
 bool obj_load(LoadedMesh* mesh, const char* filepath) {
     return obj_load_groups(mesh, filepath, NULL, 0);
 }
@@ -17,6 +17,15 @@ typedef struct LoadedMesh {
     bool valid;
 } LoadedMesh;
 
+// Parsed vertex data, not yet on the GPU
+typedef struct {
+    float* vertices;       // 6 floats per vertex: position + normal
+    float* uvs;            // 2 floats per vertex (NULL = no UVs)
+    int vertex_count;
+    Vec3 bounds_min;
+    Vec3 bounds_max;
+} ObjMeshData;
+
 // Load an OBJ file and create GPU buffers
 // Returns true on success, false on failure
 bool obj_load(LoadedMesh* mesh, const char* filepath);
@@ -27,6 +36,12 @@ bool obj_load(LoadedMesh* mesh, const char* filepath);
 // If groups is NULL or num_groups is 0, loads all groups (same as obj_load)
 bool obj_load_groups(LoadedMesh* mesh, const char* filepath, const char** groups, int num_groups);
 
+// Parse without touching GL (safe on worker threads), then upload on the
+// GL thread. obj_load_groups does both. Free data with obj_data_free.
+bool obj_parse_groups(ObjMeshData* data, const char* filepath, const char** groups, int num_groups);
+bool obj_upload(LoadedMesh* mesh, const ObjMeshData* data);
+void obj_data_free(ObjMeshData* data);
+
 // Free GPU resources
 void obj_destroy(LoadedMesh* mesh);
 
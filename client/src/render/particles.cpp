@@ -1,5 +1,5 @@
 #include "particles.h"
-#include "../vendor/cJSON.h"
+#include "../util/json_reader.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -15,161 +15,140 @@ static ParticleEffect s_effects[MAX_EFFECTS];
 static int s_effect_count = 0;
 
 bool particle_effects_load(const char* filepath) {
-    FILE* f = fopen(filepath, "rb");
-    if (!f) {
-        fprintf(stderr, "Failed to open particle effects file: %s\n", filepath);
-        return false;
-    }
-
-    fseek(f, 0, SEEK_END);
-    long size = ftell(f);
-    fseek(f, 0, SEEK_SET);
-
-    char* data = (char*)malloc(size + 1);
-    if (!data) {
-        fclose(f);
-        return false;
-    }
-    fread(data, 1, size, f);
-    data[size] = '\0';
-    fclose(f);
-
-    cJSON* root = cJSON_Parse(data);
-    free(data);
-
-    if (!root) {
-        fprintf(stderr, "Failed to parse particle effects JSON\n");
+    JsonDoc doc;
+    if (!json_doc_open(&doc, filepath)) {
+        fprintf(stderr, "Failed to load particle effects: %s\n", filepath);
         return false;
     }
 
     s_effect_count = 0;
 
     // Iterate over all effects in the JSON object
-    cJSON* effect_json = NULL;
-    cJSON_ArrayForEach(effect_json, root) {
+    JsonValue effect_json;
+    JSON_FOR_EACH(effect_json, doc.root) {
         if (s_effect_count >= MAX_EFFECTS) break;
 
         ParticleEffect* effect = &s_effects[s_effect_count];
         memset(effect, 0, sizeof(ParticleEffect));
 
         // Name is the key
-        strncpy(effect->name, effect_json->string, MAX_EFFECT_NAME - 1);
+        json_string(effect_json_iter.key, effect->name, MAX_EFFECT_NAME);
 
         // Enabled (default true)
-        cJSON* enabled = cJSON_GetObjectItem(effect_json, "enabled");
-        effect->enabled = enabled ? cJSON_IsTrue(enabled) : true;
+        JsonValue enabled = json_field(effect_json, "enabled");
+        effect->enabled = json_is_bool(enabled) ? json_is_true(enabled) : true;
 
         // Intensity (default 1.0)
-        cJSON* intensity = cJSON_GetObjectItem(effect_json, "intensity");
-        effect->intensity = intensity ? (float)intensity->valuedouble : 1.0f;
+        JsonValue intensity = json_field(effect_json, "intensity");
+        effect->intensity = json_is_number(intensity) ? (float)json_number(intensity) : 1.0f;
 
         // Trigger settings
-        cJSON* slip = cJSON_GetObjectItem(effect_json, "slip_threshold");
-        effect->slip_threshold = slip ? (float)slip->valuedouble : 0.15f;
+        JsonValue slip = json_field(effect_json, "slip_threshold");
+        effect->slip_threshold = json_is_number(slip) ? (float)json_number(slip) : 0.15f;
 
-        cJSON* min_vel = cJSON_GetObjectItem(effect_json, "min_velocity");
-        effect->min_velocity = min_vel ? (float)min_vel->valuedouble : 1.0f;
+        JsonValue min_vel = json_field(effect_json, "min_velocity");
+        effect->min_velocity = json_is_number(min_vel) ? (float)json_number(min_vel) : 1.0f;
 
         // Colors (start_color/end_color for gradient, or just "color" for static)
         Vec3 default_color = vec3(0.6f, 0.6f, 0.6f);
 
-        cJSON* start_col = cJSON_GetObjectItem(effect_json, "start_color");
-        cJSON* end_col = cJSON_GetObjectItem(effect_json, "end_color");
-        cJSON* color = cJSON_GetObjectItem(effect_json, "color");
+        JsonValue start_col = json_field(effect_json, "start_color");
+        JsonValue end_col = json_field(effect_json, "end_color");
+        JsonValue color = json_field(effect_json, "color");
 
         // Parse start_color (fallback to "color" or default)
-        if (start_col && cJSON_IsArray(start_col) && cJSON_GetArraySize(start_col) >= 3) {
-            effect->start_color.x = (float)cJSON_GetArrayItem(start_col, 0)->valuedouble;
-            effect->start_color.y = (float)cJSON_GetArrayItem(start_col, 1)->valuedouble;
-            effect->start_color.z = (float)cJSON_GetArrayItem(start_col, 2)->valuedouble;
-        } else if (color && cJSON_IsArray(color) && cJSON_GetArraySize(color) >= 3) {
-            effect->start_color.x = (float)cJSON_GetArrayItem(color, 0)->valuedouble;
-            effect->start_color.y = (float)cJSON_GetArrayItem(color, 1)->valuedouble;
-            effect->start_color.z = (float)cJSON_GetArrayItem(color, 2)->valuedouble;
+        if (json_is_array(start_col) && json_count(start_col) >= 3) {
+            effect->start_color.x = (float)json_number(json_index(start_col, 0));
+            effect->start_color.y = (float)json_number(json_index(start_col, 1));
+            effect->start_color.z = (float)json_number(json_index(start_col, 2));
+        } else if (json_is_array(color) && json_count(color) >= 3) {
+            effect->start_color.x = (float)json_number(json_index(color, 0));
+            effect->start_color.y = (float)json_number(json_index(color, 1));
+            effect->start_color.z = (float)json_number(json_index(color, 2));
         } else {
             effect->start_color = default_color;
         }
 
         // Parse end_color (fallback to start_color for no gradient)
-        if (end_col && cJSON_IsArray(end_col) && cJSON_GetArraySize(end_col) >= 3) {
-            effect->end_color.x = (float)cJSON_GetArrayItem(end_col, 0)->valuedouble;
-            effect->end_color.y = (float)cJSON_GetArrayItem(end_col, 1)->valuedouble;
-            effect->end_color.z = (float)cJSON_GetArrayItem(end_col, 2)->valuedouble;
+        if (json_is_array(end_col) && json_count(end_col) >= 3) {
+            effect->end_color.x = (float)json_number(json_index(end_col, 0));
+            effect->end_color.y = (float)json_number(json_index(end_col, 1));
+            effect->end_color.z = (float)json_number(json_index(end_col, 2));
         } else {
             effect->end_color = effect->start_color;  // No gradient by default
         }
 
         // Size [min, max]
-        cJSON* size_arr = cJSON_GetObjectItem(effect_json, "size");
-        if (size_arr && cJSON_IsArray(size_arr) && cJSON_GetArraySize(size_arr) >= 2) {
-            effect->min_size = (float)cJSON_GetArrayItem(size_arr, 0)->valuedouble;
-            effect->max_size = (float)cJSON_GetArrayItem(size_arr, 1)->valuedouble;
+        JsonValue size_arr = json_field(effect_json, "size");
+        if (json_is_array(size_arr) && json_count(size_arr) >= 2) {
+            effect->min_size = (float)json_number(json_index(size_arr, 0));
+            effect->max_size = (float)json_number(json_index(size_arr, 1));
         } else {
             effect->min_size = 0.2f;
             effect->max_size = 0.4f;
         }
 
         // Lifetime [min, max]
-        cJSON* life_arr = cJSON_GetObjectItem(effect_json, "lifetime");
-        if (life_arr && cJSON_IsArray(life_arr) && cJSON_GetArraySize(life_arr) >= 2) {
-            effect->min_lifetime = (float)cJSON_GetArrayItem(life_arr, 0)->valuedouble;
-            effect->max_lifetime = (float)cJSON_GetArrayItem(life_arr, 1)->valuedouble;
+        JsonValue life_arr = json_field(effect_json, "lifetime");
+        if (json_is_array(life_arr) && json_count(life_arr) >= 2) {
+            effect->min_lifetime = (float)json_number(json_index(life_arr, 0));
+            effect->max_lifetime = (float)json_number(json_index(life_arr, 1));
         } else {
             effect->min_lifetime = 0.5f;
             effect->max_lifetime = 0.9f;
         }
 
         // Size growth
-        cJSON* growth = cJSON_GetObjectItem(effect_json, "size_growth");
-        effect->size_growth = growth ? (float)growth->valuedouble : 1.8f;
+        JsonValue growth = json_field(effect_json, "size_growth");
+        effect->size_growth = json_is_number(growth) ? (float)json_number(growth) : 1.8f;
 
         // Spread (velocity randomness)
-        cJSON* spread = cJSON_GetObjectItem(effect_json, "spread");
-        effect->velocity_randomness = spread ? (float)spread->valuedouble : 0.8f;
+        JsonValue spread = json_field(effect_json, "spread");
+        effect->velocity_randomness = json_is_number(spread) ? (float)json_number(spread) : 0.8f;
 
         // Gravity
-        cJSON* grav = cJSON_GetObjectItem(effect_json, "gravity");
-        if (grav && cJSON_IsArray(grav) && cJSON_GetArraySize(grav) >= 3) {
-            effect->gravity.x = (float)cJSON_GetArrayItem(grav, 0)->valuedouble;
-            effect->gravity.y = (float)cJSON_GetArrayItem(grav, 1)->valuedouble;
-            effect->gravity.z = (float)cJSON_GetArrayItem(grav, 2)->valuedouble;
+        JsonValue grav = json_field(effect_json, "gravity");
+        if (json_is_array(grav) && json_count(grav) >= 3) {
+            effect->gravity.x = (float)json_number(json_index(grav, 0));
+            effect->gravity.y = (float)json_number(json_index(grav, 1));
+            effect->gravity.z = (float)json_number(json_index(grav, 2));
         } else {
             effect->gravity = vec3(0.0f, 0.4f, 0.0f);
         }
 
         // Spawn scatter (position randomness)
-        cJSON* scatter = cJSON_GetObjectItem(effect_json, "spawn_scatter");
-        effect->spawn_scatter = scatter ? (float)scatter->valuedouble : 0.15f;
+        JsonValue scatter = json_field(effect_json, "spawn_scatter");
+        effect->spawn_scatter = json_is_number(scatter) ? (float)json_number(scatter) : 0.15f;
 
         // Vertical velocity [min, max]
-        cJSON* vert_vel = cJSON_GetObjectItem(effect_json, "vertical_velocity");
-        if (vert_vel && cJSON_IsArray(vert_vel) && cJSON_GetArraySize(vert_vel) >= 2) {
-            effect->min_vertical_vel = (float)cJSON_GetArrayItem(vert_vel, 0)->valuedouble;
-            effect->max_vertical_vel = (float)cJSON_GetArrayItem(vert_vel, 1)->valuedouble;
+        JsonValue vert_vel = json_field(effect_json, "vertical_velocity");
+        if (json_is_array(vert_vel) && json_count(vert_vel) >= 2) {
+            effect->min_vertical_vel = (float)json_number(json_index(vert_vel, 0));
+            effect->max_vertical_vel = (float)json_number(json_index(vert_vel, 1));
         } else {
             effect->min_vertical_vel = 0.2f;
             effect->max_vertical_vel = 0.6f;
         }
 
         // Alpha [min, max]
-        cJSON* alpha_arr = cJSON_GetObjectItem(effect_json, "alpha");
-        if (alpha_arr && cJSON_IsArray(alpha_arr) && cJSON_GetArraySize(alpha_arr) >= 2) {
-            effect->min_alpha = (float)cJSON_GetArrayItem(alpha_arr, 0)->valuedouble;
-            effect->max_alpha = (float)cJSON_GetArrayItem(alpha_arr, 1)->valuedouble;
+        JsonValue alpha_arr = json_field(effect_json, "alpha");
+        if (json_is_array(alpha_arr) && json_count(alpha_arr) >= 2) {
+            effect->min_alpha = (float)json_number(json_index(alpha_arr, 0));
+            effect->max_alpha = (float)json_number(json_index(alpha_arr, 1));
         } else {
             effect->min_alpha = 0.5f;
             effect->max_alpha = 0.8f;
         }
 
         // Spawn height (Y offset)
-        cJSON* height = cJSON_GetObjectItem(effect_json, "spawn_height");
-        effect->spawn_height = height ? (float)height->valuedouble : 0.08f;
+        JsonValue height = json_field(effect_json, "spawn_height");
+        effect->spawn_height = json_is_number(height) ? (float)json_number(height) : 0.08f;
 
         printf("Loaded particle effect: %s\n", effect->name);
         s_effect_count++;
     }
 
-    cJSON_Delete(root);
+    json_doc_close(&doc);
     printf("Loaded %d particle effects from %s\n", s_effect_count, filepath);
     return true;
 }
@@ -0,0 +1,139 @@
+/*
+ * Physics Debug Visualization
+ * Draws chassis boxes, forward arrows and wheel circles for every vehicle.
+ * Lives on the render side so the physics core stays free of GL.
+ */
+
+#include "../physics/sim_thread.h"
+#include "line_render.h"
+#include <math.h>
+
+// Transform a chassis-local point to world space (rot is 3x3 row-major)
+static Vec3 local_to_world(const float* rot, Vec3 origin, float lx, float ly, float lz)
+{
+    Vec3 w;
+    w.x = origin.x + rot[0] * lx + rot[1] * ly + rot[2] * lz;
+    w.y = origin.y + rot[3] * lx + rot[4] * ly + rot[5] * lz;
+    w.z = origin.z + rot[6] * lx + rot[7] * ly + rot[8] * lz;
+    return w;
+}
+
+void physics_debug_draw(const SimFrame* frame, float alpha, struct LineRenderer* lr)
+{
+    if (!frame || !lr) return;
+
+    // Draw ground grid
+    float gridSize = 50.0f;
+    float gridStep = 5.0f;
+    float y = frame->ground_level + 0.01f;
+
+    for (float x = -gridSize; x <= gridSize; x += gridStep)
+    {
+        line_renderer_draw_line(lr,
+            (Vec3){x, y, -gridSize}, (Vec3){x, y, gridSize},
+            (Vec3){0.3f, 0.5f, 0.3f}, 1.0f);
+        line_renderer_draw_line(lr,
+            (Vec3){-gridSize, y, x}, (Vec3){gridSize, y, x},
+            (Vec3){0.3f, 0.5f, 0.3f}, 1.0f);
+    }
+
+    // Draw vehicles at the same interpolated pose as the rendered meshes
+    for (int n = 0; n < frame->vehicle_count; n++)
+    {
+        const SimVehicleState* v = &frame->vehicles[n];
+
+        Vec3 pos = {0, 0, 0};
+        float rot[9];
+        sim_vehicle_render_transform(v, alpha, &pos, rot);
+        WheelState wheels[4];
+        sim_vehicle_render_wheels(v, alpha, wheels);
+
+        // Draw chassis box outline
+        float hw = v->chassis_width * 0.5f;
+        float hh = v->chassis_height * 0.5f;
+        float hl = v->chassis_length * 0.5f;
+
+        Vec3 corners[8];
+        Vec3 localCorners[8] = {
+            {-hw, -hh, -hl}, {hw, -hh, -hl}, {hw, hh, -hl}, {-hw, hh, -hl},
+            {-hw, -hh, hl}, {hw, -hh, hl}, {hw, hh, hl}, {-hw, hh, hl}
+        };
+
+        for (int c = 0; c < 8; c++)
+        {
+            corners[c] = local_to_world(rot, pos, localCorners[c].x, localCorners[c].y, localCorners[c].z);
+        }
+
+        Vec3 red = {0.8f, 0.2f, 0.2f};
+        Vec3 green = {0.2f, 0.8f, 0.2f};
+
+        // Back face (corners 0-3 at z=-hl) - RED
+        line_renderer_draw_line(lr, corners[0], corners[1], red, 1.0f);
+        line_renderer_draw_line(lr, corners[1], corners[2], red, 1.0f);
+        line_renderer_draw_line(lr, corners[2], corners[3], red, 1.0f);
+        line_renderer_draw_line(lr, corners[3], corners[0], red, 1.0f);
+
+        // Front face (corners 4-7 at z=+hl) - GREEN (physics forward)
+        line_renderer_draw_line(lr, corners[4], corners[5], green, 1.0f);
+        line_renderer_draw_line(lr, corners[5], corners[6], green, 1.0f);
+        line_renderer_draw_line(lr, corners[6], corners[7], green, 1.0f);
+        line_renderer_draw_line(lr, corners[7], corners[4], green, 1.0f);
+
+        // Verticals - RED for back, GREEN for front
+        line_renderer_draw_line(lr, corners[0], corners[4], red, 1.0f);
+        line_renderer_draw_line(lr, corners[1], corners[5], red, 1.0f);
+        line_renderer_draw_line(lr, corners[2], corners[6], green, 1.0f);
+        line_renderer_draw_line(lr, corners[3], corners[7], green, 1.0f);
+
+        // Draw forward arrow from center in +Z direction (physics forward)
+        Vec3 fwd = local_to_world(rot, pos, 0, 0, hl * 1.5f);           // Arrow extends past front
+        Vec3 arrL = local_to_world(rot, pos, -hw * 0.3f, 0, hl * 1.2f); // Arrow head left
+        Vec3 arrR = local_to_world(rot, pos, hw * 0.3f, 0, hl * 1.2f);  // Arrow head right
+        line_renderer_draw_line(lr, pos, fwd, green, 2.0f);
+        line_renderer_draw_line(lr, fwd, arrL, green, 2.0f);
+        line_renderer_draw_line(lr, fwd, arrR, green, 2.0f);
+
+        // Draw wheels - use stored wheel rotation matrix from Jolt
+        // POC draws cylinder in local X-Z plane with Y as axle direction
+        Vec3 blue = {0.2f, 0.2f, 0.8f};
+        for (int w = 0; w < 4; w++)
+        {
+            float radius = v->wheel_radius[w];
+
+            // Get wheel world position
+            Vec3 wpos = wheels[w].position;
+
+            // Get wheel orientation from stored rotation matrix
+            // rot_matrix layout: [0-2]=col0(X/right), [3-5]=col1(Y/axle), [6-8]=col2(Z/forward)
+            float* rm = wheels[w].rot_matrix;
+
+            // Wheel circle is in local X-Z plane (perpendicular to Y axle)
+            // X column = horizontal extent of circle
+            Vec3 wheelX = {rm[0], rm[1], rm[2]};
+            // Z column = vertical extent of circle
+            Vec3 wheelZ = {rm[6], rm[7], rm[8]};
+
+            // Draw circle: local p = (cos*r, 0, sin*r) transformed to world
+            // world p = pos + cos*r*X_col + sin*r*Z_col
+            const int segments = 16;
+            for (int s = 0; s < segments; s++)
+            {
+                float a1 = (float)s / segments * 2.0f * 3.14159f;
+                float a2 = (float)(s + 1) / segments * 2.0f * 3.14159f;
+
+                Vec3 p1 = {
+                    wpos.x + cosf(a1) * radius * wheelX.x + sinf(a1) * radius * wheelZ.x,
+                    wpos.y + cosf(a1) * radius * wheelX.y + sinf(a1) * radius * wheelZ.y,
+                    wpos.z + cosf(a1) * radius * wheelX.z + sinf(a1) * radius * wheelZ.z
+                };
+                Vec3 p2 = {
+                    wpos.x + cosf(a2) * radius * wheelX.x + sinf(a2) * radius * wheelZ.x,
+                    wpos.y + cosf(a2) * radius * wheelX.y + sinf(a2) * radius * wheelZ.y,
+                    wpos.z + cosf(a2) * radius * wheelX.z + sinf(a2) * radius * wheelZ.z
+                };
+
+                line_renderer_draw_line(lr, p1, p2, blue, 1.0f);
+            }
+        }
+    }
+}
@@ -1,25 +1,35 @@
 #include "texture.h"
 #include <stdio.h>
+#include <string.h>
 
 #define STB_IMAGE_IMPLEMENTATION
 #include "../vendor/stb_image.h"
 
-GLuint texture_load(const char* filepath) {
-    int width, height, channels;
+bool texture_decode(TextureImage* image, const char* filepath) {
+    memset(image, 0, sizeof(*image));
 
-    // Flip vertically so (0,0) is bottom-left (OpenGL convention)
-    stbi_set_flip_vertically_on_load(1);
+    // Flip vertically so (0,0) is bottom-left (OpenGL convention).
+    // Per-thread setting: decodes may run on several workers at once.
+    stbi_set_flip_vertically_on_load_thread(1);
 
-    unsigned char* data = stbi_load(filepath, &width, &height, &channels, 0);
-    if (!data) {
+    image->pixels = stbi_load(filepath, &image->width, &image->height, &image->channels, 0);
+    if (!image->pixels) {
         fprintf(stderr, "Failed to load texture: %s\n", filepath);
-        return 0;
+        return false;
     }
 
+    printf("Loaded texture: %s (%dx%d, %d channels)\n", filepath,
+           image->width, image->height, image->channels);
+    return true;
+}
+
+GLuint texture_upload(const TextureImage* image) {
+    if (!image->pixels) return 0;
+
     GLenum format = GL_RGB;
-    if (channels == 4) {
+    if (image->channels == 4) {
         format = GL_RGBA;
-    } else if (channels == 1) {
+    } else if (image->channels == 1) {
         format = GL_RED;
     }
 
@@ -34,11 +44,22 @@ GLuint texture_load(const char* filepath) {
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
 
     // Upload texture data
-    glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, data);
+    glTexImage2D(GL_TEXTURE_2D, 0, format, image->width, image->height, 0, format, GL_UNSIGNED_BYTE, image->pixels);
+
+    return texture;
+}
 
-    stbi_image_free(data);
+void texture_image_free(TextureImage* image) {
+    if (image->pixels) stbi_image_free(image->pixels);
+    memset(image, 0, sizeof(*image));
+}
+
+GLuint texture_load(const char* filepath) {
+    TextureImage image;
+    if (!texture_decode(&image, filepath)) return 0;
 
-    printf("Loaded texture: %s (%dx%d, %d channels)\n", filepath, width, height, channels);
+    GLuint texture = texture_upload(&image);
+    texture_image_free(&image);
     return texture;
 }
 
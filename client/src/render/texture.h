@@ -4,10 +4,24 @@
 #include <GL/glew.h>
 #include <stdbool.h>
 
+// Decoded pixels, not yet on the GPU
+typedef struct {
+    unsigned char* pixels;
+    int width;
+    int height;
+    int channels;
+} TextureImage;
+
 // Load a texture from a PNG file
 // Returns the OpenGL texture ID, or 0 on failure
 GLuint texture_load(const char* filepath);
 
+// Decode without touching GL (safe on worker threads), then upload on the
+// GL thread. texture_load does both. Free image with texture_image_free.
+bool texture_decode(TextureImage* image, const char* filepath);
+GLuint texture_upload(const TextureImage* image);
+void texture_image_free(TextureImage* image);
+
 // Free a loaded texture
 void texture_destroy(GLuint texture);
 
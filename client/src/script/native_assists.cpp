@@ -0,0 +1,129 @@
+/*
+ * Native Driver Assists Implementation
+ * Ports of the Lua modules; keep the two in step when either changes.
+ */
+
+#include "native_assists.h"
+
+#include <math.h>
+#include <string.h>
+
+typedef struct {
+    const char* name;
+    unsigned modules;
+} NativeScriptDef;
+
+static const NativeScriptDef NATIVE_SCRIPTS[] = {
+    { "freestyle_assist", NATIVE_ASSIST_ABS | NATIVE_ASSIST_TCS | NATIVE_ASSIST_ESC },
+    { "abs",              NATIVE_ASSIST_ABS },
+    { "tcs",              NATIVE_ASSIST_TCS },
+    { "esc",              NATIVE_ASSIST_ESC },
+    { "launch_control",   NATIVE_ASSIST_LAUNCH },
+};
+
+// Option value, or def if the vehicle JSON does not set it
+static float option_or(const char* const keys[], const float values[], int count,
+                       const char* key, float def) {
+    for (int i = 0; i < count; i++) {
+        if (keys[i] && strcmp(keys[i], key) == 0) return values[i];
+    }
+    return def;
+}
+
+// modules/abs.lua: ease off the brake while a wheel is locking
+static void abs_update(const NativeAssistConfig* config, const NativeAssistInput* input,
+                       ScriptControls* controls) {
+    if (!config->abs_enabled) return;
+
+    float brake_input = controls->brake;
+    if (brake_input <= 0.1f) return;          // No significant braking
+    float speed = input->speed_ms;
+    if (speed < config->abs_min_speed) return;  // Allow lockup at low speed for full stop
+
+    // Most negative slip over the wheels (wheel slower than ground)
+    float min_slip = 0.0f;
+    for (int w = 0; w < 4; w++) {
+        float wheel_speed = fabsf(input->angular_velocity[w] * input->radius[w]);
+        float max_speed = fmaxf(fmaxf(wheel_speed, speed), 0.1f);
+        float slip = (wheel_speed - speed) / max_speed;
+        if (slip < min_slip) min_slip = slip;
+    }
+
+    if (min_slip < -NATIVE_ABS_SLIP_THRESHOLD) {
+        float reduction = fminf(-min_slip * 2.0f, NATIVE_ABS_BRAKE_REDUCTION);
+        controls->brake = brake_input * (1.0f - reduction);
+    }
+}
+
+// modules/launch_control.lua: cut throttle on wheelspin at low speed
+static void launch_control_update(const NativeAssistConfig* config, const NativeAssistInput* input,
+                                  ScriptControls* controls) {
+    if (!config->lc_enabled) return;
+    if (input->speed_ms > config->lc_max_speed) return;
+
+    float throttle = controls->throttle;
+    if (throttle < 0.1f) return;
+
+    float max_slip = 0.0f;
+    for (int w = 0; w < 4; w++) {
+        max_slip = fmaxf(max_slip, input->slip[w]);
+    }
+    if (max_slip <= config->lc_slip_threshold) return;
+
+    // At the threshold -> full throttle, at 100% slip -> min_throttle
+    float slip_excess = (max_slip - config->lc_slip_threshold) / (1.0f - config->lc_slip_threshold);
+    slip_excess = fminf(slip_excess, 1.0f);
+    float throttle_mult = 1.0f - slip_excess * (1.0f - config->lc_min_throttle);
+    controls->throttle = fmaxf(throttle * throttle_mult, config->lc_min_throttle);
+}
+
+extern "C" {
+
+bool native_assist_find(const char* script_name,
+                        const char* const config_keys[],
+                        const float config_values[],
+                        int config_count,
+                        NativeAssistConfig* out) {
+    if (!script_name || !out) return false;
+
+    const NativeScriptDef* def = NULL;
+    for (size_t i = 0; i < sizeof(NATIVE_SCRIPTS) / sizeof(NATIVE_SCRIPTS[0]); i++) {
+        if (strcmp(NATIVE_SCRIPTS[i].name, script_name) == 0) {
+            def = &NATIVE_SCRIPTS[i];
+            break;
+        }
+    }
+    if (!def) return false;
+
+    // Same keys and defaults as freestyle_assist.lua, launch_control.lua and
+    // the module tables
+    const char* const* k = config_keys;
+    const float* v = config_values;
+    int n = config_keys && config_values ? config_count : 0;
+
+    memset(out, 0, sizeof(*out));
+    out->modules = def->modules;
+    out->abs_enabled = option_or(k, v, n, "abs_enabled", 1.0f) != 0.0f;
+    out->abs_min_speed = option_or(k, v, n, "abs_min_speed", 2.2f);
+    out->tcs_enabled = option_or(k, v, n, "tcs_enabled", 0.0f) != 0.0f;
+    out->tcs_min_speed = option_or(k, v, n, "tcs_min_speed", 1.0f);
+    out->esc_enabled = option_or(k, v, n, "esc_enabled", 0.0f) != 0.0f;
+    out->lc_enabled = option_or(k, v, n, "lc_enabled", 0.0f) != 0.0f;
+    out->lc_max_speed = option_or(k, v, n, "lc_max_speed", 15.0f);
+    out->lc_slip_threshold = option_or(k, v, n, "lc_slip_threshold", 0.5f);
+    out->lc_min_throttle = option_or(k, v, n, "lc_min_throttle", 0.3f);
+    return true;
+}
+
+void native_assist_update(const NativeAssistConfig* config,
+                          const NativeAssistInput* input,
+                          ScriptControls* controls) {
+    if (!config || !input || !controls) return;
+
+    if (config->modules & NATIVE_ASSIST_ABS) abs_update(config, input, controls);
+    // TCS and ESC are placeholders in Lua too (the friction curve handles
+    // wheelspin); nothing to do until those modules grow a controller
+    if (config->modules & NATIVE_ASSIST_LAUNCH) launch_control_update(config, input, controls);
+}
+
+} // extern "C"
@@ -0,0 +1,80 @@
+/*
+ * Native Driver Assists
+ * C++ versions of the stock Lua assist modules (modules/abs.lua, tcs.lua,
+ * esc.lua, launch_control.lua) for vehicles that do not need them scripted.
+ *
+ * Each native script is registered under the name a vehicle JSON already
+ * uses and reads the same options:
+ *   freestyle_assist   abs + tcs + esc, as scripts/freestyle_assist.lua
+ *                      (abs_enabled, abs_min_speed, tcs_enabled,
+ *                       tcs_min_speed, esc_enabled)
+ *   abs, tcs, esc      one module each (same option keys)
+ *   launch_control     as scripts/launch_control.lua (lc_enabled,
+ *                      lc_max_speed, lc_slip_threshold, lc_min_throttle)
+ *
+ * Behaviour and defaults match the Lua modules step for step, including
+ * the TCS and ESC placeholders, which leave the controls alone. The
+ * controllers are stateless: one call filters one vehicle's controls.
+ */
+
+#ifndef NATIVE_ASSISTS_H
+#define NATIVE_ASSISTS_H
+
+#include <stdbool.h>
+#include "reflex_script.h"
+
+// Modules a native script runs (NativeAssistConfig.modules)
+#define NATIVE_ASSIST_ABS     (1u << 0)
+#define NATIVE_ASSIST_TCS     (1u << 1)
+#define NATIVE_ASSIST_ESC     (1u << 2)
+#define NATIVE_ASSIST_LAUNCH  (1u << 3)
+
+// modules/abs.lua constants
+#define NATIVE_ABS_SLIP_THRESHOLD  0.15f
+#define NATIVE_ABS_BRAKE_REDUCTION 0.5f
+
+typedef struct {
+    unsigned modules;
+
+    bool abs_enabled;
+    float abs_min_speed;        // m/s
+    bool tcs_enabled;
+    float tcs_min_speed;        // m/s (unused while TCS is a placeholder)
+    bool esc_enabled;
+
+    bool lc_enabled;
+    float lc_max_speed;         // m/s, inactive above
+    float lc_slip_threshold;    // Wheel slip that starts cutting throttle
+    float lc_min_throttle;      // Never cut below this
+} NativeAssistConfig;
+
+// What the assists read (a subset of ctx.telemetry)
+typedef struct {
+    float speed_ms;
+    float angular_velocity[4];
+    float radius[4];
+    float slip[4];              // Longitudinal slip
+} NativeAssistInput;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Look up a native script by name and build its config from the vehicle
+// JSON options. Returns false if script_name has no native version.
+bool native_assist_find(const char* script_name,
+                        const char* const config_keys[],
+                        const float config_values[],
+                        int config_count,
+                        NativeAssistConfig* out);
+
+// Filter one vehicle's controls for one step
+void native_assist_update(const NativeAssistConfig* config,
+                          const NativeAssistInput* input,
+                          ScriptControls* controls);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NATIVE_ASSISTS_H
@@ -7,15 +7,91 @@
  * - Master script manages per-vehicle script instances via loadfile()
  * - Each vehicle gets an isolated script environment
  * - Modules (abs, tcs) are singletons loaded via require()
+ * - Optional script lanes (reflex_create_lanes): several Lua states, each
+ *   with its own master.lua, updated in parallel on the physics job system
+ * - Native scripts (reflex_attach_native_script): C++ ports of the stock
+ *   assists, run on the Lua results; a vehicle with no Lua scripts skips Lua
  */
 
 #include "reflex_script.h"
+#include "native_assists.h"
+#include "script_cache.h"
+#include "script_profile.h"
 #include "../physics/jolt_physics.h"
+#include "../util/log.h"
+#include "../util/profiler.h"
 
 #include <sol/sol.hpp>
 #include <string>
 #include <iostream>
 #include <cmath>
+#include <cstring>
+#include <cstdio>
+#include <algorithm>
+#include <vector>
+
+// A vehicle's ctx table and everything hanging off it. Built on the vehicle's
+// first update and refilled in place after that, so a step allocates nothing
+// on the Lua heap.
+struct VehicleScriptContext {
+    bool built = false;
+    sol::table ctx;
+    sol::table telemetry;
+    sol::table position;
+    sol::table wheels;
+    sol::table wheel[4];
+    sol::table controls;
+    sol::table wheel_brake;
+};
+
+// Physics state one script update reads, gathered on the calling thread so
+// lanes running on workers never touch the PhysicsWorld
+struct VehicleScriptSample {
+    int id;
+    Vec3 position;
+    float heading;              // Radians
+    float speed_ms;
+    WheelState wheels[4];
+    float wheel_radius[4];
+    float steering;
+    float throttle;
+    float brake;
+    float handbrake;
+};
+
+// Built-in C++ script attached in place of its Lua version
+struct NativeScript {
+    char name[REFLEX_SCRIPT_NAME_MAX];
+    NativeAssistConfig config;
+};
+
+// Which kinds of script a vehicle runs
+struct VehicleScriptSet {
+    bool lua = false;                   // Any Lua script attached (master.update needed)
+    std::vector<NativeScript> native;   // Run in order on the controls Lua leaves
+};
+
+// spawn_particle call held back until the lanes have finished
+struct DeferredParticle {
+    std::string effect_name;
+    float x, y, z;
+    float intensity;
+};
+
+// Cost record for one attached script. master.lua holds the slot index.
+struct ScriptCostSlot {
+    bool in_use;
+    int vehicle_id;
+    char script_name[REFLEX_SCRIPT_NAME_MAX];
+    uint32_t calls;
+    uint32_t overruns;
+    int strikes;                // Overruns in a row
+    int suspend_left;           // Updates still to skip
+    float last_us;
+    float min_us;
+    double total_us;
+    float history[REFLEX_COST_HISTORY];  // Ring, indexed by calls
+};
 
 // Script engine - manages Lua state and master script
 struct ReflexScriptEngine {
@@ -23,9 +99,50 @@ struct ReflexScriptEngine {
     sol::table master;  // The master script module
     bool valid;
 
+    // Cached master entry points (update_all may be missing in older masters)
+    sol::protected_function update_fn;
+    sol::protected_function update_all_fn;
+
+    // ctx array handed to master.update_all, reused every step
+    sol::table batch;
+    int batch_count;
+
     // Particle spawning callback
     ParticleSpawnCallback particle_callback;
     void* particle_user_data;
+
+    // Script clock (advanced once per reflex_update_all batch; the
+    // per-vehicle reflex_update_vehicle path advances it on vehicle 0)
+    float accumulated_time;
+    int debug_counter;
+
+    // Storage for the last turn result level (to return const char* safely)
+    char result_level[32];
+
+    // Persistent ctx tables, indexed by vehicle id (declared after lua so
+    // they are released before the state closes)
+    std::vector<VehicleScriptContext> contexts;
+
+    // Lua/native scripts per vehicle id (on the vehicle's lane)
+    std::vector<VehicleScriptSet> script_sets;
+
+    // Extra Lua states from reflex_create_lanes. Vehicle id % lane count picks
+    // the lane: 0 is this engine, i > 0 is lanes[i - 1]. Empty = one state.
+    std::vector<ReflexScriptEngine*> lanes;
+
+    // While lanes run on worker threads, spawn_particle queues here instead
+    // of calling particle_callback
+    bool defer_particles;
+    std::vector<DeferredParticle> deferred_particles;
+
+    // Per-script cost tracking (reflex_run_script) and instruction budget
+    int instruction_budget;  // 0 = unlimited
+    std::vector<ScriptCostSlot> costs;
+
+    // reflex_update_all scratch, sized on first use
+    std::vector<VehicleScriptSample> samples;
+    std::vector<ScriptControls> outputs;
+    std::vector<std::vector<int>> lane_members;  // samples[] indices per lane
 };
 
 // Helper: convert radians to degrees
@@ -38,13 +155,207 @@ static float ms_to_mph(float ms) {
     return ms * 2.23694f;
 }
 
+// Lua state that runs vehicle_id's scripts
+static ReflexScriptEngine* lane_for(ReflexScriptEngine* engine, int vehicle_id) {
+    if (engine->lanes.empty() || vehicle_id < 0) return engine;
+    int lane = vehicle_id % (int)(engine->lanes.size() + 1);
+    return lane == 0 ? engine : engine->lanes[lane - 1];
+}
+
+static ReflexScriptEngine* lane_at(ReflexScriptEngine* engine, int lane) {
+    return lane == 0 ? engine : engine->lanes[lane - 1];
+}
+
+// Persistent ctx tables for a vehicle, created on first use
+static VehicleScriptContext* get_vehicle_context(ReflexScriptEngine* engine, int vehicle_id) {
+    if (vehicle_id < 0 || vehicle_id >= MAX_PHYSICS_VEHICLES) return nullptr;
+    if ((size_t)vehicle_id >= engine->contexts.size()) {
+        engine->contexts.resize(vehicle_id + 1);
+    }
+
+    VehicleScriptContext* c = &engine->contexts[vehicle_id];
+    if (!c->built) {
+        sol::state& lua = engine->lua;
+        c->ctx = lua.create_table(0, 6);
+        c->telemetry = lua.create_table(0, 6);
+        c->position = lua.create_table(0, 3);
+        c->wheels = lua.create_table(4, 0);
+        for (int w = 0; w < 4; w++) {
+            c->wheel[w] = lua.create_table(0, 4);
+            c->wheels[w + 1] = c->wheel[w];  // Lua arrays are 1-indexed
+        }
+        c->controls = lua.create_table(0, 5);
+        c->wheel_brake = lua.create_table(4, 0);
+
+        c->telemetry["position"] = c->position;
+        c->telemetry["wheels"] = c->wheels;
+        c->built = true;
+    }
+    return c;
+}
+
+static VehicleScriptSet* get_script_set(ReflexScriptEngine* engine, int vehicle_id) {
+    if (vehicle_id < 0 || vehicle_id >= MAX_PHYSICS_VEHICLES) return nullptr;
+    if ((size_t)vehicle_id >= engine->script_sets.size()) {
+        engine->script_sets.resize(vehicle_id + 1);
+    }
+    return &engine->script_sets[vehicle_id];
+}
+
+// Script set for an update, or NULL if nothing was ever attached
+static const VehicleScriptSet* find_script_set(ReflexScriptEngine* engine, int vehicle_id) {
+    ReflexScriptEngine* lane = lane_for(engine, vehicle_id);
+    if (vehicle_id < 0 || (size_t)vehicle_id >= lane->script_sets.size()) return nullptr;
+    return &lane->script_sets[vehicle_id];
+}
+
+// ============================================================================
+// Script cost tracking (C functions called from master.lua)
+// ============================================================================
+
+// Set by the count hook so the caller can tell an overrun from a script error
+static thread_local bool t_budget_exceeded = false;
+
+// Once over budget, fire on every instruction: a script that catches the
+// error with pcall is stopped again as soon as it runs its own code
+static void budget_hook(lua_State* L, lua_Debug* ar) {
+    (void)ar;
+    t_budget_exceeded = true;
+    lua_sethook(L, budget_hook, LUA_MASKCOUNT, 1);
+    luaL_error(L, "instruction budget exceeded");
+}
+
+static ReflexScriptEngine* closure_engine(lua_State* L) {
+    return (ReflexScriptEngine*)lua_touserdata(L, lua_upvalueindex(1));
+}
+
+static ScriptCostSlot* cost_slot_at(ReflexScriptEngine* engine, int slot) {
+    if (slot < 0 || (size_t)slot >= engine->costs.size()) return nullptr;
+    ScriptCostSlot* cost = &engine->costs[slot];
+    return cost->in_use ? cost : nullptr;
+}
+
+static void record_script_cost(ScriptCostSlot* cost, float us, bool overrun) {
+    cost->history[cost->calls % REFLEX_COST_HISTORY] = us;
+    if (cost->calls == 0 || us < cost->min_us) cost->min_us = us;
+    cost->calls++;
+    cost->total_us += us;
+    cost->last_us = us;
+
+    if (!overrun) {
+        cost->strikes = 0;
+        return;
+    }
+
+    cost->overruns++;
+    if (++cost->strikes >= REFLEX_OVERRUN_STRIKES) {
+        cost->strikes = 0;
+        cost->suspend_left = REFLEX_SUSPEND_UPDATES;
+        LOG_WARN(LOG_SCRIPT, "[Reflex] '%s' on vehicle %d over budget %d times in a row, suspended for %d updates",
+                 cost->script_name, cost->vehicle_id, REFLEX_OVERRUN_STRIKES, REFLEX_SUSPEND_UPDATES);
+    }
+}
+
+// reflex_cost_slot(vehicle_id, script_name, chunk) -> slot
+static int lua_cost_slot(lua_State* L) {
+    ReflexScriptEngine* engine = closure_engine(L);
+    int vehicle_id = (int)luaL_checkinteger(L, 1);
+    const char* script_name = luaL_checkstring(L, 2);
+
+    size_t slot = 0;
+    while (slot < engine->costs.size() && engine->costs[slot].in_use) slot++;
+    if (slot == engine->costs.size()) engine->costs.emplace_back();
+
+    ScriptCostSlot* cost = &engine->costs[slot];
+    memset(cost, 0, sizeof(*cost));
+    cost->in_use = true;
+    cost->vehicle_id = vehicle_id;
+    snprintf(cost->script_name, sizeof(cost->script_name), "%s", script_name);
+
+    lua_pushinteger(L, (lua_Integer)slot);
+    return 1;
+}
+
+// reflex_release_cost_slot(slot)
+static int lua_release_cost_slot(lua_State* L) {
+    ScriptCostSlot* cost = cost_slot_at(closure_engine(L), (int)luaL_checkinteger(L, 1));
+    if (cost) cost->in_use = false;
+    return 0;
+}
+
+// reflex_run_script(slot, fn, ctx) -> true | false, err
+// pcall(fn, ctx) under the instruction budget, timed into the slot
+static int lua_run_script(lua_State* L) {
+    ReflexScriptEngine* engine = closure_engine(L);
+    ScriptCostSlot* cost = cost_slot_at(engine, (int)luaL_optinteger(L, 1, -1));
+
+    if (cost && cost->suspend_left > 0) {
+        cost->suspend_left--;
+        lua_pushboolean(L, 1);
+        return 1;
+    }
+
+    int budget = cost ? engine->instruction_budget : 0;
+    lua_settop(L, 3);
+    lua_pushvalue(L, 2);
+    lua_pushvalue(L, 3);
+
+    // The budget hook displaces any other hook (the script profiler without
+    // LuaJIT) for the duration of the call
+    lua_Hook prev_hook = lua_gethook(L);
+    int prev_mask = lua_gethookmask(L);
+    int prev_count = lua_gethookcount(L);
+    if (budget > 0) {
+        t_budget_exceeded = false;
+        lua_sethook(L, budget_hook, LUA_MASKCOUNT, budget);
+    }
+    uint64_t start_ns = profiler_now_ns();
+    int status = lua_pcall(L, 1, 0, 0);
+    uint64_t end_ns = profiler_now_ns();
+    if (budget > 0) {
+        lua_sethook(L, prev_hook, prev_mask, prev_count);
+    }
+
+    // Over budget even if the script caught the error itself
+    bool overrun = budget > 0 && t_budget_exceeded;
+    if (cost) {
+        record_script_cost(cost, (float)((double)(end_ns - start_ns) / 1000.0), overrun);
+    }
+
+    if (status == 0 && overrun) {
+        lua_pushboolean(L, 0);
+        lua_pushstring(L, "instruction budget exceeded");
+        return 2;
+    }
+    if (status != 0) {
+        lua_pushboolean(L, 0);
+        lua_insert(L, -2);  // false, err
+        return 2;
+    }
+    lua_pushboolean(L, 1);
+    return 1;
+}
+
+static void register_engine_function(ReflexScriptEngine* engine, const char* name, lua_CFunction fn) {
+    lua_State* L = engine->lua.lua_state();
+    lua_pushlightuserdata(L, engine);
+    lua_pushcclosure(L, fn, 1);
+    lua_setglobal(L, name);
+}
+
 extern "C" {
 
 ReflexScriptEngine* reflex_create(void) {
     auto* engine = new ReflexScriptEngine();
     engine->valid = false;
+    engine->batch_count = 0;
+    engine->defer_particles = false;
+    engine->instruction_budget = 0;
     engine->particle_callback = nullptr;
     engine->particle_user_data = nullptr;
+    engine->accumulated_time = 0.0f;
+    engine->debug_counter = 0;
+    strcpy(engine->result_level, "pending");
 
     // Open libraries
     engine->lua.open_libraries(
@@ -60,12 +371,19 @@ ReflexScriptEngine* reflex_create(void) {
     // Usage: spawn_particle("explosion", x, y, z, intensity)
     engine->lua.set_function("spawn_particle",
         [engine](const std::string& effect_name, float x, float y, float z, float intensity) {
-            if (engine->particle_callback) {
+            if (engine->defer_particles) {
+                engine->deferred_particles.push_back({effect_name, x, y, z, intensity});
+            } else if (engine->particle_callback) {
                 engine->particle_callback(effect_name.c_str(), x, y, z, intensity, engine->particle_user_data);
             }
         }
     );
 
+    // Per-script timing and instruction budget, used by master.update
+    register_engine_function(engine, "reflex_cost_slot", lua_cost_slot);
+    register_engine_function(engine, "reflex_release_cost_slot", lua_release_cost_slot);
+    register_engine_function(engine, "reflex_run_script", lua_run_script);
+
     // Set up package.path for module loading
     // Game runs from client/build/, scripts are at ../../assets/scripts/
     engine->lua["package"]["path"] =
@@ -73,13 +391,23 @@ ReflexScriptEngine* reflex_create(void) {
         "../../assets/scripts/?/init.lua;"
         "../../assets/scripts/modules/?.lua";
 
+    // loadfile/require through the shared bytecode cache
+    lua_State* L = engine->lua.lua_state();
+    script_cache_install(L);
+
     // Load the master script
     const char* master_path = "../../assets/scripts/master.lua";
-    sol::protected_function_result result = engine->lua.safe_script_file(
-        master_path,
-        sol::script_pass_on_error
-    );
+    if (script_cache_load(L, master_path) != 0) {
+        std::cerr << "[Reflex] Failed to load master.lua: " << lua_tostring(L, -1) << std::endl;
+        lua_pop(L, 1);
+        delete engine;
+        return nullptr;
+    }
+    sol::protected_function master_chunk(L, -1);
+    lua_pop(L, 1);
 
+    sol::protected_function_result result = master_chunk();
+    master_chunk = sol::lua_nil;  // Release before any early delete below
     if (!result.valid()) {
         sol::error err = result;
         std::cerr << "[Reflex] Failed to load master.lua: " << err.what() << std::endl;
@@ -104,13 +432,45 @@ ReflexScriptEngine* reflex_create(void) {
         return nullptr;
     }
 
+    engine->update_fn = engine->master["update"];
+    sol::object update_all_fn = engine->master["update_all"];
+    if (update_all_fn.is<sol::function>()) {
+        engine->update_all_fn = update_all_fn;
+    } else {
+        std::cout << "[Reflex] master.update_all not found, updating vehicles one call at a time" << std::endl;
+    }
+    engine->batch = engine->lua.create_table(MAX_PHYSICS_VEHICLES, 0);
+
     engine->valid = true;
     std::cout << "[Reflex] Script engine initialized with master.lua" << std::endl;
     return engine;
 }
 
+ReflexScriptEngine* reflex_create_lanes(int lane_count) {
+    ReflexScriptEngine* engine = reflex_create();
+    if (!engine) return nullptr;
+
+    for (int i = 1; i < lane_count; i++) {
+        ReflexScriptEngine* lane = reflex_create();
+        if (!lane) {
+            reflex_destroy(engine);
+            return nullptr;
+        }
+        engine->lanes.push_back(lane);
+    }
+
+    if (lane_count > 1) {
+        std::cout << "[Reflex] " << lane_count << " script lanes (vehicles run in parallel)" << std::endl;
+    }
+    return engine;
+}
+
 void reflex_destroy(ReflexScriptEngine* engine) {
     if (!engine) return;
+    reflex_profile_stop(engine);  // Sampler must not outlive the states
+    for (ReflexScriptEngine* lane : engine->lanes) {
+        delete lane;
+    }
     std::cout << "[Reflex] Script engine destroyed" << std::endl;
     delete engine;
 }
@@ -124,6 +484,8 @@ bool reflex_attach_script(ReflexScriptEngine* engine,
                           int config_count) {
     if (!engine || !engine->valid || !script_name || !script_path) return false;
 
+    engine = lane_for(engine, vehicle_id);
+
     // Build config table
     sol::table config = engine->lua.create_table();
     for (int i = 0; i < config_count; i++) {
@@ -147,12 +509,69 @@ bool reflex_attach_script(ReflexScriptEngine* engine,
     }
 
     bool success = result.get<bool>();
+    if (success) {
+        VehicleScriptSet* set = get_script_set(engine, vehicle_id);
+        if (set) {
+            set->lua = true;
+            // A Lua attach replaces a native script of the same name
+            set->native.erase(std::remove_if(set->native.begin(), set->native.end(),
+                                             [&](const NativeScript& n) { return strcmp(n.name, script_name) == 0; }),
+                              set->native.end());
+        }
+    }
     return success;
 }
 
+bool reflex_attach_native_script(ReflexScriptEngine* engine,
+                                 int vehicle_id,
+                                 const char* script_name,
+                                 const char* config_keys[],
+                                 float config_values[],
+                                 int config_count) {
+    if (!engine || !engine->valid || !script_name) return false;
+
+    NativeScript script;
+    memset(&script, 0, sizeof(script));
+    if (!native_assist_find(script_name, config_keys, config_values, config_count, &script.config)) {
+        return false;
+    }
+    snprintf(script.name, sizeof(script.name), "%s", script_name);
+
+    // Drop a Lua instance of the same script (a no-op if there is none)
+    reflex_detach_script(engine, vehicle_id, script_name);
+
+    engine = lane_for(engine, vehicle_id);
+    VehicleScriptSet* set = get_script_set(engine, vehicle_id);
+    if (!set) return false;
+
+    for (NativeScript& existing : set->native) {
+        if (strcmp(existing.name, script_name) == 0) {
+            existing = script;
+            return true;
+        }
+    }
+    set->native.push_back(script);
+    LOG_INFO(LOG_SCRIPT, "[Reflex] Attached native '%s' to vehicle %d", script_name, vehicle_id);
+    return true;
+}
+
+bool reflex_has_native_script(const char* script_name) {
+    NativeAssistConfig config;
+    return native_assist_find(script_name, NULL, NULL, 0, &config);
+}
+
 void reflex_detach_script(ReflexScriptEngine* engine, int vehicle_id, const char* script_name) {
     if (!engine || !engine->valid || !script_name) return;
 
+    engine = lane_for(engine, vehicle_id);
+
+    if (vehicle_id >= 0 && (size_t)vehicle_id < engine->script_sets.size()) {
+        std::vector<NativeScript>& native = engine->script_sets[vehicle_id].native;
+        native.erase(std::remove_if(native.begin(), native.end(),
+                                    [&](const NativeScript& n) { return strcmp(n.name, script_name) == 0; }),
+                     native.end());
+    }
+
     sol::protected_function detach_fn = engine->master["detach_script"];
     sol::protected_function_result result = detach_fn(vehicle_id, script_name);
 
@@ -165,6 +584,8 @@ void reflex_detach_script(ReflexScriptEngine* engine, int vehicle_id, const char
 void reflex_detach_all(ReflexScriptEngine* engine, int vehicle_id) {
     if (!engine || !engine->valid) return;
 
+    engine = lane_for(engine, vehicle_id);
+
     sol::protected_function detach_fn = engine->master["detach_all"];
     sol::protected_function_result result = detach_fn(vehicle_id);
 
@@ -172,6 +593,14 @@ void reflex_detach_all(ReflexScriptEngine* engine, int vehicle_id) {
         sol::error err = result;
         std::cerr << "[Reflex] detach_all error: " << err.what() << std::endl;
     }
+
+    // The id may be reused by a different vehicle: start it with fresh tables
+    if (vehicle_id >= 0 && (size_t)vehicle_id < engine->contexts.size()) {
+        engine->contexts[vehicle_id] = VehicleScriptContext();
+    }
+    if (vehicle_id >= 0 && (size_t)vehicle_id < engine->script_sets.size()) {
+        engine->script_sets[vehicle_id] = VehicleScriptSet();
+    }
 }
 
 void reflex_apply_controls(PhysicsWorld* pw, int vehicle_id,
@@ -179,9 +608,10 @@ void reflex_apply_controls(PhysicsWorld* pw, int vehicle_id,
     if (!pw || !controls) return;
     if (!controls->controls_modified) return;
 
-    physics_vehicle_set_steering(pw, vehicle_id, controls->steering);
-    physics_vehicle_set_throttle(pw, vehicle_id, controls->throttle);
-    physics_vehicle_set_handbrake(pw, vehicle_id, controls->handbrake);
+    // Effective controls only: the next step's scripts start from the
+    // driver's input again, not from this step's filtered result
+    physics_vehicle_set_assisted_controls(pw, vehicle_id, controls->steering, controls->throttle,
+                                          controls->brake, controls->handbrake);
 
     if (controls->use_per_wheel_brake) {
         for (int w = 0; w < MAX_SCRIPT_WHEELS; w++) {
@@ -189,114 +619,112 @@ void reflex_apply_controls(PhysicsWorld* pw, int vehicle_id,
         }
     } else {
         physics_vehicle_clear_per_wheel_brake(pw, vehicle_id);
-        physics_vehicle_set_brake(pw, vehicle_id, controls->brake);
     }
 }
 
-void reflex_update_vehicle(ReflexScriptEngine* engine,
-                           PhysicsWorld* pw,
-                           int vehicle_id,
-                           float dt) {
-    if (!engine || !engine->valid || !pw) return;
+// Advance the script clock (ctx.telemetry.time) by one update
+static void advance_script_clock(ReflexScriptEngine* engine, float dt) {
+    engine->accumulated_time += dt;
+    // Debug: print time every ~2 seconds to verify sync with physics [T=X.Xs] log
+    engine->debug_counter++;
+    if (engine->debug_counter % 120 == 0) {  // Roughly every 2 seconds at 60fps
+        LOG_DEBUG(LOG_SCRIPT, "[Script] accumulated_time=%gs (dt=%g)",
+                  engine->accumulated_time, dt);
+    }
+}
 
-    // Get physics data
-    Vec3 pos;
-    float heading, speed_ms;
-    physics_vehicle_get_position(pw, vehicle_id, &pos);
-    physics_vehicle_get_rotation(pw, vehicle_id, &heading);
-    physics_vehicle_get_velocity(pw, vehicle_id, &speed_ms);
+// Read what a script update needs from physics. Returns false if the vehicle is gone.
+static bool gather_vehicle_sample(PhysicsWorld* pw, int vehicle_id, VehicleScriptSample* sample) {
+    PhysicsVehicle* vehicle = physics_get_vehicle(pw, vehicle_id);
+    if (!vehicle) return false;
 
-    PhysicsVehicle* vehicle = &pw->vehicles[vehicle_id];
-    WheelState wheel_states[4];
-    physics_vehicle_get_wheel_states(pw, vehicle_id, wheel_states);
+    sample->id = vehicle_id;
+    physics_vehicle_get_position(pw, vehicle_id, &sample->position);
+    physics_vehicle_get_rotation(pw, vehicle_id, &sample->heading);
+    physics_vehicle_get_velocity(pw, vehicle_id, &sample->speed_ms);
+    physics_vehicle_get_wheel_states(pw, vehicle_id, sample->wheels);
+    for (int w = 0; w < 4; w++) {
+        sample->wheel_radius[w] = vehicle->cold->config.wheel_radii[w];
+    }
 
+    // Raw driver input, so substeps between control updates are not
+    // filtered again on top of the previous step's assist output
+    sample->steering = vehicle->input_steering;
+    sample->throttle = vehicle->input_throttle;
+    sample->brake = vehicle->input_brake;
+    sample->handbrake = vehicle->input_handbrake;
+    return true;
+}
+
+// Refill a vehicle's ctx from its sample. Returns NULL for an invalid id.
+static VehicleScriptContext* fill_vehicle_context(ReflexScriptEngine* engine,
+                                                  const VehicleScriptSample* sample,
+                                                  float dt) {
     // ========================================
-    // BUILD CONTEXT (ctx) TABLE
+    // FILL CONTEXT (ctx) TABLE
     // ========================================
-    sol::table ctx = engine->lua.create_table();
+    // The tables persist across steps (see VehicleScriptContext), so
+    // master.update's last_telemetry always holds the newest values.
+    VehicleScriptContext* c = get_vehicle_context(engine, sample->id);
+    if (!c) return nullptr;
+    sol::table& ctx = c->ctx;
 
     // ctx.id - Entity identifier
-    ctx["id"] = vehicle_id;
+    ctx["id"] = sample->id;
 
     // ctx.dt - Delta time
     ctx["dt"] = dt;
 
     // ctx.telemetry - Read-only vehicle state
-    sol::table telemetry = engine->lua.create_table();
-    telemetry["position"] = engine->lua.create_table_with(
-        "x", pos.x, "y", pos.y, "z", pos.z
-    );
-    telemetry["heading"] = rad_to_deg(heading);
-    telemetry["speed"] = ms_to_mph(speed_ms);
-    telemetry["speed_ms"] = speed_ms;
+    sol::table& telemetry = c->telemetry;
+    c->position["x"] = sample->position.x;
+    c->position["y"] = sample->position.y;
+    c->position["z"] = sample->position.z;
+    telemetry["heading"] = rad_to_deg(sample->heading);
+    telemetry["speed"] = ms_to_mph(sample->speed_ms);
+    telemetry["speed_ms"] = sample->speed_ms;
 
     // Accumulated time for rate-limiting in scripts
-    // Only increment once per frame (on vehicle 0), not per vehicle
-    static float accumulated_time = 0.0f;
-    static int debug_counter = 0;
-    if (vehicle_id == 0) {
-        accumulated_time += dt;
-        // Debug: print time every ~2 seconds to verify sync with physics [T=X.Xs] log
-        debug_counter++;
-        if (debug_counter % 120 == 0) {  // Roughly every 2 seconds at 60fps
-            std::cout << "[Script] accumulated_time=" << accumulated_time
-                      << "s (dt=" << dt << ")" << std::endl;
-        }
-    }
-    telemetry["time"] = accumulated_time;
+    telemetry["time"] = engine->accumulated_time;
 
     // Wheel data for slip calculations
-    sol::table wheels = engine->lua.create_table();
     for (int w = 0; w < 4; w++) {
-        sol::table wheel = engine->lua.create_table();
-        wheel["angular_velocity"] = wheel_states[w].angular_velocity;
-        wheel["radius"] = vehicle->config.wheel_radii[w];
-        wheel["slip"] = wheel_states[w].longitudinal_slip;
-        wheel["has_contact"] = wheel_states[w].has_contact;
-        wheels[w + 1] = wheel;  // Lua arrays are 1-indexed
-    }
-    telemetry["wheels"] = wheels;
+        sol::table& wheel = c->wheel[w];
+        wheel["angular_velocity"] = sample->wheels[w].angular_velocity;
+        wheel["radius"] = sample->wheel_radius[w];
+        wheel["slip"] = sample->wheels[w].longitudinal_slip;
+        wheel["has_contact"] = sample->wheels[w].has_contact;
+    }
     ctx["telemetry"] = telemetry;
 
-    // ctx.controls - Player inputs (scripts can modify these)
-    sol::table controls = engine->lua.create_table_with(
-        "steering", vehicle->steering,
-        "throttle", vehicle->throttle,
-        "brake", vehicle->brake,
-        "handbrake", vehicle->handbrake
-    );
+    // ctx.controls - Player inputs (scripts can modify these, so every
+    // field is reset and the tables re-linked in case a script replaced one)
+    sol::table& controls = c->controls;
+    controls["steering"] = sample->steering;
+    controls["throttle"] = sample->throttle;
+    controls["brake"] = sample->brake;
+    controls["handbrake"] = sample->handbrake;
     // Per-wheel brake for TCS/ABS (Lua 1-indexed: 1=FL, 2=FR, 3=RL, 4=RR)
-    sol::table wheel_brake = engine->lua.create_table();
     for (int w = 0; w < 4; w++) {
-        wheel_brake[w + 1] = 0.0f;  // Initialize to 0
+        c->wheel_brake[w + 1] = 0.0f;
     }
-    controls["wheel_brake"] = wheel_brake;
+    controls["wheel_brake"] = c->wheel_brake;
     ctx["controls"] = controls;
 
-    // ========================================
-    // CALL MASTER.UPDATE
-    // ========================================
-    sol::protected_function update_fn = engine->master["update"];
-    sol::protected_function_result result = update_fn(vehicle_id, ctx);
+    return c;
+}
 
-    if (!result.valid()) {
-        sol::error err = result;
-        std::cerr << "[Reflex] update error for vehicle " << vehicle_id
-                  << ": " << err.what() << std::endl;
-        return;
-    }
+// Read back the controls a script left in ctx.controls
+static void read_script_controls(VehicleScriptContext* c, ScriptControls* out_controls) {
+    sol::table& controls = c->controls;
 
-    // ========================================
-    // APPLY CONTROLS FROM SCRIPT
-    // ========================================
-    ScriptControls out_controls;
-    memset(&out_controls, 0, sizeof(out_controls));
+    memset(out_controls, 0, sizeof(*out_controls));
 
-    out_controls.steering = controls.get_or("steering", 0.0f);
-    out_controls.throttle = controls.get_or("throttle", 0.0f);
-    out_controls.brake = controls.get_or("brake", 0.0f);
-    out_controls.handbrake = controls.get_or("handbrake", 0.0f);
-    out_controls.controls_modified = true;
+    out_controls->steering = controls.get_or("steering", 0.0f);
+    out_controls->throttle = controls.get_or("throttle", 0.0f);
+    out_controls->brake = controls.get_or("brake", 0.0f);
+    out_controls->handbrake = controls.get_or("handbrake", 0.0f);
+    out_controls->controls_modified = true;
 
     // Read back per-wheel brake values (for TCS/ABS)
     sol::optional<sol::table> wb_opt = controls["wheel_brake"];
@@ -305,42 +733,287 @@ void reflex_update_vehicle(ReflexScriptEngine* engine,
         bool any_wheel_brake = false;
         for (int w = 0; w < 4; w++) {
             float brake_val = wb.get_or(w + 1, 0.0f);  // Lua 1-indexed
-            out_controls.wheel_brake[w] = brake_val;
+            out_controls->wheel_brake[w] = brake_val;
             if (brake_val > 0.01f) any_wheel_brake = true;
         }
-        out_controls.use_per_wheel_brake = any_wheel_brake;
+        out_controls->use_per_wheel_brake = any_wheel_brake;
     }
+}
 
-    reflex_apply_controls(pw, vehicle_id, &out_controls);
+// Controls as the vehicle already has them, for a vehicle no Lua script sees
+static void sample_controls(const VehicleScriptSample* sample, ScriptControls* out_controls) {
+    memset(out_controls, 0, sizeof(*out_controls));
+    out_controls->steering = sample->steering;
+    out_controls->throttle = sample->throttle;
+    out_controls->brake = sample->brake;
+    out_controls->handbrake = sample->handbrake;
+    out_controls->controls_modified = true;
 }
 
-int reflex_reload_all_scripts(ReflexScriptEngine* engine) {
-    if (!engine || !engine->valid) return -1;
+// Native scripts filter what the Lua scripts produced (skipped if Lua failed)
+static void run_native_scripts(const VehicleScriptSet* set, const VehicleScriptSample* sample,
+                               ScriptControls* controls) {
+    if (!set || set->native.empty() || !controls->controls_modified) return;
 
-    sol::protected_function reload_fn = engine->master["reload_all"];
-    if (!reload_fn.valid()) {
-        std::cerr << "[Reflex] master.reload_all not found" << std::endl;
-        return -1;
+    NativeAssistInput input;
+    input.speed_ms = sample->speed_ms;
+    for (int w = 0; w < 4; w++) {
+        input.angular_velocity[w] = sample->wheels[w].angular_velocity;
+        input.radius[w] = sample->wheel_radius[w];
+        input.slip[w] = sample->wheels[w].longitudinal_slip;
+    }
+    for (const NativeScript& script : set->native) {
+        native_assist_update(&script.config, &input, controls);
     }
+}
 
-    sol::protected_function_result result = reload_fn();
+// Run one lane's scripts for samples[members[0..count)], writing each result
+// to outputs[member]. Touches only the lane's Lua state, so lanes can run
+// concurrently. Outputs of failed updates are left untouched.
+static void run_lane_updates(ReflexScriptEngine* lane,
+                             const VehicleScriptSample* samples,
+                             const int* members,
+                             int count,
+                             float dt,
+                             ScriptControls* outputs) {
+    if (!lane->update_all_fn.valid()) {
+        for (int i = 0; i < count; i++) {
+            const VehicleScriptSample* sample = &samples[members[i]];
+            VehicleScriptContext* c = fill_vehicle_context(lane, sample, dt);
+            if (!c) continue;
+
+            sol::protected_function_result result = lane->update_fn(sample->id, c->ctx);
+            if (!result.valid()) {
+                sol::error err = result;
+                LOG_ERROR(LOG_SCRIPT, "[Reflex] update error for vehicle %d: %s", sample->id, err.what());
+                continue;
+            }
+            read_script_controls(c, &outputs[members[i]]);
+        }
+        return;
+    }
+
+    // Fill every vehicle's ctx and line them up in the batch array
+    int batched = 0;
+    for (int i = 0; i < count; i++) {
+        VehicleScriptContext* c = fill_vehicle_context(lane, &samples[members[i]], dt);
+        if (!c) continue;
+        lane->batch[++batched] = c->ctx;  // Lua arrays are 1-indexed
+    }
+    // Clear slots left over from a step with more vehicles
+    for (int i = batched + 1; i <= lane->batch_count; i++) {
+        lane->batch[i] = sol::lua_nil;
+    }
+    lane->batch_count = batched;
+    if (batched == 0) return;
+
+    // One call into Lua for the whole lane
+    sol::protected_function_result result = lane->update_all_fn(lane->batch, batched);
     if (!result.valid()) {
         sol::error err = result;
-        std::cerr << "[Reflex] reload_all error: " << err.what() << std::endl;
-        return -1;
+        LOG_ERROR(LOG_SCRIPT, "[Reflex] update_all error: %s", err.what());
+        return;
     }
 
-    int count = result.get<int>();
-    return count;
+    // Scripts leave their outputs in each ctx.controls
+    for (int i = 0; i < count; i++) {
+        VehicleScriptContext* c = get_vehicle_context(lane, samples[members[i]].id);
+        if (c) read_script_controls(c, &outputs[members[i]]);
+    }
+}
+
+typedef struct {
+    ReflexScriptEngine* engine;
+    float dt;
+} LaneBatch;
+
+// physics_parallel_for job: one lane
+static void run_lane_job(int lane_index, void* user_data) {
+    LaneBatch* batch = (LaneBatch*)user_data;
+    ReflexScriptEngine* engine = batch->engine;
+    const std::vector<int>& members = engine->lane_members[lane_index];
+    if (members.empty()) return;
+
+    PROFILE_SCOPE("Reflex.Lane");
+    run_lane_updates(lane_at(engine, lane_index), engine->samples.data(),
+                     members.data(), (int)members.size(), batch->dt, engine->outputs.data());
+}
+
+void reflex_update_vehicle(ReflexScriptEngine* engine,
+                           PhysicsWorld* pw,
+                           int vehicle_id,
+                           float dt) {
+    if (!engine || !engine->valid || !pw) return;
+
+    // Per-vehicle callers update every vehicle each frame, so the clock
+    // advances on vehicle 0 only (reflex_update_all advances it once per batch)
+    if (vehicle_id == 0) advance_script_clock(engine, dt);
+
+    VehicleScriptSample sample;
+    if (!gather_vehicle_sample(pw, vehicle_id, &sample)) return;
+
+    ReflexScriptEngine* lane = lane_for(engine, vehicle_id);
+    lane->accumulated_time = engine->accumulated_time;
+
+    ScriptControls out_controls;
+    memset(&out_controls, 0, sizeof(out_controls));
+    const VehicleScriptSet* set = find_script_set(engine, vehicle_id);
+    if (!set || !set->lua) {
+        sample_controls(&sample, &out_controls);
+    } else {
+        int member = 0;
+        run_lane_updates(lane, &sample, &member, 1, dt, &out_controls);
+    }
+    run_native_scripts(set, &sample, &out_controls);
+
+    reflex_apply_controls(pw, vehicle_id, &out_controls);
+}
+
+void reflex_update_all(ReflexScriptEngine* engine, PhysicsWorld* pw, float dt) {
+    if (!engine || !engine->valid || !pw) return;
+
+    advance_script_clock(engine, dt);
+
+    int lane_count = (int)engine->lanes.size() + 1;
+    if (engine->samples.empty()) {
+        engine->samples.resize(MAX_PHYSICS_VEHICLES);
+        engine->outputs.resize(MAX_PHYSICS_VEHICLES);
+        engine->lane_members.resize(lane_count);
+        for (std::vector<int>& members : engine->lane_members) {
+            members.reserve(MAX_PHYSICS_VEHICLES);
+        }
+    }
+
+    // Physics reads stay on this thread
+    int count = 0;
+    for (int n = 0; n < pw->vehicle_count; n++) {
+        if (gather_vehicle_sample(pw, pw->live_vehicles[n], &engine->samples[count])) count++;
+    }
+    if (count == 0) return;
+
+    memset(engine->outputs.data(), 0, sizeof(ScriptControls) * count);
+    for (std::vector<int>& members : engine->lane_members) members.clear();
+    bool any_lua = false;
+    for (int i = 0; i < count; i++) {
+        const VehicleScriptSample* sample = &engine->samples[i];
+        const VehicleScriptSet* set = find_script_set(engine, sample->id);
+        if (set && set->lua) {
+            engine->lane_members[sample->id % lane_count].push_back(i);
+            any_lua = true;
+        } else {
+            sample_controls(sample, &engine->outputs[i]);  // Native-only or no scripts
+        }
+    }
+
+    // Native-only vehicles never enter Lua; with none left the lanes are skipped
+    LaneBatch batch = {engine, dt};
+    if (any_lua && lane_count == 1) {
+        run_lane_job(0, &batch);
+    } else if (any_lua) {
+        for (int l = 0; l < lane_count; l++) {
+            ReflexScriptEngine* lane = lane_at(engine, l);
+            lane->accumulated_time = engine->accumulated_time;
+            lane->defer_particles = true;
+        }
+
+        physics_parallel_for(pw, lane_count, run_lane_job, &batch);
+
+        // Deliver particle spawns in lane order so the result doesn't depend
+        // on which worker finished first
+        for (int l = 0; l < lane_count; l++) {
+            ReflexScriptEngine* lane = lane_at(engine, l);
+            lane->defer_particles = false;
+            for (const DeferredParticle& p : lane->deferred_particles) {
+                if (engine->particle_callback) {
+                    engine->particle_callback(p.effect_name.c_str(), p.x, p.y, p.z, p.intensity,
+                                              engine->particle_user_data);
+                }
+            }
+            lane->deferred_particles.clear();
+        }
+    }
+
+    // Native scripts and controls run here, after every lane has finished
+    for (int i = 0; i < count; i++) {
+        const VehicleScriptSample* sample = &engine->samples[i];
+        run_native_scripts(find_script_set(engine, sample->id), sample, &engine->outputs[i]);
+        reflex_apply_controls(pw, sample->id, &engine->outputs[i]);
+    }
+}
+
+// Pre-step hook installed by reflex_bind_physics_step
+static void update_vehicles_pre_step(PhysicsWorld* pw, float dt, void* user_data) {
+    reflex_update_all((ReflexScriptEngine*)user_data, pw, dt);
+}
+
+void reflex_bind_physics_step(ReflexScriptEngine* engine, PhysicsWorld* pw) {
+    if (!pw) return;
+    if (engine) {
+        physics_set_pre_step_callback(pw, update_vehicles_pre_step, engine);
+    } else {
+        physics_set_pre_step_callback(pw, NULL, NULL);
+    }
+}
+
+int reflex_reload_all_scripts(ReflexScriptEngine* engine) {
+    if (!engine || !engine->valid) return -1;
+
+    int total = 0;
+    for (int l = 0; l <= (int)engine->lanes.size(); l++) {
+        ReflexScriptEngine* lane = lane_at(engine, l);
+
+        sol::protected_function reload_fn = lane->master["reload_all"];
+        if (!reload_fn.valid()) {
+            std::cerr << "[Reflex] master.reload_all not found" << std::endl;
+            return -1;
+        }
+
+        sol::protected_function_result result = reload_fn();
+        if (!result.valid()) {
+            sol::error err = result;
+            std::cerr << "[Reflex] reload_all error: " << err.what() << std::endl;
+            return -1;
+        }
+
+        total += result.get<int>();
+    }
+    return total;
+}
+
+int reflex_reload_changed(ReflexScriptEngine* engine, const char* const* paths, int path_count) {
+    if (!engine || !engine->valid || !paths || path_count <= 0) return 0;
+
+    int total = 0;
+    for (int l = 0; l <= (int)engine->lanes.size(); l++) {
+        ReflexScriptEngine* lane = lane_at(engine, l);
+
+        sol::protected_function reload_fn = lane->master["reload_changed"];
+        if (!reload_fn.valid()) {
+            std::cerr << "[Reflex] master.reload_changed not found" << std::endl;
+            return -1;
+        }
+
+        sol::table changed = lane->lua.create_table(path_count, 0);
+        for (int i = 0; i < path_count; i++) {
+            changed[i + 1] = paths[i];
+        }
+
+        sol::protected_function_result result = reload_fn(changed);
+        if (!result.valid()) {
+            sol::error err = result;
+            std::cerr << "[Reflex] reload_changed error: " << err.what() << std::endl;
+            return -1;
+        }
+
+        total += result.get<int>();
+    }
+    return total;
 }
 
 // ============================================================================
 // Turn-Based Maneuver Control
 // ============================================================================
 
-// Static storage for result strings (to return const char* safely)
-static char s_result_level[32] = "pending";
-
 bool reflex_start_turn(ReflexScriptEngine* engine,
                        int vehicle_id,
                        const char* maneuver_type,
@@ -348,6 +1021,8 @@ bool reflex_start_turn(ReflexScriptEngine* engine,
                        float duration) {
     if (!engine || !engine->valid) return false;
 
+    engine = lane_for(engine, vehicle_id);
+
     // Call the vehicle's start_turn function via master
     // First, we need to get the vehicle's script environment
     // The turn_executor script exposes start_turn() as a global function
@@ -387,6 +1062,8 @@ ManeuverResult reflex_end_turn(ReflexScriptEngine* engine, int vehicle_id) {
 
     if (!engine || !engine->valid) return result;
 
+    engine = lane_for(engine, vehicle_id);
+
     sol::protected_function end_fn = engine->master["end_turn"];
     if (!end_fn.valid()) {
         std::cerr << "[Reflex] master.end_turn not implemented yet" << std::endl;
@@ -406,8 +1083,8 @@ ManeuverResult reflex_end_turn(ReflexScriptEngine* engine, int vehicle_id) {
         result.success = res_table.get_or("success", false);
 
         std::string level = res_table.get_or<std::string>("level", "failed");
-        strncpy(s_result_level, level.c_str(), sizeof(s_result_level) - 1);
-        result.level = s_result_level;
+        strncpy(engine->result_level, level.c_str(), sizeof(engine->result_level) - 1);
+        result.level = engine->result_level;
 
         result.heading_error = res_table.get_or("heading_error", 999.0f);
         result.position_error = res_table.get_or("position_error", 999.0f);
@@ -421,6 +1098,8 @@ ManeuverResult reflex_end_turn(ReflexScriptEngine* engine, int vehicle_id) {
 bool reflex_is_turn_active(ReflexScriptEngine* engine, int vehicle_id) {
     if (!engine || !engine->valid) return false;
 
+    engine = lane_for(engine, vehicle_id);
+
     sol::protected_function active_fn = engine->master["is_turn_active"];
     if (!active_fn.valid()) {
         return false;
@@ -443,6 +1122,8 @@ bool reflex_start_test_sequence(ReflexScriptEngine* engine,
                                  const char* sequence_name) {
     if (!engine || !engine->valid) return false;
 
+    engine = lane_for(engine, vehicle_id);
+
     sol::protected_function start_fn = engine->master["start_test_sequence"];
     if (!start_fn.valid()) {
         std::cerr << "[Reflex] master.start_test_sequence not found" << std::endl;
@@ -462,22 +1143,23 @@ bool reflex_start_test_sequence(ReflexScriptEngine* engine,
 void reflex_stop_test_sequence(ReflexScriptEngine* engine) {
     if (!engine || !engine->valid) return;
 
-    sol::protected_function stop_fn = engine->master["stop_test_sequence"];
-    if (!stop_fn.valid()) return;
-
-    stop_fn();
+    for (int l = 0; l <= (int)engine->lanes.size(); l++) {
+        sol::protected_function stop_fn = lane_at(engine, l)->master["stop_test_sequence"];
+        if (stop_fn.valid()) stop_fn();
+    }
 }
 
 bool reflex_is_test_running(ReflexScriptEngine* engine) {
     if (!engine || !engine->valid) return false;
 
-    sol::protected_function is_running_fn = engine->master["is_test_running"];
-    if (!is_running_fn.valid()) return false;
-
-    sol::protected_function_result result = is_running_fn();
-    if (!result.valid()) return false;
+    for (int l = 0; l <= (int)engine->lanes.size(); l++) {
+        sol::protected_function is_running_fn = lane_at(engine, l)->master["is_test_running"];
+        if (!is_running_fn.valid()) continue;
 
-    return result.get<bool>();
+        sol::protected_function_result result = is_running_fn();
+        if (result.valid() && result.get<bool>()) return true;
+    }
+    return false;
 }
 
 // ============================================================================
@@ -490,6 +1172,8 @@ void reflex_on_input(ReflexScriptEngine* engine,
                      int selected_vehicle_id) {
     if (!engine || !engine->valid || !keys_pressed) return;
 
+    engine = lane_for(engine, selected_vehicle_id);
+
     // Build table of pressed keys (only include keys that are actually pressed)
     sol::table pressed = engine->lua.create_table();
     int count = 0;
@@ -554,6 +1238,8 @@ void reflex_send_event(ReflexScriptEngine* engine,
                        const ScriptEventData* data) {
     if (!engine || !engine->valid || !event_name) return;
 
+    engine = lane_for(engine, vehicle_id);
+
     // Build data table from ScriptEventData
     sol::table event_data = engine->lua.create_table();
     if (data) {
@@ -588,6 +1274,107 @@ void reflex_set_particle_callback(ReflexScriptEngine* engine,
     if (!engine) return;
     engine->particle_callback = callback;
     engine->particle_user_data = user_data;
+    for (ReflexScriptEngine* lane : engine->lanes) {
+        lane->particle_callback = callback;
+        lane->particle_user_data = user_data;
+    }
+}
+
+// ============================================================================
+// Script Cost and Budget
+// ============================================================================
+
+void reflex_set_script_budget(ReflexScriptEngine* engine, int instruction_limit) {
+    if (!engine) return;
+    if (instruction_limit < 0) instruction_limit = 0;
+    for (int l = 0; l <= (int)engine->lanes.size(); l++) {
+        ReflexScriptEngine* lane = lane_at(engine, l);
+        lane->instruction_budget = instruction_limit;
+#ifdef LUAJIT_VERSION
+        // Compiled traces never call the count hook, so a budgeted lane runs
+        // everything (scripts and required modules) in the interpreter
+        lua_State* L = lane->lua.lua_state();
+        if (instruction_limit > 0) {
+            luaJIT_setmode(L, 0, LUAJIT_MODE_ENGINE | LUAJIT_MODE_FLUSH);
+            luaJIT_setmode(L, 0, LUAJIT_MODE_ENGINE | LUAJIT_MODE_OFF);
+        } else {
+            luaJIT_setmode(L, 0, LUAJIT_MODE_ENGINE | LUAJIT_MODE_ON);
+        }
+#endif
+    }
+}
+
+int reflex_get_script_stats(ReflexScriptEngine* engine, ScriptCostStats* out, int max) {
+    if (!engine || !out) return 0;
+
+    int count = 0;
+    float sorted[REFLEX_COST_HISTORY];
+    for (int l = 0; l <= (int)engine->lanes.size(); l++) {
+        for (const ScriptCostSlot& cost : lane_at(engine, l)->costs) {
+            if (!cost.in_use) continue;
+            if (count >= max) return count;
+
+            ScriptCostStats* st = &out[count++];
+            memset(st, 0, sizeof(*st));
+            st->vehicle_id = cost.vehicle_id;
+            memcpy(st->script_name, cost.script_name, sizeof(st->script_name));
+            st->calls = cost.calls;
+            st->overruns = cost.overruns;
+            st->suspended = cost.suspend_left > 0;
+            if (cost.calls == 0) continue;
+
+            st->last_us = cost.last_us;
+            st->min_us = cost.min_us;
+            st->avg_us = (float)(cost.total_us / cost.calls);
+
+            int n = cost.calls < REFLEX_COST_HISTORY ? (int)cost.calls : REFLEX_COST_HISTORY;
+            memcpy(sorted, cost.history, sizeof(float) * n);
+            int k = (int)(0.99f * (float)(n - 1));
+            std::nth_element(sorted, sorted + k, sorted + n);
+            st->p99_us = sorted[k];
+        }
+    }
+    return count;
+}
+
+void reflex_reset_script_stats(ReflexScriptEngine* engine) {
+    if (!engine) return;
+    for (int l = 0; l <= (int)engine->lanes.size(); l++) {
+        for (ScriptCostSlot& cost : lane_at(engine, l)->costs) {
+            cost.calls = 0;
+            cost.overruns = 0;
+            cost.last_us = 0.0f;
+            cost.min_us = 0.0f;
+            cost.total_us = 0.0;
+        }
+    }
+}
+
+bool reflex_profile_start(ReflexScriptEngine* engine, int interval_ms) {
+    if (!engine) return false;
+
+    int started = 0;
+    int lane_count = (int)engine->lanes.size() + 1;
+    for (int l = 0; l < lane_count; l++) {
+        if (script_profile_start(lane_at(engine, l)->lua.lua_state(), interval_ms)) started++;
+    }
+    if (started == 0) {
+        LOG_WARN(LOG_SCRIPT, "[Reflex] Script profiler already in use by another engine");
+        return false;
+    }
+    if (started < lane_count) {
+        LOG_INFO(LOG_SCRIPT, "[Reflex] Profiling lane 0 only (%d of %d lanes; LuaJIT samples one state)",
+                 started, lane_count);
+    }
+    return true;
+}
+
+void reflex_profile_stop(ReflexScriptEngine* engine) {
+    if (!engine) return;
+    int lane_count = (int)engine->lanes.size() + 1;
+    for (int l = 0; l < lane_count; l++) {
+        script_profile_stop(lane_at(engine, l)->lua.lua_state());
+    }
 }
 
-} // extern "C"
\ No newline at end of file
+} // extern "C"
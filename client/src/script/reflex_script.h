@@ -8,6 +8,7 @@
 #define REFLEX_SCRIPT_H
 
 #include <stdbool.h>
+#include <stdint.h>
 #include "../math/vec3.h"
 #include "../game/config_loader.h"
 #include "../physics/jolt_physics.h"
@@ -104,6 +105,24 @@ typedef struct {
     bool controls_modified; // True if script modified any controls
 } ScriptControls;
 
+// Update cost of one attached script on one vehicle (reflex_get_script_stats)
+#define REFLEX_SCRIPT_NAME_MAX 32
+#define REFLEX_COST_HISTORY 256     // Updates kept for the p99
+#define REFLEX_OVERRUN_STRIKES 3    // Overruns in a row before a script is suspended
+#define REFLEX_SUSPEND_UPDATES 120  // Updates a suspended script is skipped for
+
+typedef struct {
+    int vehicle_id;
+    char script_name[REFLEX_SCRIPT_NAME_MAX];
+    uint32_t calls;
+    uint32_t overruns;      // Updates aborted for going over the instruction budget
+    bool suspended;         // Currently skipped after repeated overruns
+    float last_us;
+    float min_us;
+    float avg_us;
+    float p99_us;           // Over the last REFLEX_COST_HISTORY updates
+} ScriptCostStats;
+
 // Script instance (one per vehicle that has a script loaded)
 typedef struct ScriptInstance ScriptInstance;
 
@@ -119,6 +138,12 @@ extern "C" {
 ReflexScriptEngine* reflex_create(void);
 void reflex_destroy(ReflexScriptEngine* engine);
 
+// Engine with lane_count Lua states, each loading its own master.lua.
+// A vehicle's scripts live in lane (vehicle_id % lane_count), and
+// reflex_update_all runs the lanes in parallel on the physics job system.
+// Scripts must not share state between vehicles. lane_count <= 1 is reflex_create.
+ReflexScriptEngine* reflex_create_lanes(int lane_count);
+
 // Attach a script to a vehicle (creates isolated script instance)
 // script_name: identifier for the script (e.g., "freestyle_assist", "turn_executor")
 // script_path: path to the vehicle's script (e.g., "scripts/freestyle_assist.lua")
@@ -132,7 +157,22 @@ bool reflex_attach_script(ReflexScriptEngine* engine,
                           float config_values[],
                           int config_count);
 
-// Detach a specific script from a vehicle
+// Attach the built-in C++ version of script_name instead of its Lua file
+// (see native_assists.h for the names and options). Native scripts run after
+// the vehicle's Lua scripts, on their controls; a vehicle with only native
+// scripts never enters Lua. Replaces a Lua script of the same name.
+// Returns false if script_name has no native version (attach the Lua one).
+bool reflex_attach_native_script(ReflexScriptEngine* engine,
+                                 int vehicle_id,
+                                 const char* script_name,
+                                 const char* config_keys[],
+                                 float config_values[],
+                                 int config_count);
+
+// True if reflex_attach_native_script supports script_name
+bool reflex_has_native_script(const char* script_name);
+
+// Detach a specific script from a vehicle (Lua or native)
 void reflex_detach_script(ReflexScriptEngine* engine, int vehicle_id, const char* script_name);
 
 // Detach all scripts from a vehicle
@@ -145,11 +185,28 @@ void reflex_update_vehicle(ReflexScriptEngine* engine,
                            int vehicle_id,
                            float dt);
 
+// Update every live vehicle's scripts with a single call to
+// master.update_all per lane (falls back to master.update per vehicle if the
+// master script has no update_all). Physics is read and controls applied on
+// the calling thread. Advances the script clock by dt once.
+void reflex_update_all(ReflexScriptEngine* engine, PhysicsWorld* pw, float dt);
+
+// Run reflex_update_all once per physics substep, from pw's pre-step hook,
+// instead of calling reflex_update_vehicle per frame.
+// NULL engine removes the hook.
+void reflex_bind_physics_step(ReflexScriptEngine* engine, PhysicsWorld* pw);
+
 // Reload all scripts (hot reload for development)
 // Calls master.reload_all() which reloads all script files from disk
 // Returns number of scripts reloaded, or -1 on error
 int reflex_reload_all_scripts(ReflexScriptEngine* engine);
 
+// Reload only the script instances that depend on the given files (their own
+// script, or a module they use directly or through other modules). Other
+// vehicles keep running untouched. Paths must be spelled like the script
+// paths ("../../assets/scripts/..."). Returns instances reloaded, -1 on error.
+int reflex_reload_changed(ReflexScriptEngine* engine, const char* const* paths, int path_count);
+
 // Apply controls to physics vehicle (called internally, exposed for testing)
 void reflex_apply_controls(PhysicsWorld* pw,
                            int vehicle_id,
@@ -250,6 +307,37 @@ void reflex_set_particle_callback(ReflexScriptEngine* engine,
                                    ParticleSpawnCallback callback,
                                    void* user_data);
 
+// ============================================================================
+// Script Cost and Budget
+// ============================================================================
+
+// Limit each script's update() to instruction_limit Lua VM instructions
+// (0 = unlimited, the default). An update over the limit is aborted, and
+// counts as an overrun even if the script catches the error; after
+// REFLEX_OVERRUN_STRIKES in a row the script is skipped for
+// REFLEX_SUSPEND_UPDATES updates. A budget turns the LuaJIT compiler off for
+// every lane (traces never check the limit). Time spent inside a single C
+// call (string.rep, table.sort, ...) is not counted.
+void reflex_set_script_budget(ReflexScriptEngine* engine, int instruction_limit);
+
+// Copy the cost of every attached script (all lanes) into out.
+// Returns the number written (at most max).
+int reflex_get_script_stats(ReflexScriptEngine* engine, ScriptCostStats* out, int max);
+
+// Clear the collected timings (budget and suspensions are kept)
+void reflex_reset_script_stats(ReflexScriptEngine* engine);
+
+// ============================================================================
+// Script Profiler
+// ============================================================================
+
+// Sample script call stacks into the script profiler (script_profile.h) until
+// reflex_profile_stop; write the results with script_profile_write_folded.
+// Under LuaJIT only one Lua state is sampled, so with lanes that is lane 0.
+// interval_ms <= 0 uses SCRIPT_PROFILE_DEFAULT_INTERVAL_MS.
+bool reflex_profile_start(ReflexScriptEngine* engine, int interval_ms);
+void reflex_profile_stop(ReflexScriptEngine* engine);
+
 #ifdef __cplusplus
 }
 #endif
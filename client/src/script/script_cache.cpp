@@ -0,0 +1,270 @@
+/*
+ * Lua Bytecode Cache Implementation
+ *
+ * Lookup: read the source, hash it, then try the in-memory map, then
+ * <dir>/<hash>.luac, and only then parse. Freshly compiled chunks are dumped
+ * with lua_dump (debug info kept, so errors still carry file:line) and stored
+ * in both. A cached blob the running VM rejects is recompiled and replaced.
+ */
+
+#include "script_cache.h"
+#include "../util/log.h"
+
+#include <lua.hpp>
+#include <stdio.h>
+#include <string.h>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+static std::mutex s_mutex;
+static std::string s_dir;  // Empty = memory only
+static std::unordered_map<uint64_t, std::string> s_chunks;  // Key hash -> bytecode
+static ScriptCacheStats s_stats;
+
+// Bytecode is only valid for the VM (and pointer size) that produced it
+#ifdef LUAJIT_VERSION
+static const char* s_vm_tag = LUAJIT_VERSION;
+#else
+static const char* s_vm_tag = LUA_RELEASE;
+#endif
+
+// FNV-1a 64
+static uint64_t hash_bytes(uint64_t h, const void* data, size_t size) {
+    const unsigned char* p = (const unsigned char*)data;
+    for (size_t i = 0; i < size; i++) {
+        h ^= p[i];
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+static uint64_t chunk_key(const char* path, const std::string& source) {
+    uint64_t h = 14695981039346656037ull;
+    uint32_t pointer_size = (uint32_t)sizeof(void*);
+    h = hash_bytes(h, s_vm_tag, strlen(s_vm_tag) + 1);
+    h = hash_bytes(h, &pointer_size, sizeof(pointer_size));
+    h = hash_bytes(h, path, strlen(path) + 1);  // Chunk name is baked into the bytecode
+    return hash_bytes(h, source.data(), source.size());
+}
+
+static bool read_whole_file(const char* path, std::string* out) {
+    FILE* f = fopen(path, "rb");
+    if (!f) return false;
+
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    if (size < 0) {
+        fclose(f);
+        return false;
+    }
+
+    out->resize((size_t)size);
+    size_t got = size > 0 ? fread(&(*out)[0], 1, (size_t)size, f) : 0;
+    fclose(f);
+    return got == (size_t)size;
+}
+
+static std::string disk_path(uint64_t key) {
+    char name[32];
+    snprintf(name, sizeof(name), "%016llx.luac", (unsigned long long)key);
+    return s_dir + "/" + name;
+}
+
+static void write_disk_entry(uint64_t key, const std::string& bytecode) {
+    std::string path = disk_path(key);
+    std::string tmp = path + ".tmp";
+
+    FILE* f = fopen(tmp.c_str(), "wb");
+    if (!f) return;
+    bool ok = fwrite(bytecode.data(), 1, bytecode.size(), f) == bytecode.size();
+    ok = (fclose(f) == 0) && ok;
+
+    // Rename so a concurrent or interrupted run never sees half a file
+    std::error_code ec;
+    if (ok) std::filesystem::rename(tmp, path, ec);
+    if (!ok || ec) std::filesystem::remove(tmp, ec);
+}
+
+static int dump_writer(lua_State* L, const void* p, size_t size, void* user) {
+    (void)L;
+    ((std::string*)user)->append((const char*)p, size);
+    return 0;
+}
+
+extern "C" {
+
+bool script_cache_init(const char* dir) {
+    std::lock_guard<std::mutex> lock(s_mutex);
+
+    s_dir.clear();
+    if (!dir || !dir[0]) return true;
+
+    std::error_code ec;
+    std::filesystem::create_directories(dir, ec);
+    if (ec) {
+        LOG_WARN(LOG_SCRIPT, "[ScriptCache] Cannot create '%s' (%s), caching in memory only",
+                 dir, ec.message().c_str());
+        return false;
+    }
+    s_dir = dir;
+    return true;
+}
+
+int script_cache_load(lua_State* L, const char* path) {
+    std::string source;
+    if (!read_whole_file(path, &source)) {
+        lua_pushfstring(L, "cannot open %s", path);
+        return LUA_ERRFILE;
+    }
+
+    std::string chunk_name = std::string("@") + path;
+    uint64_t key = chunk_key(path, source);
+
+    // Known bytecode (memory, then disk)
+    std::string bytecode;
+    bool from_disk = false;
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        auto it = s_chunks.find(key);
+        if (it != s_chunks.end()) {
+            bytecode = it->second;
+        } else if (!s_dir.empty() && read_whole_file(disk_path(key).c_str(), &bytecode)) {
+            from_disk = true;
+        }
+    }
+
+    if (!bytecode.empty()) {
+        if (luaL_loadbuffer(L, bytecode.data(), bytecode.size(), chunk_name.c_str()) == 0) {
+            std::lock_guard<std::mutex> lock(s_mutex);
+            if (from_disk) {
+                s_chunks[key] = bytecode;
+                s_stats.disk_hits++;
+            } else {
+                s_stats.memory_hits++;
+            }
+            return 0;
+        }
+        // Stale or foreign bytecode: fall through and rebuild it
+        LOG_WARN(LOG_SCRIPT, "[ScriptCache] Discarding cached bytecode for %s: %s",
+                 path, lua_tostring(L, -1));
+        lua_pop(L, 1);
+        bytecode.clear();
+    }
+
+    // Parse the source (errors go straight back to the caller)
+    int status = luaL_loadbuffer(L, source.data(), source.size(), chunk_name.c_str());
+    if (status != 0) return status;
+
+    if (lua_dump(L, dump_writer, &bytecode) != 0 || bytecode.empty()) {
+        return 0;  // Chunk is usable, just not cacheable
+    }
+
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_stats.compiled++;
+    if (!s_dir.empty()) write_disk_entry(key, bytecode);
+    s_chunks[key] = std::move(bytecode);
+    return 0;
+}
+
+// reflex_loadfile(path) -> chunk | nil, err
+static int lua_cached_loadfile(lua_State* L) {
+    const char* path = luaL_checkstring(L, 1);
+    if (script_cache_load(L, path) != 0) {
+        lua_pushnil(L);
+        lua_insert(L, -2);  // nil, err
+        return 2;
+    }
+    return 1;
+}
+
+// package.loaders entry: the standard file search, loading through the cache
+static int lua_cached_module_loader(lua_State* L) {
+    const char* name = luaL_checkstring(L, 1);
+
+    // Raising inside this block would longjmp past the std::string
+    // destructors, so a load error is pushed and raised after it
+    bool found = false;
+    bool failed = false;
+    {
+        std::string module_path = name;
+        for (char& c : module_path) {
+            if (c == '.') c = '/';
+        }
+
+        lua_getglobal(L, "package");
+        lua_getfield(L, -1, "path");
+        std::string templates = lua_isstring(L, -1) ? lua_tostring(L, -1) : "";
+        lua_pop(L, 2);
+
+        std::string tried;
+        size_t start = 0;
+        while (start < templates.size()) {
+            size_t end = templates.find(';', start);
+            if (end == std::string::npos) end = templates.size();
+            std::string file = templates.substr(start, end - start);
+            start = end + 1;
+            if (file.empty()) continue;
+
+            for (size_t q = file.find('?'); q != std::string::npos; q = file.find('?', q + module_path.size())) {
+                file.replace(q, 1, module_path);
+            }
+
+            FILE* f = fopen(file.c_str(), "rb");
+            if (!f) {
+                tried += "\n\tno file '" + file + "'";
+                continue;
+            }
+            fclose(f);
+
+            if (script_cache_load(L, file.c_str()) != 0) {
+                lua_pushfstring(L, "error loading module '%s' from file '%s':\n\t%s",
+                                name, file.c_str(), lua_tostring(L, -1));
+                failed = true;
+            }
+            found = true;
+            break;
+        }
+
+        if (!found) lua_pushstring(L, tried.c_str());
+    }
+
+    if (failed) return lua_error(L);
+    return 1;
+}
+
+void script_cache_install(lua_State* L) {
+    lua_pushcfunction(L, lua_cached_loadfile);
+    lua_setglobal(L, "reflex_loadfile");
+
+    // Insert ahead of the source file loader (index 2, after preload)
+    lua_getglobal(L, "package");
+    if (lua_istable(L, -1)) {
+        lua_getfield(L, -1, "loaders");
+        if (lua_istable(L, -1)) {
+            int n = (int)lua_objlen(L, -1);
+            for (int i = n; i >= 2; i--) {
+                lua_rawgeti(L, -1, i);
+                lua_rawseti(L, -2, i + 1);
+            }
+            lua_pushcfunction(L, lua_cached_module_loader);
+            lua_rawseti(L, -2, 2);
+        }
+        lua_pop(L, 1);
+    }
+    lua_pop(L, 1);
+}
+
+void script_cache_clear(void) {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_chunks.clear();
+}
+
+ScriptCacheStats script_cache_get_stats(void) {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    return s_stats;
+}
+
+} // extern "C"
@@ -0,0 +1,53 @@
+/*
+ * Lua Bytecode Cache
+ * Parses each script source once and reuses the compiled chunk.
+ *
+ * Entries are keyed by a hash of (Lua version, path, source text), so an
+ * edited file misses and is recompiled while unchanged files skip the parser.
+ * The cache is shared by every Lua state in the process (all script lanes)
+ * and, when given a directory, persisted there between runs.
+ *
+ * script_cache_install hooks a state up to it:
+ *   reflex_loadfile(path)     drop-in for loadfile (used by master.lua)
+ *   require(...)              a package.loaders entry ahead of the file loader
+ */
+
+#ifndef SCRIPT_CACHE_H
+#define SCRIPT_CACHE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef struct lua_State lua_State;
+
+typedef struct {
+    uint32_t memory_hits;   // Served from the in-process cache
+    uint32_t disk_hits;     // Read from the cache directory
+    uint32_t compiled;      // Parsed from source
+} ScriptCacheStats;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Persist compiled chunks in dir (created if missing). NULL or "" keeps the
+// cache in memory only, which is also the behaviour before this is called.
+bool script_cache_init(const char* dir);
+
+// Push the compiled chunk for the file at path, like luaL_loadfile.
+// Returns 0, or a Lua error code with the message pushed instead.
+int script_cache_load(lua_State* L, const char* path);
+
+// Register reflex_loadfile and the require loader on L
+void script_cache_install(lua_State* L);
+
+// Drop the in-memory entries (files on disk are kept)
+void script_cache_clear(void);
+
+ScriptCacheStats script_cache_get_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SCRIPT_CACHE_H
@@ -0,0 +1,318 @@
+/*
+ * Reflex Script Profiler Implementation
+ *
+ * Each sample is turned into its folded stack string right away and counted
+ * in a map keyed by that string, so memory grows with the number of distinct
+ * stacks, not with run time. Samples arrive on whichever thread is running
+ * the state (script lanes run on physics workers), hence the mutex.
+ */
+
+#include "script_profile.h"
+#include "../util/log.h"
+
+#include <lua.hpp>
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+static std::mutex s_mutex;
+static std::unordered_map<std::string, uint64_t> s_stacks;   // Folded stack -> samples
+static std::unordered_map<std::string, uint32_t> s_aborts;   // "loc\treason" -> count
+static ScriptProfileStats s_stats;
+static std::vector<lua_State*> s_states;                     // Currently sampled
+
+// Registry key of a state's jit.attach handler
+static const char* TRACE_HANDLER_KEY = "script_profile.trace_handler";
+
+static void record_sample(const std::string& stack, int samples, int vmstate) {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_stacks[stack] += (uint64_t)samples;
+    s_stats.samples += (uint64_t)samples;
+    switch (vmstate) {
+        case 'N': s_stats.compiled += (uint64_t)samples; break;
+        case 'C': s_stats.native += (uint64_t)samples; break;
+        case 'G':
+        case 'J': s_stats.gc += (uint64_t)samples; break;
+        default:  s_stats.interpreted += (uint64_t)samples; break;
+    }
+}
+
+static bool is_profiled(lua_State* L) {
+    return std::find(s_states.begin(), s_states.end(), L) != s_states.end();
+}
+
+#ifdef LUAJIT_VERSION
+
+// Runs inside the VM at a safe point, on the thread executing L
+static void profile_callback(void* data, lua_State* L, int samples, int vmstate) {
+    (void)data;
+    size_t len = 0;
+
+    // Root first, "module:function;" per frame, then the leaf line
+    const char* frames = luaJIT_profile_dumpstack(L, "F;", -SCRIPT_PROFILE_MAX_DEPTH, &len);
+    std::string stack(frames, len);
+    const char* line = luaJIT_profile_dumpstack(L, "l", 1, &len);
+    stack.append(line, len);
+
+    if (stack.empty()) {
+        stack = vmstate == 'G' ? "[gc]" : vmstate == 'J' ? "[jit compiler]" : "[vm]";
+    }
+    record_sample(stack, samples, vmstate);
+}
+
+// record(location, reason), called by the jit.attach handler below
+static int lua_record_trace_abort(lua_State* L) {
+    std::string key = luaL_optstring(L, 1, "?");
+    key += '\t';
+    key += luaL_optstring(L, 2, "?");
+
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_aborts[key]++;
+    s_stats.trace_aborts++;
+    return 0;
+}
+
+// Formats an abort the way jit.dump does. jit.vmdef (the reason strings) is
+// a Lua file shipped with LuaJIT; without it the reason is the error number.
+static const char* TRACE_HANDLER_SOURCE =
+    "local record = ...\n"
+    "local has_util, jutil = pcall(require, 'jit.util')\n"
+    "local has_vmdef, vmdef = pcall(require, 'jit.vmdef')\n"
+    "local function loc(func, pc)\n"
+    "  if not has_util or type(func) ~= 'function' then return '?' end\n"
+    "  local info = jutil.funcinfo(func, pc)\n"
+    "  return info.loc or tostring(info.addr or '?')\n"
+    "end\n"
+    "return function(what, tr, func, pc, otr, oex)\n"
+    "  if what ~= 'abort' then return end\n"
+    "  local reason = tostring(otr)\n"
+    "  if type(otr) == 'number' then\n"
+    "    if type(oex) == 'function' then oex = loc(oex) end\n"
+    "    local fmt = has_vmdef and vmdef.traceerr[otr]\n"
+    "    local ok, msg = pcall(string.format, fmt or 'trace error %d (%s)', fmt and oex or otr, tostring(oex))\n"
+    "    if ok then reason = msg end\n"
+    "  end\n"
+    "  record(loc(func, pc), reason)\n"
+    "end\n";
+
+// Push the global jit table, opening the library if the host did not
+static bool push_jit_table(lua_State* L) {
+    lua_getglobal(L, "jit");
+    if (lua_istable(L, -1)) return true;
+    lua_pop(L, 1);
+
+    lua_pushcfunction(L, luaopen_jit);
+    lua_pushstring(L, LUA_JITLIBNAME);
+    if (lua_pcall(L, 1, 0, 0) != 0) {
+        lua_pop(L, 1);
+        return false;
+    }
+    lua_getglobal(L, "jit");
+    if (lua_istable(L, -1)) return true;
+    lua_pop(L, 1);
+    return false;
+}
+
+static void attach_trace_handler(lua_State* L) {
+    if (!push_jit_table(L)) return;
+    lua_getfield(L, -1, "attach");
+    if (!lua_isfunction(L, -1)) {
+        lua_pop(L, 2);
+        return;  // Interpreter-only LuaJIT build: no traces
+    }
+
+    if (luaL_loadstring(L, TRACE_HANDLER_SOURCE) != 0) {
+        LOG_WARN(LOG_SCRIPT, "[ScriptProfile] Trace handler: %s", lua_tostring(L, -1));
+        lua_pop(L, 3);
+        return;
+    }
+    lua_pushcfunction(L, lua_record_trace_abort);
+    if (lua_pcall(L, 1, 1, 0) != 0) {
+        LOG_WARN(LOG_SCRIPT, "[ScriptProfile] Trace handler: %s", lua_tostring(L, -1));
+        lua_pop(L, 3);
+        return;
+    }
+
+    // jit.attach(handler, "trace"), keeping handler for the detach
+    lua_pushvalue(L, -1);
+    lua_setfield(L, LUA_REGISTRYINDEX, TRACE_HANDLER_KEY);
+    lua_pushstring(L, "trace");
+    if (lua_pcall(L, 2, 0, 0) != 0) {
+        LOG_WARN(LOG_SCRIPT, "[ScriptProfile] jit.attach failed: %s", lua_tostring(L, -1));
+        lua_pop(L, 1);
+    }
+    lua_pop(L, 1);  // jit
+}
+
+static void detach_trace_handler(lua_State* L) {
+    lua_getfield(L, LUA_REGISTRYINDEX, TRACE_HANDLER_KEY);
+    if (!lua_isfunction(L, -1)) {
+        lua_pop(L, 1);
+        return;
+    }
+
+    // jit.attach(handler) with no event detaches it
+    lua_getglobal(L, "jit");
+    lua_getfield(L, -1, "attach");
+    lua_pushvalue(L, -3);
+    if (lua_pcall(L, 1, 0, 0) != 0) lua_pop(L, 1);
+    lua_pop(L, 2);
+
+    lua_pushnil(L);
+    lua_setfield(L, LUA_REGISTRYINDEX, TRACE_HANDLER_KEY);
+}
+
+#else
+
+// Module name as LuaJIT prints it: file name without directory or ".lua"
+static std::string module_name(const char* short_src) {
+    const char* name = strrchr(short_src, '/');
+    name = name ? name + 1 : short_src;
+    size_t len = strlen(name);
+    if (len > 4 && strcmp(name + len - 4, ".lua") == 0) len -= 4;
+    return std::string(name, len);
+}
+
+// Count hook: walk the stack from the running function outwards
+static void sample_hook(lua_State* L, lua_Debug* ar) {
+    (void)ar;
+    std::string frames[SCRIPT_PROFILE_MAX_DEPTH];
+    std::string leaf;
+    int depth = 0;
+
+    lua_Debug frame;
+    while (depth < SCRIPT_PROFILE_MAX_DEPTH && lua_getstack(L, depth, &frame)) {
+        lua_getinfo(L, "Snl", &frame);
+        if (frame.what && strcmp(frame.what, "C") == 0) {
+            frames[depth] = frame.name ? std::string("[C]:") + frame.name : "[C]";
+        } else {
+            std::string module = module_name(frame.short_src);
+            frames[depth] = frame.name ? module + ":" + frame.name
+                                       : module + ":" + std::to_string(frame.linedefined);
+            if (depth == 0 && frame.currentline > 0) {
+                leaf = module + ":" + std::to_string(frame.currentline);
+            }
+        }
+        depth++;
+    }
+
+    std::string stack;
+    for (int i = depth - 1; i >= 0; i--) {
+        stack += frames[i];
+        stack += ';';
+    }
+    stack += leaf.empty() ? "[vm]" : leaf;
+    record_sample(stack, 1, 'I');
+}
+
+#endif
+
+extern "C" {
+
+bool script_profile_start(lua_State* L, int interval_ms) {
+    if (!L) return false;
+    {
+        // Samples lock the mutex, so no Lua runs while it is held
+        std::lock_guard<std::mutex> lock(s_mutex);
+        if (is_profiled(L)) return true;
+#ifdef LUAJIT_VERSION
+        if (!s_states.empty()) return false;  // One profiled VM per process
+#endif
+        s_states.push_back(L);
+    }
+
+#ifdef LUAJIT_VERSION
+    attach_trace_handler(L);
+
+    // "F" = function-level stacks, "i<ms>" = sampling interval
+    char mode[16];
+    snprintf(mode, sizeof(mode), "Fi%d", interval_ms > 0 ? interval_ms : SCRIPT_PROFILE_DEFAULT_INTERVAL_MS);
+    luaJIT_profile_start(L, mode, profile_callback, nullptr);
+#else
+    (void)interval_ms;
+    lua_sethook(L, sample_hook, LUA_MASKCOUNT, SCRIPT_PROFILE_HOOK_COUNT);
+#endif
+    return true;
+}
+
+void script_profile_stop(lua_State* L) {
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        if (!L || !is_profiled(L)) return;
+        s_states.erase(std::find(s_states.begin(), s_states.end(), L));
+    }
+
+#ifdef LUAJIT_VERSION
+    luaJIT_profile_stop(L);
+    detach_trace_handler(L);
+#else
+    if (lua_gethook(L) == sample_hook) lua_sethook(L, nullptr, 0, 0);
+#endif
+}
+
+bool script_profile_is_running(void) {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    return !s_states.empty();
+}
+
+bool script_profile_write_folded(const char* path) {
+    std::vector<std::pair<std::string, uint64_t>> stacks;
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        stacks.assign(s_stacks.begin(), s_stacks.end());
+    }
+    std::sort(stacks.begin(), stacks.end());
+
+    FILE* f = fopen(path, "w");
+    if (!f) {
+        LOG_ERROR(LOG_SCRIPT, "[ScriptProfile] Cannot write '%s'", path);
+        return false;
+    }
+    for (const auto& entry : stacks) {
+        fprintf(f, "%s %llu\n", entry.first.c_str(), (unsigned long long)entry.second);
+    }
+    return fclose(f) == 0;
+}
+
+bool script_profile_write_aborts(const char* path) {
+    std::vector<std::pair<std::string, uint32_t>> aborts;
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        aborts.assign(s_aborts.begin(), s_aborts.end());
+    }
+    std::sort(aborts.begin(), aborts.end(),
+              [](const std::pair<std::string, uint32_t>& a, const std::pair<std::string, uint32_t>& b) {
+                  return a.second != b.second ? a.second > b.second : a.first < b.first;
+              });
+
+    FILE* f = fopen(path, "w");
+    if (!f) {
+        LOG_ERROR(LOG_SCRIPT, "[ScriptProfile] Cannot write '%s'", path);
+        return false;
+    }
+    for (const auto& entry : aborts) {
+        fprintf(f, "%u\t%s\n", entry.second, entry.first.c_str());
+    }
+    return fclose(f) == 0;
+}
+
+void script_profile_reset(void) {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_stacks.clear();
+    s_aborts.clear();
+    s_stats = ScriptProfileStats();
+}
+
+ScriptProfileStats script_profile_get_stats(void) {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    ScriptProfileStats stats = s_stats;
+    stats.stacks = (uint32_t)s_stacks.size();
+    return stats;
+}
+
+} // extern "C"
@@ -0,0 +1,71 @@
+/*
+ * Reflex Script Profiler
+ * Samples Lua call stacks and writes them as folded stacks, one line per
+ * distinct stack ("master:update;maneuver:execute;maneuver:412 57"), which
+ * flamegraph.pl, inferno and speedscope read directly.
+ *
+ * Frames are "module:function" with the sampled line as the leaf, so time
+ * is attributed to both the function and the line inside it.
+ *
+ * LuaJIT: timer-driven sampling through luaJIT_profile_start, plus a
+ * jit.attach handler that counts trace aborts by location and reason (the
+ * script paths that fall back to the interpreter). The LuaJIT profiler is
+ * process-wide, so only one Lua state can be sampled at a time.
+ * Plain Lua 5.1: a count hook samples every SCRIPT_PROFILE_HOOK_COUNT VM
+ * instructions on each started state; there are no traces to report.
+ *
+ * Samples from every profiled state go into one process-wide table.
+ */
+
+#ifndef SCRIPT_PROFILE_H
+#define SCRIPT_PROFILE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SCRIPT_PROFILE_DEFAULT_INTERVAL_MS 1
+#define SCRIPT_PROFILE_HOOK_COUNT 1000   // Instructions per sample without LuaJIT
+#define SCRIPT_PROFILE_MAX_DEPTH 64      // Frames kept per sample
+
+typedef struct lua_State lua_State;
+
+typedef struct {
+    uint64_t samples;
+    uint64_t compiled;      // LuaJIT: in JIT-compiled code
+    uint64_t interpreted;   // In the interpreter
+    uint64_t native;        // In C functions
+    uint64_t gc;            // In the garbage collector or the JIT compiler
+    uint32_t stacks;        // Distinct folded stacks
+    uint32_t trace_aborts;  // LuaJIT: aborted traces seen
+} ScriptProfileStats;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Start sampling L. Returns false if L cannot be profiled (LuaJIT: another
+// state already is). interval_ms <= 0 uses the default; ignored without LuaJIT.
+bool script_profile_start(lua_State* L, int interval_ms);
+
+// Stop sampling L (no-op if it is not being profiled). Must be called before
+// a profiled state is closed. Samples are kept until script_profile_reset.
+void script_profile_stop(lua_State* L);
+
+bool script_profile_is_running(void);
+
+// Folded stacks, sorted by stack. Returns false if path cannot be written.
+bool script_profile_write_folded(const char* path);
+
+// Trace aborts as "count<TAB>location<TAB>reason", most frequent first
+bool script_profile_write_aborts(const char* path);
+
+// Drop collected samples and aborts
+void script_profile_reset(void);
+
+ScriptProfileStats script_profile_get_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SCRIPT_PROFILE_H
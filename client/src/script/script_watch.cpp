@@ -0,0 +1,182 @@
+/*
+ * Script File Watcher Implementation
+ */
+
+#include "script_watch.h"
+#include "../util/log.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <errno.h>
+#else
+#include <unordered_map>
+#endif
+
+struct ScriptWatcher {
+    std::vector<std::string> dirs;
+    std::vector<std::string> pending;  // Changed paths not yet reported
+
+#ifdef __linux__
+    int fd;
+    std::vector<int> watch_ids;        // Watch descriptor of each entry in dirs
+#else
+    std::unordered_map<std::string, std::filesystem::file_time_type> mtimes;
+    std::chrono::steady_clock::time_point next_scan;
+#endif
+};
+
+static bool is_lua_file(const char* name) {
+    size_t len = strlen(name);
+    return len > 4 && strcmp(name + len - 4, ".lua") == 0;
+}
+
+static void add_pending(ScriptWatcher* watcher, const std::string& path) {
+    for (const std::string& p : watcher->pending) {
+        if (p == path) return;
+    }
+    watcher->pending.push_back(path);
+}
+
+#ifdef __linux__
+
+static void read_events(ScriptWatcher* watcher) {
+    alignas(struct inotify_event) char buffer[4096];
+
+    for (;;) {
+        ssize_t len = read(watcher->fd, buffer, sizeof(buffer));
+        if (len <= 0) {
+            if (len < 0 && errno != EAGAIN && errno != EINTR) {
+                LOG_WARN(LOG_SCRIPT, "[ScriptWatch] read failed: %s", strerror(errno));
+            }
+            return;
+        }
+
+        for (char* p = buffer; p < buffer + len; ) {
+            const struct inotify_event* event = (const struct inotify_event*)p;
+            p += sizeof(struct inotify_event) + event->len;
+
+            if (event->len == 0 || !is_lua_file(event->name)) continue;
+            for (size_t i = 0; i < watcher->watch_ids.size(); i++) {
+                if (watcher->watch_ids[i] == event->wd) {
+                    add_pending(watcher, watcher->dirs[i] + "/" + event->name);
+                    break;
+                }
+            }
+        }
+    }
+}
+
+#else
+
+// Record current times; report files that are new or newer than last scan
+static void scan_dirs(ScriptWatcher* watcher, bool report) {
+    for (const std::string& dir : watcher->dirs) {
+        std::error_code ec;
+        for (std::filesystem::directory_iterator it(dir, ec), end; !ec && it != end; it.increment(ec)) {
+            std::string name = it->path().filename().string();
+            if (!is_lua_file(name.c_str())) continue;
+
+            std::string path = dir + "/" + name;
+            std::filesystem::file_time_type mtime = it->last_write_time(ec);
+            if (ec) continue;
+
+            auto found = watcher->mtimes.find(path);
+            if (found == watcher->mtimes.end() || found->second != mtime) {
+                if (report) add_pending(watcher, path);
+                watcher->mtimes[path] = mtime;
+            }
+        }
+    }
+}
+
+#endif
+
+extern "C" {
+
+ScriptWatcher* script_watcher_create(const char* const* dirs, int dir_count) {
+    auto* watcher = new ScriptWatcher();
+
+#ifdef __linux__
+    watcher->fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (watcher->fd < 0) {
+        LOG_WARN(LOG_SCRIPT, "[ScriptWatch] inotify unavailable: %s", strerror(errno));
+        delete watcher;
+        return nullptr;
+    }
+
+    for (int i = 0; i < dir_count; i++) {
+        int wd = inotify_add_watch(watcher->fd, dirs[i], IN_CLOSE_WRITE | IN_MOVED_TO);
+        if (wd < 0) {
+            LOG_WARN(LOG_SCRIPT, "[ScriptWatch] Cannot watch '%s': %s", dirs[i], strerror(errno));
+            continue;
+        }
+        watcher->watch_ids.push_back(wd);
+        watcher->dirs.push_back(dirs[i]);
+    }
+
+    if (watcher->dirs.empty()) {
+        close(watcher->fd);
+        delete watcher;
+        return nullptr;
+    }
+#else
+    for (int i = 0; i < dir_count; i++) {
+        std::error_code ec;
+        if (std::filesystem::is_directory(dirs[i], ec)) {
+            watcher->dirs.push_back(dirs[i]);
+        } else {
+            LOG_WARN(LOG_SCRIPT, "[ScriptWatch] Cannot watch '%s': not a directory", dirs[i]);
+        }
+    }
+    if (watcher->dirs.empty()) {
+        delete watcher;
+        return nullptr;
+    }
+    scan_dirs(watcher, false);
+    watcher->next_scan = std::chrono::steady_clock::now();
+#endif
+
+    LOG_INFO(LOG_SCRIPT, "[ScriptWatch] Watching %d script director%s",
+             (int)watcher->dirs.size(), watcher->dirs.size() == 1 ? "y" : "ies");
+    return watcher;
+}
+
+void script_watcher_destroy(ScriptWatcher* watcher) {
+    if (!watcher) return;
+#ifdef __linux__
+    close(watcher->fd);
+#endif
+    delete watcher;
+}
+
+int script_watcher_poll(ScriptWatcher* watcher, char paths[][SCRIPT_WATCH_PATH_MAX], int max) {
+    if (!watcher || !paths || max <= 0) return 0;
+
+#ifdef __linux__
+    read_events(watcher);
+#else
+    auto now = std::chrono::steady_clock::now();
+    if (now >= watcher->next_scan) {
+        scan_dirs(watcher, true);
+        watcher->next_scan = now + std::chrono::milliseconds(500);
+    }
+#endif
+
+    int count = 0;
+    while (count < max && count < (int)watcher->pending.size()) {
+        snprintf(paths[count], SCRIPT_WATCH_PATH_MAX, "%s", watcher->pending[count].c_str());
+        count++;
+    }
+    watcher->pending.erase(watcher->pending.begin(), watcher->pending.begin() + count);
+    return count;
+}
+
+} // extern "C"
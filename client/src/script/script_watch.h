@@ -0,0 +1,39 @@
+/*
+ * Script File Watcher
+ * Reports .lua files that were written in a set of directories, for
+ * incremental hot reload (reflex_reload_changed).
+ *
+ * Linux uses inotify (close-after-write and rename-into, so both in-place
+ * saves and editors that write a temp file are seen). Elsewhere the
+ * directories are rescanned for newer modification times twice a second.
+ *
+ * Not recursive: list each directory to watch. Paths are reported as
+ * "<dir>/<file>", exactly as the directory was given.
+ */
+
+#ifndef SCRIPT_WATCH_H
+#define SCRIPT_WATCH_H
+
+#include <stdbool.h>
+
+#define SCRIPT_WATCH_PATH_MAX 512
+
+typedef struct ScriptWatcher ScriptWatcher;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Start watching dirs. Returns NULL if none of them could be watched.
+ScriptWatcher* script_watcher_create(const char* const* dirs, int dir_count);
+void script_watcher_destroy(ScriptWatcher* watcher);
+
+// Non-blocking. Copies up to max distinct changed paths since the last poll
+// into paths and returns how many (changes past max are kept for next time).
+int script_watcher_poll(ScriptWatcher* watcher, char paths[][SCRIPT_WATCH_PATH_MAX], int max);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SCRIPT_WATCH_H
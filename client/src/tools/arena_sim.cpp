@@ -0,0 +1,378 @@
+/*
+ * arena_sim - Headless Arena Simulation
+ *
+ * Loads a scene, builds the physics world and vehicle scripts, then steps
+ * the simulation as fast as possible with no window or GL context.
+ * Links only the arena_sim_core library (physics, config, maneuvers, scripts).
+ *
+ * With --worlds N, N independent copies of the scene are stepped
+ * concurrently on one shared job pool (physics_step_batch).
+ *
+ * With --seed S, every world runs in deterministic lockstep mode and the
+ * per-step state hashes of all worlds are compared (they must never differ).
+ *
+ * With --trace FILE, the profiler's spans are written as Chrome trace JSON.
+ *
+ * With --assists lua|native, scripts that have a built-in C++ version
+ * (native_assists.h) all run as Lua or all run natively, overriding the
+ * vehicle JSON's "native" flags.
+ *
+ * With --script-profile FILE, the first world's Lua scripts are sampled and
+ * written as folded stacks (trace aborts go to FILE.aborts).
+ *
+ * Equipment, scene and vehicle configs are baked into --config-cache DIR
+ * (default config_cache) and mapped from there while the JSON is unchanged.
+ * --bake loads them (baking anything stale) and exits, for preparing worker
+ * images offline.
+ *
+ * Usage: arena_sim [--scene path] [--steps N] [--worlds N] [--seed S] [--no-scripts] [--throttle T]
+ *                  [--assists json|lua|native] [--trace FILE] [--script-profile FILE] [--log SPEC]
+ *                  [--config-cache DIR] [--no-config-cache] [--bake]
+ * Run from the build directory (asset paths are ../../assets/...).
+ */
+
+#include "physics/jolt_physics.h"
+#include "game/config_cache.h"
+#include "game/config_loader.h"
+#include "game/equipment_loader.h"
+#include "script/reflex_script.h"
+#include "script/script_cache.h"
+#include "script/script_profile.h"
+#include "util/profiler.h"
+#include "util/log.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+// Where vehicle scripts with a native version run (--assists)
+typedef enum {
+    ASSISTS_JSON,    // As each script's "native" flag says
+    ASSISTS_LUA,     // Always the Lua script
+    ASSISTS_NATIVE   // Native whenever one exists
+} AssistMode;
+
+// One simulated arena (world + its own script engine)
+typedef struct {
+    PhysicsWorld physics;
+    ReflexScriptEngine* script_engine;
+    int vehicle_ids[MAX_SCENE_VEHICLES];
+    int vehicle_count;
+} SimInstance;
+
+static void print_usage(const char* exe) {
+    printf("Usage: %s [options]\n", exe);
+    printf("  --scene <path>    Scene JSON (default ../../assets/config/scenes/showdown.json)\n");
+    printf("  --steps <n>       Physics steps to run (default 6000)\n");
+    printf("  --worlds <n>      Independent worlds stepped in parallel (default 1)\n");
+    printf("  --seed <s>        Deterministic lockstep with match seed s; checks worlds for desync\n");
+    printf("  --throttle <t>    Constant throttle applied to every vehicle, 0-1 (default 0)\n");
+    printf("  --no-scripts      Do not attach vehicle reflex scripts\n");
+    printf("  --script-lanes <n> Lua states running vehicle scripts in parallel (default 1)\n");
+    printf("  --script-budget <n> Lua instructions per script update, 0 = unlimited (default 0)\n");
+    printf("  --assists <mode>  json, lua or native: where scripts with a C++ version run (default json)\n");
+    printf("  --trace <path>    Write profiler spans as Chrome trace JSON at exit\n");
+    printf("  --script-profile <path> Sample Lua scripts, write folded stacks at exit\n");
+    printf("  --log <spec>      Log levels, e.g. \"info\" or \"drivetrain=off,physics=debug\"\n");
+    printf("  --config-cache <dir> Baked config directory (default config_cache)\n");
+    printf("  --no-config-cache Always parse the JSON configs\n");
+    printf("  --bake            Load (and bake) the configs, then exit\n");
+}
+
+// Build static geometry, vehicles and scripts for one instance
+static void build_instance(SimInstance* sim, const SceneJSON* scene,
+                           const VehicleJSON* vconfigs, const bool* vconfig_ok,
+                           AssistMode assists) {
+    PhysicsWorld* pw = &sim->physics;
+
+    physics_set_ground(pw, scene->arena.ground_y);
+    physics_begin_static_batch(pw);
+    physics_add_arena_walls(pw, scene->arena.size,
+                            scene->arena.wall_height,
+                            scene->arena.wall_thickness);
+    for (int i = 0; i < scene->obstacle_count; i++) {
+        const SceneObstacle* o = &scene->obstacles[i];
+        if (strcmp(o->type, "ramp") == 0) {
+            physics_add_ramp_obstacle(pw, o->position, o->size, o->rotation_y);
+        } else {
+            physics_add_box_obstacle(pw, o->position, o->size);
+        }
+    }
+    physics_end_static_batch(pw);
+
+    sim->vehicle_count = 0;
+    for (int i = 0; i < scene->vehicle_count; i++) {
+        if (!vconfig_ok[i]) continue;
+        const SceneVehicle* sv = &scene->vehicles[i];
+        const VehicleJSON* vconfig = &vconfigs[i];
+
+        VehicleConfig vehicle_cfg = config_vehicle_to_physics(vconfig);
+        int phys_id = physics_create_vehicle(pw, sv->position, sv->rotation, &vehicle_cfg);
+        if (phys_id < 0) continue;
+        sim->vehicle_ids[sim->vehicle_count++] = phys_id;
+
+        if (sim->script_engine) {
+            for (int si = 0; si < vconfig->script_count; si++) {
+                const VehicleScript* vs = &vconfig->scripts[si];
+                if (!vs->enabled) continue;
+
+                const char* keys[MAX_SCRIPT_OPTIONS];
+                float values[MAX_SCRIPT_OPTIONS];
+                for (int opt = 0; opt < vs->option_count; opt++) {
+                    keys[opt] = vs->options[opt].key;
+                    values[opt] = vs->options[opt].value;
+                }
+                bool want_native = assists == ASSISTS_NATIVE || (assists == ASSISTS_JSON && vs->native);
+                bool native = want_native &&
+                              reflex_attach_native_script(sim->script_engine, phys_id, vs->name,
+                                                          keys, values, vs->option_count);
+                if (!native) {
+                    reflex_attach_script(sim->script_engine, phys_id, vs->name, vs->path,
+                                         keys, values, vs->option_count);
+                }
+            }
+        }
+    }
+}
+
+int main(int argc, char* argv[]) {
+    const char* scene_path = "../../assets/config/scenes/showdown.json";
+    int step_count = 6000;
+    int world_count = 1;
+    float throttle = 0.0f;
+    bool use_scripts = true;
+    int script_lanes = 1;
+    int script_budget = 0;
+    AssistMode assists = ASSISTS_JSON;
+    bool deterministic = false;
+    uint64_t seed = 0;
+    const char* trace_path = NULL;
+    const char* script_profile_path = NULL;
+    const char* config_cache_dir = "config_cache";
+    bool bake_only = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--scene") == 0 && i + 1 < argc) {
+            scene_path = argv[++i];
+        } else if (strcmp(argv[i], "--steps") == 0 && i + 1 < argc) {
+            step_count = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--worlds") == 0 && i + 1 < argc) {
+            world_count = atoi(argv[++i]);
+            if (world_count < 1) world_count = 1;
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = strtoull(argv[++i], NULL, 0);
+            deterministic = true;
+        } else if (strcmp(argv[i], "--throttle") == 0 && i + 1 < argc) {
+            throttle = (float)atof(argv[++i]);
+        } else if (strcmp(argv[i], "--trace") == 0 && i + 1 < argc) {
+            trace_path = argv[++i];
+        } else if (strcmp(argv[i], "--log") == 0 && i + 1 < argc) {
+            if (!log_parse_levels(argv[++i])) return 1;
+        } else if (strcmp(argv[i], "--no-scripts") == 0) {
+            use_scripts = false;
+        } else if (strcmp(argv[i], "--script-lanes") == 0 && i + 1 < argc) {
+            script_lanes = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--script-budget") == 0 && i + 1 < argc) {
+            script_budget = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--assists") == 0 && i + 1 < argc) {
+            const char* mode = argv[++i];
+            if (strcmp(mode, "json") == 0) {
+                assists = ASSISTS_JSON;
+            } else if (strcmp(mode, "lua") == 0) {
+                assists = ASSISTS_LUA;
+            } else if (strcmp(mode, "native") == 0) {
+                assists = ASSISTS_NATIVE;
+            } else {
+                fprintf(stderr, "Unknown --assists mode '%s' (json, lua or native)\n", mode);
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--script-profile") == 0 && i + 1 < argc) {
+            script_profile_path = argv[++i];
+        } else if (strcmp(argv[i], "--config-cache") == 0 && i + 1 < argc) {
+            config_cache_dir = argv[++i];
+        } else if (strcmp(argv[i], "--no-config-cache") == 0) {
+            config_cache_dir = NULL;
+        } else if (strcmp(argv[i], "--bake") == 0) {
+            bake_only = true;
+        } else {
+            print_usage(argv[0]);
+            return strcmp(argv[i], "--help") == 0 ? 0 : 1;
+        }
+    }
+
+    log_init();
+    printf("=== Arena Sim (headless) ===\n");
+    if (use_scripts) script_cache_init("script_cache");
+    config_cache_init(config_cache_dir);
+
+    if (!equipment_load_all("../../assets/data/equipment")) {
+        fprintf(stderr, "Warning: Equipment data not loaded - using defaults\n");
+    }
+
+    SceneJSON scene;
+    if (!config_load_scene(scene_path, &scene)) {
+        fprintf(stderr, "Failed to load scene: %s\n", scene_path);
+        return 1;
+    }
+
+    // Vehicle configs are parsed once and shared by every instance
+    std::vector<VehicleJSON> vconfigs(scene.vehicle_count);
+    bool vconfig_ok[MAX_SCENE_VEHICLES] = {false};
+    for (int i = 0; i < scene.vehicle_count; i++) {
+        char config_path[256];
+        snprintf(config_path, sizeof(config_path), "../../assets/data/vehicles/%s.json", scene.vehicles[i].type);
+        vconfig_ok[i] = config_load_vehicle(config_path, &vconfigs[i]);
+        if (!vconfig_ok[i]) {
+            fprintf(stderr, "Failed to load vehicle config: %s\n", config_path);
+        }
+    }
+
+    if (config_cache_enabled()) {
+        ConfigCacheStats cache_stats = config_cache_get_stats();
+        printf("Config cache: %u baked, %u loaded from %s\n",
+               cache_stats.baked, cache_stats.hits, config_cache_dir);
+    }
+    if (bake_only) {
+        bool all_ok = true;
+        for (int i = 0; i < scene.vehicle_count; i++) all_ok = all_ok && vconfig_ok[i];
+        config_free_scene(&scene);
+        return all_ok ? 0 : 1;
+    }
+
+    // Single world owns its job system; several worlds share one pool
+    PhysicsJobPool* pool = world_count > 1 ? physics_job_pool_create(-1) : NULL;
+
+    std::vector<SimInstance> sims(world_count);
+    std::vector<PhysicsWorld*> worlds(world_count);
+    for (int w = 0; w < world_count; w++) {
+        SimInstance* sim = &sims[w];
+        if (!physics_init_with_pool(&sim->physics, pool)) {
+            fprintf(stderr, "Failed to initialize physics (world %d)\n", w);
+            return 1;
+        }
+        if (deterministic) {
+            physics_set_deterministic(&sim->physics, true, seed);
+        }
+        sim->script_engine = use_scripts ? reflex_create_lanes(script_lanes) : NULL;
+        reflex_set_script_budget(sim->script_engine, script_budget);
+        build_instance(sim, &scene, vconfigs.data(), vconfig_ok, assists);
+        // Scripts run inside physics_step, once per substep
+        reflex_bind_physics_step(sim->script_engine, &sim->physics);
+        worlds[w] = &sim->physics;
+    }
+
+    const float dt = sims[0].physics.step_size;
+    printf("Scene '%s': %d world(s) x %d vehicles, %d obstacles, %d steps @ %.0f Hz\n",
+           scene.name, world_count, sims[0].vehicle_count, scene.obstacle_count,
+           step_count, 1.0f / dt);
+
+    // Sample only the first world: LuaJIT has one profiler per process
+    if (script_profile_path && !reflex_profile_start(sims[0].script_engine, 0)) {
+        fprintf(stderr, "--script-profile ignored: no script engine to sample\n");
+        script_profile_path = NULL;
+    }
+
+    // Step as fast as possible: feed exactly one fixed step per iteration
+    auto start = std::chrono::steady_clock::now();
+    int desync_step = -1;
+
+    for (int step = 0; step < step_count; step++) {
+        for (int w = 0; w < world_count; w++) {
+            SimInstance* sim = &sims[w];
+            for (int v = 0; v < sim->vehicle_count; v++) {
+                physics_vehicle_set_throttle(&sim->physics, sim->vehicle_ids[v], throttle);
+            }
+        }
+
+        if (pool) {
+            physics_step_batch(pool, worlds.data(), world_count, dt);
+        } else {
+            physics_step(&sims[0].physics, dt);
+        }
+
+        // Lockstep check: one compare per world per step
+        if (deterministic && desync_step < 0) {
+            uint64_t expected = physics_get_state_hash(worlds[0]);
+            for (int w = 1; w < world_count; w++) {
+                if (physics_get_state_hash(worlds[w]) != expected) {
+                    desync_step = step;
+                    fprintf(stderr, "DESYNC at step %d: world %d hash differs from world 0\n", step, w);
+                    break;
+                }
+            }
+        }
+    }
+
+    auto end = std::chrono::steady_clock::now();
+    reflex_profile_stop(sims[0].script_engine);
+    double elapsed = std::chrono::duration<double>(end - start).count();
+    double sim_seconds = step_count * (double)dt * world_count;
+
+    log_flush();
+    printf("\n=== Results ===\n");
+    printf("Wall time:  %.3f s\n", elapsed);
+    printf("Sim time:   %.1f s across %d world(s) (%.1fx real time)\n", sim_seconds, world_count,
+           elapsed > 0.0 ? sim_seconds / elapsed : 0.0);
+    printf("Step cost:  %.1f us/step/world\n",
+           step_count > 0 ? elapsed * 1e6 / ((double)step_count * world_count) : 0.0);
+
+    if (deterministic) {
+        printf("State hash: %016llx (seed %llu)%s\n",
+               (unsigned long long)physics_get_state_hash(worlds[0]), (unsigned long long)seed,
+               desync_step < 0 ? "" : "  ** DESYNC **");
+    }
+
+    SimInstance* first = &sims[0];
+    for (int v = 0; v < first->vehicle_count; v++) {
+        Vec3 pos = {0, 0, 0};
+        float speed = 0.0f;
+        physics_vehicle_get_position(&first->physics, first->vehicle_ids[v], &pos);
+        physics_vehicle_get_velocity(&first->physics, first->vehicle_ids[v], &speed);
+        printf("Vehicle %d: pos=(%.2f, %.2f, %.2f) speed=%.2f m/s\n",
+               first->vehicle_ids[v], pos.x, pos.y, pos.z, speed);
+    }
+
+    if (first->script_engine) {
+        ScriptCacheStats cache = script_cache_get_stats();
+        printf("Script cache: %u compiled, %u memory hits, %u disk hits\n",
+               cache.compiled, cache.memory_hits, cache.disk_hits);
+
+        ScriptCostStats costs[64];
+        int cost_count = reflex_get_script_stats(first->script_engine, costs, 64);
+        for (int i = 0; i < cost_count; i++) {
+            printf("Script %d/%s: min=%.1f avg=%.1f p99=%.1f us, %u overruns%s\n",
+                   costs[i].vehicle_id, costs[i].script_name, costs[i].min_us, costs[i].avg_us,
+                   costs[i].p99_us, costs[i].overruns, costs[i].suspended ? " (suspended)" : "");
+        }
+    }
+
+    if (script_profile_path) {
+        ScriptProfileStats prof = script_profile_get_stats();
+        std::string aborts_path = std::string(script_profile_path) + ".aborts";
+        script_profile_write_folded(script_profile_path);
+        script_profile_write_aborts(aborts_path.c_str());
+        printf("Script profile: %llu samples (%llu compiled, %llu interpreted), %u stacks -> %s\n",
+               (unsigned long long)prof.samples, (unsigned long long)prof.compiled,
+               (unsigned long long)prof.interpreted, prof.stacks, script_profile_path);
+        printf("Trace aborts:   %u -> %s\n", prof.trace_aborts, aborts_path.c_str());
+    }
+
+    for (int w = 0; w < world_count; w++) {
+        if (sims[w].script_engine) reflex_destroy(sims[w].script_engine);
+        physics_destroy(&sims[w].physics);
+    }
+    physics_job_pool_destroy(pool);
+    config_free_scene(&scene);
+
+    if (trace_path) {
+#if ARENA_PROFILE
+        profiler_dump_chrome_trace(trace_path);
+#else
+        fprintf(stderr, "--trace ignored: built with ARENA_PROFILER=OFF\n");
+#endif
+    }
+    return desync_step < 0 ? 0 : 2;
+}
@@ -0,0 +1,230 @@
+/*
+ * assist_bench - Native vs Lua Driver Assist Benchmark
+ *
+ * Puts N copies of one vehicle in a headless world, rolling at speed with
+ * locked wheels and full brake so ABS intervenes on every update, then times
+ * reflex_update_all with the vehicle's assist scripts attached as Lua and
+ * again as native C++ (reflex_attach_native_script). Only scripts that have
+ * a native version are attached, so both runs do the same work.
+ *
+ * Also checks the two paths agree: from the same saved world, both run
+ * BENCH_PARITY_FRAMES frames of update + physics step, and the brake and
+ * throttle each leaves on every vehicle must match on every frame.
+ *
+ * Usage: assist_bench [--vehicle path] [--vehicles N] [--updates N]
+ * Run from the build directory (asset paths are ../../assets/...).
+ */
+
+#include "physics/jolt_physics.h"
+#include "game/config_loader.h"
+#include "game/equipment_loader.h"
+#include "script/reflex_script.h"
+#include "script/script_cache.h"
+#include "util/profiler.h"
+#include "util/log.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BENCH_SPEED_MS 20.0f
+#define BENCH_PARITY_FRAMES 30
+
+typedef struct {
+    float brake[BENCH_PARITY_FRAMES][MAX_PHYSICS_VEHICLES];
+    float throttle[BENCH_PARITY_FRAMES][MAX_PHYSICS_VEHICLES];
+} BenchControls;
+
+static void print_usage(const char* exe) {
+    printf("Usage: %s [options]\n", exe);
+    printf("  --vehicle <path>  Vehicle JSON (default ../../assets/data/vehicles/sports_car.json)\n");
+    printf("  --vehicles <n>    Vehicles updated per step (default 16)\n");
+    printf("  --updates <n>     Timed updates per mode (default 20000)\n");
+}
+
+// Attach the vehicle's assist scripts (those with a native version) to every
+// vehicle, native or Lua. ABS is forced on so it has work to do.
+static int attach_assists(ReflexScriptEngine* engine, const VehicleJSON* vconfig,
+                          const int* ids, int count, bool native) {
+    int attached = 0;
+    for (int si = 0; si < vconfig->script_count; si++) {
+        const VehicleScript* vs = &vconfig->scripts[si];
+        if (!vs->enabled || !reflex_has_native_script(vs->name)) continue;
+
+        const char* keys[MAX_SCRIPT_OPTIONS + 1];
+        float values[MAX_SCRIPT_OPTIONS + 1];
+        int option_count = 0;
+        for (int opt = 0; opt < vs->option_count; opt++) {
+            if (strcmp(vs->options[opt].key, "abs_enabled") == 0) continue;
+            keys[option_count] = vs->options[opt].key;
+            values[option_count] = vs->options[opt].value;
+            option_count++;
+        }
+        keys[option_count] = "abs_enabled";
+        values[option_count] = 1.0f;
+        option_count++;
+
+        for (int v = 0; v < count; v++) {
+            bool ok = native
+                ? reflex_attach_native_script(engine, ids[v], vs->name, keys, values, option_count)
+                : reflex_attach_script(engine, ids[v], vs->name, vs->path, keys, values, option_count);
+            if (ok) attached++;
+        }
+    }
+    return attached;
+}
+
+// Driver input: no throttle, full brake (the assists see this every update)
+static void apply_driver_input(PhysicsWorld* pw, const int* ids, int count) {
+    for (int v = 0; v < count; v++) {
+        physics_vehicle_set_throttle(pw, ids[v], 0.0f);
+        physics_vehicle_set_brake(pw, ids[v], 1.0f);
+    }
+}
+
+// Hard braking at speed with the wheels stopped: every assist sees lockup
+static void reset_vehicles(PhysicsWorld* pw, const int* ids, int count) {
+    for (int v = 0; v < count; v++) {
+        physics_vehicle_set_velocity(pw, ids[v], {0.0f, 0.0f, BENCH_SPEED_MS});
+    }
+    apply_driver_input(pw, ids, count);
+}
+
+// Average ns per vehicle update. First runs BENCH_PARITY_FRAMES frames from
+// start (update, then a physics step) and records each vehicle's controls.
+static double run_mode(PhysicsWorld* pw, PhysicsSnapshot* start, const VehicleJSON* vconfig,
+                       const int* ids, int count, int updates, bool native, BenchControls* out) {
+    ReflexScriptEngine* engine = reflex_create();
+    if (!engine) return -1.0;
+
+    int attached = attach_assists(engine, vconfig, ids, count, native);
+    printf("%-6s: %d script instance(s)\n", native ? "native" : "lua", attached);
+
+    const float dt = pw->step_size;
+    physics_restore_state(pw, start);
+    for (int f = 0; f < BENCH_PARITY_FRAMES; f++) {
+        apply_driver_input(pw, ids, count);
+        reflex_update_all(engine, pw, dt);
+        for (int v = 0; v < count; v++) {
+            const PhysicsVehicle* vehicle = physics_get_vehicle(pw, ids[v]);
+            out->brake[f][v] = vehicle->brake;
+            out->throttle[f][v] = vehicle->throttle;
+        }
+        physics_step(pw, dt);
+    }
+    physics_restore_state(pw, start);
+
+    // Warm up (LuaJIT traces, caches), then time
+    for (int i = 0; i < updates / 10; i++) {
+        reset_vehicles(pw, ids, count);
+        reflex_update_all(engine, pw, dt);
+    }
+
+    uint64_t total_ns = 0;
+    for (int i = 0; i < updates; i++) {
+        reset_vehicles(pw, ids, count);
+        uint64_t start = profiler_now_ns();
+        reflex_update_all(engine, pw, dt);
+        total_ns += profiler_now_ns() - start;
+    }
+
+    reflex_destroy(engine);
+    return updates > 0 && count > 0 ? (double)total_ns / ((double)updates * count) : 0.0;
+}
+
+int main(int argc, char* argv[]) {
+    const char* vehicle_path = "../../assets/data/vehicles/sports_car.json";
+    int vehicle_count = 16;
+    int updates = 20000;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--vehicle") == 0 && i + 1 < argc) {
+            vehicle_path = argv[++i];
+        } else if (strcmp(argv[i], "--vehicles") == 0 && i + 1 < argc) {
+            vehicle_count = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--updates") == 0 && i + 1 < argc) {
+            updates = atoi(argv[++i]);
+        } else {
+            print_usage(argv[0]);
+            return strcmp(argv[i], "--help") == 0 ? 0 : 1;
+        }
+    }
+    if (vehicle_count < 1) vehicle_count = 1;
+    if (vehicle_count > MAX_PHYSICS_VEHICLES) vehicle_count = MAX_PHYSICS_VEHICLES;
+
+    log_init();
+    log_set_level(LOG_SCRIPT, LOG_LEVEL_WARN);  // Attach messages would drown the results
+    log_set_level(LOG_PHYSICS, LOG_LEVEL_WARN); // Keep velocity resets silent in Debug builds
+    printf("=== Assist Bench ===\n");
+    script_cache_init("script_cache");
+
+    if (!equipment_load_all("../../assets/data/equipment")) {
+        fprintf(stderr, "Warning: Equipment data not loaded - using defaults\n");
+    }
+
+    VehicleJSON vconfig;
+    if (!config_load_vehicle(vehicle_path, &vconfig)) {
+        fprintf(stderr, "Failed to load vehicle config: %s\n", vehicle_path);
+        return 1;
+    }
+
+    PhysicsWorld physics;
+    if (!physics_init(&physics)) {
+        fprintf(stderr, "Failed to initialize physics\n");
+        return 1;
+    }
+    physics_set_ground(&physics, 0.0f);
+
+    VehicleConfig vehicle_cfg = config_vehicle_to_physics(&vconfig);
+    int ids[MAX_PHYSICS_VEHICLES];
+    int count = 0;
+    for (int v = 0; v < vehicle_count; v++) {
+        Vec3 pos = {(float)(v % 8) * 6.0f, 1.0f, (float)(v / 8) * 10.0f};
+        int id = physics_create_vehicle(&physics, pos, 0.0f, &vehicle_cfg);
+        if (id >= 0) ids[count++] = id;
+    }
+    printf("%d x %s, %d updates per mode\n", count, vconfig.name, updates);
+
+    // Both modes start their parity frames from the same world
+    reset_vehicles(&physics, ids, count);
+    PhysicsSnapshot* start = physics_snapshot_create();
+    if (!physics_save_state(&physics, start)) {
+        fprintf(stderr, "Failed to save physics state\n");
+        return 1;
+    }
+
+    static BenchControls lua_controls;
+    static BenchControls native_controls;
+    double lua_ns = run_mode(&physics, start, &vconfig, ids, count, updates, false, &lua_controls);
+    double native_ns = run_mode(&physics, start, &vconfig, ids, count, updates, true, &native_controls);
+    physics_snapshot_destroy(start);
+    log_flush();
+
+    float max_diff = 0.0f;
+    int worst_frame = 0;
+    for (int f = 0; f < BENCH_PARITY_FRAMES; f++) {
+        for (int v = 0; v < count; v++) {
+            float diff = fmaxf(fabsf(lua_controls.brake[f][v] - native_controls.brake[f][v]),
+                               fabsf(lua_controls.throttle[f][v] - native_controls.throttle[f][v]));
+            if (diff > max_diff) {
+                max_diff = diff;
+                worst_frame = f;
+            }
+        }
+    }
+
+    printf("\n=== Results (per vehicle update, including ctx fill and control apply) ===\n");
+    printf("Lua:    %8.1f ns\n", lua_ns);
+    printf("Native: %8.1f ns\n", native_ns);
+    if (lua_ns > 0.0 && native_ns > 0.0) {
+        printf("Speedup: %.1fx\n", lua_ns / native_ns);
+    }
+    printf("Controls over %d frames: max difference %.6f (frame %d)\n",
+           BENCH_PARITY_FRAMES, max_diff, worst_frame);
+
+    physics_destroy(&physics);
+    bool agree = max_diff < 1e-4f;
+    if (!agree) fprintf(stderr, "Native and Lua assists disagree\n");
+    return agree && lua_ns >= 0.0 && native_ns >= 0.0 ? 0 : 1;
+}
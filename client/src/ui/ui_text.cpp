@@ -55,7 +55,7 @@ static GLuint compile_shader(GLenum type, const char* source) {
     return shader;
 }
 
-bool text_renderer_init(TextRenderer* tr, const char* font_path, float font_size) {
+bool text_renderer_bake(TextRenderer* tr, const char* font_path, float font_size) {
     memset(tr, 0, sizeof(TextRenderer));
     tr->font_size = font_size;
 
@@ -156,6 +156,14 @@ bool text_renderer_init(TextRenderer* tr, const char* font_path, float font_size
 
     free(font_data);
 
+    tr->atlas_pixels = atlas;
+    return true;
+}
+
+bool text_renderer_upload(TextRenderer* tr) {
+    unsigned char* atlas = tr->atlas_pixels;
+    if (!atlas) return false;
+
     // Create OpenGL texture
     glGenTextures(1, &tr->texture);
     glBindTexture(GL_TEXTURE_2D, tr->texture);
@@ -167,6 +175,7 @@ bool text_renderer_init(TextRenderer* tr, const char* font_path, float font_size
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 
     free(atlas);
+    tr->atlas_pixels = NULL;
 
     // Compile shaders
     GLuint vert = compile_shader(GL_VERTEX_SHADER, text_vertex_shader);
@@ -223,11 +232,16 @@ bool text_renderer_init(TextRenderer* tr, const char* font_path, float font_size
 
     glBindVertexArray(0);
 
-    printf("Text Renderer initialized (font size: %.0f)\n", font_size);
+    printf("Text Renderer initialized (font size: %.0f)\n", tr->font_size);
     return true;
 }
 
+bool text_renderer_init(TextRenderer* tr, const char* font_path, float font_size) {
+    return text_renderer_bake(tr, font_path, font_size) && text_renderer_upload(tr);
+}
+
 void text_renderer_destroy(TextRenderer* tr) {
+    free(tr->atlas_pixels);
     if (tr->texture) glDeleteTextures(1, &tr->texture);
     if (tr->vao) glDeleteVertexArrays(1, &tr->vao);
     if (tr->vbo) glDeleteBuffers(1, &tr->vbo);
@@ -30,6 +30,7 @@ typedef struct {
     float descent;            // Distance from baseline to bottom (negative)
     float line_height;        // Recommended line spacing
     CharInfo chars[FONT_ATLAS_NUM_CHARS];
+    unsigned char* atlas_pixels;  // Baked atlas waiting for text_renderer_upload
 
     // Shader for text rendering
     GLuint shader_program;
@@ -45,6 +46,11 @@ typedef struct {
 // Initialize text renderer with a TTF font file
 bool text_renderer_init(TextRenderer* tr, const char* font_path, float font_size);
 
+// The two halves of init: rasterize the font atlas (no GL, safe on a worker
+// thread), then create the texture, shader and buffers on the GL thread
+bool text_renderer_bake(TextRenderer* tr, const char* font_path, float font_size);
+bool text_renderer_upload(TextRenderer* tr);
+
 // Cleanup
 void text_renderer_destroy(TextRenderer* tr);
 
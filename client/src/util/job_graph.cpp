@@ -0,0 +1,187 @@
+/*
+ * Job Graph Implementation
+ *
+ * One mutex guards the job list and both ready queues. Each job counts its
+ * unfinished dependencies; finishing a job decrements its dependents and
+ * queues the ones that reach zero. Jobs are coarse (a file parse, a texture
+ * decode), so the single lock is never contended enough to matter.
+ */
+
+#include "job_graph.h"
+#include "profiler.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+struct Job
+{
+    const char* name;
+    JobFunc fn;
+    void* user;
+    int flags;
+    int unmet;                  // Dependencies not finished yet
+    bool done;
+    std::vector<int> dependents;
+};
+
+struct JobGraph
+{
+    std::mutex mutex;
+    std::condition_variable workerWake;
+    std::condition_variable mainWake;
+    std::vector<Job> jobs;
+    std::deque<int> workerReady;
+    std::deque<int> mainReady;
+    int remaining;              // Jobs added but not finished
+    bool quit;
+    std::vector<std::thread> workers;
+};
+
+static void run_job(JobGraph* g, int id)
+{
+    const char* name;
+    JobFunc fn;
+    void* user;
+    {
+        std::lock_guard<std::mutex> lock(g->mutex);
+        name = g->jobs[id].name;   // Copied out: adds may grow the vector
+        fn = g->jobs[id].fn;
+        user = g->jobs[id].user;
+    }
+
+    uint64_t start = profiler_now_ns();
+    fn(g, user);
+#if ARENA_PROFILE
+    profiler_record(name, start, profiler_now_ns());
+#else
+    (void)name;
+    (void)start;
+#endif
+
+    std::lock_guard<std::mutex> lock(g->mutex);
+    Job& job = g->jobs[id];
+    job.done = true;
+    for (int dependent : job.dependents) {
+        Job& d = g->jobs[dependent];
+        if (--d.unmet == 0) {
+            if (d.flags & JOB_MAIN_THREAD) g->mainReady.push_back(dependent);
+            else g->workerReady.push_back(dependent);
+        }
+    }
+    g->remaining--;
+    g->workerWake.notify_all();
+    g->mainWake.notify_all();
+}
+
+static void worker_main(JobGraph* g)
+{
+    PROFILE_THREAD_NAME("JobWorker");
+    for (;;) {
+        int id;
+        {
+            std::unique_lock<std::mutex> lock(g->mutex);
+            g->workerWake.wait(lock, [g] { return g->quit || !g->workerReady.empty(); });
+            if (g->quit) return;
+            id = g->workerReady.front();
+            g->workerReady.pop_front();
+        }
+        run_job(g, id);
+    }
+}
+
+extern "C" {
+
+JobGraph* job_graph_create(int workers)
+{
+    if (workers < 0) {
+        workers = (int)std::thread::hardware_concurrency();
+        if (workers < 1) workers = 1;
+    }
+
+    JobGraph* g = new JobGraph();
+    g->remaining = 0;
+    g->quit = false;
+    for (int i = 0; i < workers; i++) {
+        g->workers.emplace_back(worker_main, g);
+    }
+    return g;
+}
+
+void job_graph_destroy(JobGraph* graph)
+{
+    if (!graph) return;
+    {
+        std::lock_guard<std::mutex> lock(graph->mutex);
+        graph->quit = true;
+    }
+    graph->workerWake.notify_all();
+    for (std::thread& t : graph->workers) t.join();
+    delete graph;
+}
+
+int job_graph_add(JobGraph* graph, const char* name, JobFunc fn, void* user,
+                  const int* deps, int dep_count, int flags)
+{
+    std::lock_guard<std::mutex> lock(graph->mutex);
+
+    int id = (int)graph->jobs.size();
+    for (int i = 0; i < dep_count; i++) {
+        if (deps[i] < 0 || deps[i] >= id) return -1;
+    }
+
+    // Without workers everything is run by job_graph_run
+    if (graph->workers.empty()) flags |= JOB_MAIN_THREAD;
+
+    Job job;
+    job.name = name;
+    job.fn = fn;
+    job.user = user;
+    job.flags = flags;
+    job.unmet = 0;
+    job.done = false;
+    for (int i = 0; i < dep_count; i++) {
+        Job& dep = graph->jobs[deps[i]];
+        if (dep.done) continue;
+        dep.dependents.push_back(id);
+        job.unmet++;
+    }
+    bool ready = job.unmet == 0;
+    graph->jobs.push_back(std::move(job));
+    graph->remaining++;
+
+    if (ready) {
+        if (flags & JOB_MAIN_THREAD) graph->mainReady.push_back(id);
+        else graph->workerReady.push_back(id);
+    }
+    graph->workerWake.notify_one();
+    graph->mainWake.notify_all();
+    return id;
+}
+
+void job_graph_run(JobGraph* graph)
+{
+    PROFILE_SCOPE("JobGraph.Run");
+    for (;;) {
+        int id;
+        {
+            std::unique_lock<std::mutex> lock(graph->mutex);
+            graph->mainWake.wait(lock, [graph] {
+                return graph->remaining == 0 || !graph->mainReady.empty();
+            });
+            if (graph->mainReady.empty()) return;
+            id = graph->mainReady.front();
+            graph->mainReady.pop_front();
+        }
+        run_job(graph, id);
+    }
+}
+
+int job_graph_worker_count(const JobGraph* graph)
+{
+    return (int)graph->workers.size();
+}
+
+} // extern "C"
@@ -0,0 +1,51 @@
+/*
+ * Job Graph
+ * Runs jobs with dependencies on a pool of worker threads. Jobs marked
+ * JOB_MAIN_THREAD (GL uploads) run on the thread that calls job_graph_run.
+ *
+ *   JobGraph* g = job_graph_create(-1);
+ *   int parse = job_graph_add(g, "Load.Parse", parse_fn, data, NULL, 0, 0);
+ *   job_graph_add(g, "Load.Upload", upload_fn, data, &parse, 1, JOB_MAIN_THREAD);
+ *   job_graph_run(g);
+ *   job_graph_destroy(g);
+ *
+ * Jobs may add more jobs while running (e.g. once a config names the files it
+ * needs), and may depend on jobs that have already finished. Worker jobs start
+ * as soon as they are ready; job_graph_run returns once every job is done.
+ *
+ * Job names must be string literals (each job is recorded as a profiler span).
+ */
+
+#ifndef JOB_GRAPH_H
+#define JOB_GRAPH_H
+
+#include <stdbool.h>
+
+#define JOB_MAIN_THREAD 1   // Run on the job_graph_run thread (owns the GL context)
+
+typedef struct JobGraph JobGraph;
+typedef void (*JobFunc)(JobGraph* graph, void* user);
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// workers < 0: one per hardware thread. 0: everything runs in job_graph_run.
+JobGraph* job_graph_create(int workers);
+void job_graph_destroy(JobGraph* graph);
+
+// Queue a job after deps. Safe from any thread, including from a running job.
+// Returns the job id, or -1 if a dependency id is invalid.
+int job_graph_add(JobGraph* graph, const char* name, JobFunc fn, void* user,
+                  const int* deps, int dep_count, int flags);
+
+// Run main-thread jobs until every job has finished
+void job_graph_run(JobGraph* graph);
+
+int job_graph_worker_count(const JobGraph* graph);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // JOB_GRAPH_H
@@ -0,0 +1,490 @@
+/*
+ * Zero-Copy JSON Reader Implementation
+ *
+ * json_doc_open runs the only full pass: a recursive syntax check that
+ * allocates nothing. Everything after that assumes well-formed text, so the
+ * skip functions only track brackets and string quotes.
+ */
+
+#include "json_reader.h"
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <direct.h>
+#define getcwd _getcwd
+#else
+#include <unistd.h>
+#endif
+
+#define JSON_NUMBER_MAX 64  // Longest number token accepted
+
+// ============================================================================
+// Syntax check
+// ============================================================================
+
+typedef struct {
+    const char* p;
+    const char* end;
+    const char* error;      // Message, NULL while OK
+} JsonChecker;
+
+static bool is_ws(char c) {
+    return (unsigned char)c <= 32;  // As cJSON: any control character or space
+}
+
+static const char* skip_ws(const char* p, const char* end) {
+    while (p < end && is_ws(*p)) p++;
+    return p;
+}
+
+static bool is_number_char(char c) {
+    return (c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E';
+}
+
+static bool is_hex(char c) {
+    return isxdigit((unsigned char)c) != 0;
+}
+
+static bool fail(JsonChecker* c, const char* message) {
+    if (!c->error) c->error = message;
+    return false;
+}
+
+static bool check_string(JsonChecker* c) {
+    c->p++;  // Opening quote
+    while (c->p < c->end) {
+        char ch = *c->p++;
+        if (ch == '"') return true;
+        if (ch != '\\') continue;
+
+        if (c->p >= c->end) break;
+        char esc = *c->p++;
+        if (esc == 'u') {
+            for (int i = 0; i < 4; i++) {
+                if (c->p >= c->end || !is_hex(*c->p)) return fail(c, "bad \\u escape");
+                c->p++;
+            }
+        } else if (!strchr("\"\\/bfnrt", esc)) {
+            c->p--;
+            return fail(c, "bad escape");
+        }
+    }
+    return fail(c, "unterminated string");
+}
+
+static bool check_number(JsonChecker* c) {
+    const char* start = c->p;
+    while (c->p < c->end && is_number_char(*c->p)) c->p++;
+
+    size_t len = (size_t)(c->p - start);
+    if (len == 0) return fail(c, "unexpected character");
+    if (len >= JSON_NUMBER_MAX) {
+        c->p = start;
+        return fail(c, "bad number");
+    }
+
+    char buf[JSON_NUMBER_MAX];
+    memcpy(buf, start, len);
+    buf[len] = '\0';
+    char* parsed_end = NULL;
+    strtod(buf, &parsed_end);
+    if (parsed_end != buf + len) {
+        c->p = start;
+        return fail(c, "bad number");
+    }
+    return true;
+}
+
+static bool check_literal(JsonChecker* c, const char* word) {
+    size_t len = strlen(word);
+    if ((size_t)(c->end - c->p) < len || memcmp(c->p, word, len) != 0) {
+        return fail(c, "unexpected character");
+    }
+    c->p += len;
+    return true;
+}
+
+static bool check_value(JsonChecker* c, int depth);
+
+static bool check_container(JsonChecker* c, int depth, bool object) {
+    if (depth >= JSON_MAX_DEPTH) return fail(c, "nested too deeply");
+    char close = object ? '}' : ']';
+
+    c->p = skip_ws(c->p + 1, c->end);
+    if (c->p < c->end && *c->p == close) {
+        c->p++;
+        return true;
+    }
+
+    for (;;) {
+        if (object) {
+            if (c->p >= c->end || *c->p != '"') return fail(c, "expected member name");
+            if (!check_string(c)) return false;
+            c->p = skip_ws(c->p, c->end);
+            if (c->p >= c->end || *c->p != ':') return fail(c, "expected ':'");
+            c->p = skip_ws(c->p + 1, c->end);
+        }
+        if (!check_value(c, depth + 1)) return false;
+
+        c->p = skip_ws(c->p, c->end);
+        if (c->p >= c->end) return fail(c, object ? "unterminated object" : "unterminated array");
+        if (*c->p == close) {
+            c->p++;
+            return true;
+        }
+        if (*c->p != ',') return fail(c, object ? "expected ',' or '}'" : "expected ',' or ']'");
+        c->p = skip_ws(c->p + 1, c->end);
+    }
+}
+
+static bool check_value(JsonChecker* c, int depth) {
+    if (c->p >= c->end) return fail(c, "unexpected end of file");
+    switch (*c->p) {
+        case '{': return check_container(c, depth, true);
+        case '[': return check_container(c, depth, false);
+        case '"': return check_string(c);
+        case 't': return check_literal(c, "true");
+        case 'f': return check_literal(c, "false");
+        case 'n': return check_literal(c, "null");
+        default:  return check_number(c);
+    }
+}
+
+// ============================================================================
+// Skipping (well-formed text only)
+// ============================================================================
+
+// p at the opening quote; returns the character after the closing quote
+static const char* skip_string(const char* p, const char* end) {
+    p++;
+    while (p < end) {
+        if (*p == '\\') {
+            p += 2;
+        } else if (*p++ == '"') {
+            break;
+        }
+    }
+    return p;
+}
+
+static const char* skip_value(const char* p, const char* end) {
+    if (*p != '{' && *p != '[') {
+        if (*p == '"') return skip_string(p, end);
+        while (p < end && !is_ws(*p) && *p != ',' && *p != ']' && *p != '}') p++;
+        return p;
+    }
+
+    int depth = 0;
+    while (p < end) {
+        char ch = *p;
+        if (ch == '"') {
+            p = skip_string(p, end);
+            continue;
+        }
+        if (ch == '{' || ch == '[') {
+            depth++;
+        } else if (ch == '}' || ch == ']') {
+            if (--depth == 0) return p + 1;
+        }
+        p++;
+    }
+    return p;
+}
+
+// ============================================================================
+// Strings
+// ============================================================================
+
+static unsigned parse_hex4(const char* p) {
+    unsigned v = 0;
+    for (int i = 0; i < 4; i++) {
+        char ch = p[i];
+        v <<= 4;
+        if (ch >= '0' && ch <= '9') v |= (unsigned)(ch - '0');
+        else if (ch >= 'a' && ch <= 'f') v |= (unsigned)(ch - 'a' + 10);
+        else if (ch >= 'A' && ch <= 'F') v |= (unsigned)(ch - 'A' + 10);
+    }
+    return v;
+}
+
+// Decode the string starting at quote into buf; returns the decoded length
+static size_t decode_string(const char* quote, const char* end, char* buf, size_t size) {
+    size_t n = 0;
+    const char* p = quote + 1;
+
+    while (p < end && *p != '"') {
+        char out[4];
+        size_t out_len = 1;
+
+        if (*p != '\\') {
+            out[0] = *p++;
+        } else {
+            char esc = p[1];
+            p += 2;
+            switch (esc) {
+                case 'b': out[0] = '\b'; break;
+                case 'f': out[0] = '\f'; break;
+                case 'n': out[0] = '\n'; break;
+                case 'r': out[0] = '\r'; break;
+                case 't': out[0] = '\t'; break;
+                case 'u': {
+                    unsigned cp = parse_hex4(p);
+                    p += 4;
+                    // Surrogate pair
+                    if (cp >= 0xD800 && cp <= 0xDBFF && end - p >= 6 && p[0] == '\\' && p[1] == 'u') {
+                        unsigned low = parse_hex4(p + 2);
+                        if (low >= 0xDC00 && low <= 0xDFFF) {
+                            cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+                            p += 6;
+                        }
+                    }
+                    // UTF-8
+                    if (cp < 0x80) {
+                        out[0] = (char)cp;
+                    } else if (cp < 0x800) {
+                        out[0] = (char)(0xC0 | (cp >> 6));
+                        out[1] = (char)(0x80 | (cp & 0x3F));
+                        out_len = 2;
+                    } else if (cp < 0x10000) {
+                        out[0] = (char)(0xE0 | (cp >> 12));
+                        out[1] = (char)(0x80 | ((cp >> 6) & 0x3F));
+                        out[2] = (char)(0x80 | (cp & 0x3F));
+                        out_len = 3;
+                    } else {
+                        out[0] = (char)(0xF0 | (cp >> 18));
+                        out[1] = (char)(0x80 | ((cp >> 12) & 0x3F));
+                        out[2] = (char)(0x80 | ((cp >> 6) & 0x3F));
+                        out[3] = (char)(0x80 | (cp & 0x3F));
+                        out_len = 4;
+                    }
+                    break;
+                }
+                default: out[0] = esc; break;  // \" \\ \/
+            }
+        }
+
+        if (n + out_len >= size) break;  // Truncate, keeping room for '\0'
+        memcpy(buf + n, out, out_len);
+        n += out_len;
+    }
+
+    if (size > 0) buf[n] = '\0';
+    return n;
+}
+
+// Raw (still escaped) contents of the string at quote
+static size_t raw_string(const char* quote, const char* end, const char** contents, bool* escaped) {
+    const char* p = quote + 1;
+    const char* close = skip_string(quote, end) - 1;
+    *contents = p;
+    *escaped = memchr(p, '\\', (size_t)(close - p)) != NULL;
+    return (size_t)(close - p);
+}
+
+static bool key_matches(const char* quote, const char* end, const char* key) {
+    const char* raw;
+    bool escaped;
+    size_t len = raw_string(quote, end, &raw, &escaped);
+
+    char decoded[256];
+    if (escaped) {
+        len = decode_string(quote, end, decoded, sizeof(decoded));
+        raw = decoded;
+    }
+
+    // Case-insensitive, as cJSON_GetObjectItem
+    for (size_t i = 0; i < len; i++) {
+        if (key[i] == '\0' || tolower((unsigned char)raw[i]) != tolower((unsigned char)key[i])) {
+            return false;
+        }
+    }
+    return key[len] == '\0';
+}
+
+// ============================================================================
+// Document
+// ============================================================================
+
+static void print_open_error(const char* path) {
+    // Most failures are a wrong working directory (run from client/build)
+    char cwd[1024];
+    if (getcwd(cwd, sizeof(cwd)) != NULL) {
+        fprintf(stderr, "CWD: %s\n", cwd);
+    }
+    fprintf(stderr, "Failed to open: %s\n", path);
+}
+
+extern "C" {
+
+bool json_doc_open(JsonDoc* doc, const char* path) {
+    memset(doc, 0, sizeof(*doc));
+    if (!mapped_file_open(&doc->file, path)) {
+        print_open_error(path);
+        return false;
+    }
+    doc->data = doc->file.data;
+    doc->size = doc->file.size;
+
+    const char* begin = doc->data;
+    const char* end = doc->data + doc->size;
+    if (end - begin >= 3 && memcmp(begin, "\xEF\xBB\xBF", 3) == 0) begin += 3;  // UTF-8 BOM
+
+    // Syntax check the root value; anything after it is ignored, as cJSON_Parse
+    JsonChecker checker = { skip_ws(begin, end), end, NULL };
+    const char* root = checker.p;
+    if (!check_value(&checker, 0)) {
+        int line = 1;
+        const char* line_start = doc->data;
+        for (const char* p = doc->data; p < checker.p && p < end; p++) {
+            if (*p == '\n') {
+                line++;
+                line_start = p + 1;
+            }
+        }
+        fprintf(stderr, "JSON parse error in %s:%d:%d: %s\n",
+                path, line, (int)(checker.p - line_start) + 1, checker.error);
+        json_doc_close(doc);
+        return false;
+    }
+
+    doc->root.at = root;
+    doc->root.end = end;
+    return true;
+}
+
+void json_doc_close(JsonDoc* doc) {
+    if (!doc || !doc->data) return;
+    mapped_file_close(&doc->file);
+    memset(doc, 0, sizeof(*doc));
+}
+
+JsonType json_type(JsonValue v) {
+    if (!v.at) return JSON_MISSING;
+    switch (*v.at) {
+        case '{': return JSON_OBJECT;
+        case '[': return JSON_ARRAY;
+        case '"': return JSON_STRING;
+        case 't': return JSON_TRUE;
+        case 'f': return JSON_FALSE;
+        case 'n': return JSON_NULL;
+        default:  return JSON_NUMBER;
+    }
+}
+
+bool json_is_object(JsonValue v) { return json_type(v) == JSON_OBJECT; }
+bool json_is_array(JsonValue v)  { return json_type(v) == JSON_ARRAY; }
+bool json_is_string(JsonValue v) { return json_type(v) == JSON_STRING; }
+bool json_is_number(JsonValue v) { return json_type(v) == JSON_NUMBER; }
+bool json_is_true(JsonValue v)   { return json_type(v) == JSON_TRUE; }
+
+bool json_is_bool(JsonValue v) {
+    JsonType type = json_type(v);
+    return type == JSON_TRUE || type == JSON_FALSE;
+}
+
+JsonIter json_iter(JsonValue container) {
+    JsonIter it;
+    memset(&it, 0, sizeof(it));
+    JsonType type = json_type(container);
+    if (type != JSON_OBJECT && type != JSON_ARRAY) return it;
+
+    const char* p = skip_ws(container.at + 1, container.end);
+    if (p < container.end && *p != '}' && *p != ']') it.next = p;
+    it.end = container.end;
+    it.object = type == JSON_OBJECT;
+    return it;
+}
+
+bool json_next(JsonIter* it, JsonValue* out) {
+    if (!it->next) return false;
+    const char* p = it->next;
+
+    if (it->object) {
+        it->key.at = p;
+        it->key.end = it->end;
+        p = skip_ws(skip_string(p, it->end), it->end);  // To ':'
+        p = skip_ws(p + 1, it->end);
+    }
+    out->at = p;
+    out->end = it->end;
+
+    p = skip_ws(skip_value(p, it->end), it->end);
+    it->next = (p < it->end && *p == ',') ? skip_ws(p + 1, it->end) : NULL;
+    return true;
+}
+
+JsonValue json_field(JsonValue obj, const char* key) {
+    JsonValue missing = { NULL, obj.end };
+    if (!json_is_object(obj) || !key) return missing;
+
+    JsonIter it = json_iter(obj);
+    JsonValue value;
+    while (json_next(&it, &value)) {
+        if (key_matches(it.key.at, it.end, key)) return value;
+    }
+    return missing;
+}
+
+JsonValue json_index(JsonValue container, int index) {
+    JsonValue missing = { NULL, container.end };
+    if (index < 0) return missing;
+
+    JsonIter it = json_iter(container);
+    JsonValue value;
+    for (int i = 0; json_next(&it, &value); i++) {
+        if (i == index) return value;
+    }
+    return missing;
+}
+
+int json_count(JsonValue container) {
+    JsonIter it = json_iter(container);
+    JsonValue value;
+    int count = 0;
+    while (json_next(&it, &value)) count++;
+    return count;
+}
+
+double json_number(JsonValue v) {
+    if (!json_is_number(v)) return 0.0;
+
+    char buf[JSON_NUMBER_MAX];
+    size_t len = 0;
+    while (v.at + len < v.end && len < JSON_NUMBER_MAX - 1 && is_number_char(v.at[len])) {
+        buf[len] = v.at[len];
+        len++;
+    }
+    buf[len] = '\0';
+    return strtod(buf, NULL);
+}
+
+const char* json_string(JsonValue v, char* buf, size_t size) {
+    if (!buf || size == 0) return "";
+    if (!json_is_string(v)) {
+        buf[0] = '\0';
+        return buf;
+    }
+    decode_string(v.at, v.end, buf, size);
+    return buf;
+}
+
+bool json_string_is(JsonValue v, const char* s) {
+    if (!json_is_string(v) || !s) return false;
+
+    const char* raw;
+    bool escaped;
+    size_t len = raw_string(v.at, v.end, &raw, &escaped);
+    if (!escaped) {
+        return strlen(s) == len && memcmp(raw, s, len) == 0;
+    }
+
+    char decoded[512];
+    decode_string(v.at, v.end, decoded, sizeof(decoded));
+    return strcmp(decoded, s) == 0;
+}
+
+} // extern "C"
@@ -0,0 +1,111 @@
+/*
+ * Zero-Copy JSON Reader
+ * Shared loader for config, equipment and effect files.
+ *
+ * The file is memory-mapped and checked once for syntax; no tree is built.
+ * A JsonValue is just a pointer to where a value starts in the mapped text.
+ * Fields and elements are found by scanning (skipping nested values without
+ * decoding them), and strings and numbers are only decoded when read, so
+ * the cost of a load follows what the loader asks for, not the file size.
+ *
+ *   JsonDoc doc;
+ *   if (!json_doc_open(&doc, path)) return false;
+ *   float mass = (float)json_number(json_field(doc.root, "mass"));
+ *   JsonValue wheel;
+ *   JSON_FOR_EACH(wheel, json_field(doc.root, "wheels")) { ... }
+ *   json_doc_close(&doc);
+ *
+ * Values point into the mapping and are valid until json_doc_close.
+ * Field lookup is case-insensitive and returns the first match, as
+ * cJSON_GetObjectItem did. Missing values read as null/0/"".
+ */
+
+#ifndef JSON_READER_H
+#define JSON_READER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "mapped_file.h"
+
+#define JSON_MAX_DEPTH 256
+
+typedef enum {
+    JSON_MISSING = 0,   // Field or element not present
+    JSON_NULL,
+    JSON_FALSE,
+    JSON_TRUE,
+    JSON_NUMBER,
+    JSON_STRING,
+    JSON_ARRAY,
+    JSON_OBJECT
+} JsonType;
+
+typedef struct {
+    const char* at;     // First character of the value, NULL = missing
+    const char* end;    // End of the document text
+} JsonValue;
+
+// Walks an array's elements or an object's members (see JSON_FOR_EACH)
+typedef struct {
+    const char* next;   // Next element/member, NULL when done
+    const char* end;
+    bool object;
+    JsonValue key;      // Objects: key string of the current member
+} JsonIter;
+
+typedef struct {
+    const char* data;
+    size_t size;
+    JsonValue root;
+    MappedFile file;
+} JsonDoc;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Map and syntax-check a file. Prints the reason (with line and column for
+// syntax errors) and returns false on failure.
+bool json_doc_open(JsonDoc* doc, const char* path);
+void json_doc_close(JsonDoc* doc);
+
+JsonType json_type(JsonValue v);
+bool json_is_object(JsonValue v);
+bool json_is_array(JsonValue v);
+bool json_is_string(JsonValue v);
+bool json_is_number(JsonValue v);
+bool json_is_bool(JsonValue v);
+bool json_is_true(JsonValue v);
+
+// Member of an object (missing if v is not an object or has no such key)
+JsonValue json_field(JsonValue obj, const char* key);
+
+// Element of an array, or member value of an object, by position
+JsonValue json_index(JsonValue container, int index);
+
+// Elements of an array or members of an object (0 for anything else)
+int json_count(JsonValue container);
+
+JsonIter json_iter(JsonValue container);
+bool json_next(JsonIter* it, JsonValue* out);
+
+// Number value, 0 if v is not a number
+double json_number(JsonValue v);
+
+// Decode a string value into buf (always terminated, truncated to size - 1).
+// Returns buf; "" if v is not a string.
+const char* json_string(JsonValue v, char* buf, size_t size);
+
+// True if v is a string equal to s (exact match)
+bool json_string_is(JsonValue v, const char* s);
+
+#ifdef __cplusplus
+}
+#endif
+
+// Loop over a container's values with a JsonValue declared by the caller.
+// For objects the member's key is item##_iter.key.
+#define JSON_FOR_EACH(item, container) \
+    for (JsonIter item##_iter = json_iter(container); json_next(&item##_iter, &(item)); )
+
+#endif // JSON_READER_H
@@ -0,0 +1,263 @@
+/*
+ * Asynchronous Channel Logger Implementation
+ *
+ * Bounded multi-producer queue (Vyukov style): each slot carries a sequence
+ * number. A producer claims a position with one CAS, formats straight into
+ * the slot and publishes it by storing pos + 1. The single drain thread
+ * consumes slots in order and hands them back by storing pos + LOG_QUEUE_SIZE.
+ * Producers never take a lock or make a syscall.
+ */
+
+#include "log.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+typedef struct {
+    std::atomic<uint64_t> sequence;
+    uint8_t channel;
+    uint8_t level;
+    char text[LOG_MESSAGE_MAX];
+} LogSlot;
+
+static LogSlot s_slots[LOG_QUEUE_SIZE];
+static std::atomic<uint64_t> s_enqueue_pos{0};
+static std::atomic<uint64_t> s_dequeue_pos{0};
+static std::atomic<uint64_t> s_dropped{0};
+static std::atomic<bool> s_running{false};
+
+static std::atomic<int> s_levels[LOG_CHANNEL_COUNT] = {
+    {ARENA_LOG_COMPILE_LEVEL}, {ARENA_LOG_COMPILE_LEVEL},
+    {ARENA_LOG_COMPILE_LEVEL}, {ARENA_LOG_COMPILE_LEVEL}
+};
+
+static const char* s_channel_names[LOG_CHANNEL_COUNT] = {
+    "physics", "drivetrain", "script", "maneuver"
+};
+static const char* s_level_names[] = { "off", "error", "warn", "info", "debug" };
+
+// Drain thread control (never touched by producers)
+static std::thread s_drain_thread;
+static std::mutex s_drain_mutex;
+static std::condition_variable s_drain_wake;
+static bool s_drain_quit = false;
+
+static void write_line(int level, const char* text) {
+    FILE* out = (level <= LOG_LEVEL_WARN) ? stderr : stdout;
+    fputs(text, out);
+    fputc('\n', out);
+}
+
+// Write every published slot. Returns the number written.
+// Only the drain thread (or log_shutdown after joining it) calls this.
+static int drain_queue(void) {
+    uint64_t pos = s_dequeue_pos.load(std::memory_order_relaxed);
+    int written = 0;
+
+    for (;;) {
+        LogSlot* slot = &s_slots[pos & (LOG_QUEUE_SIZE - 1)];
+        if (slot->sequence.load(std::memory_order_acquire) != pos + 1) break;
+
+        write_line(slot->level, slot->text);
+        slot->sequence.store(pos + LOG_QUEUE_SIZE, std::memory_order_release);
+        pos++;
+        written++;
+    }
+    s_dequeue_pos.store(pos, std::memory_order_release);
+
+    if (written > 0) {
+        fflush(stdout);
+        fflush(stderr);
+    }
+    return written;
+}
+
+static void drain_main(void) {
+    uint64_t reported_drops = 0;
+
+    for (;;) {
+        drain_queue();
+
+        uint64_t dropped = s_dropped.load(std::memory_order_relaxed);
+        if (dropped != reported_drops) {
+            fprintf(stderr, "[Log] %llu messages dropped (queue full)\n",
+                    (unsigned long long)(dropped - reported_drops));
+            reported_drops = dropped;
+        }
+
+        // Poll rather than have producers signal: a notify is a syscall
+        std::unique_lock<std::mutex> lock(s_drain_mutex);
+        if (s_drain_quit) return;
+        s_drain_wake.wait_for(lock, std::chrono::milliseconds(5));
+        if (s_drain_quit) return;
+    }
+}
+
+extern "C" {
+
+void log_init(void) {
+    if (s_running.load()) return;
+
+    for (uint64_t i = 0; i < LOG_QUEUE_SIZE; i++) {
+        s_slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    s_enqueue_pos.store(0, std::memory_order_relaxed);
+    s_dequeue_pos.store(0, std::memory_order_relaxed);
+
+    s_drain_quit = false;
+    s_drain_thread = std::thread(drain_main);
+    s_running.store(true, std::memory_order_release);
+
+    // Early returns from main must still drain and join (a joinable
+    // std::thread destroyed at exit would terminate the process)
+    static bool registered = false;
+    if (!registered) {
+        atexit(log_shutdown);
+        registered = true;
+    }
+}
+
+void log_shutdown(void) {
+    if (!s_running.load()) return;
+
+    s_running.store(false, std::memory_order_release);
+    {
+        std::lock_guard<std::mutex> lock(s_drain_mutex);
+        s_drain_quit = true;
+    }
+    s_drain_wake.notify_one();
+    s_drain_thread.join();
+
+    // Anything published after the drain thread's last pass
+    drain_queue();
+}
+
+void log_flush(void) {
+    if (!s_running.load(std::memory_order_acquire)) {
+        fflush(stdout);
+        return;
+    }
+
+    uint64_t target = s_enqueue_pos.load(std::memory_order_acquire);
+    s_drain_wake.notify_one();
+    while (s_dequeue_pos.load(std::memory_order_acquire) < target &&
+           s_running.load(std::memory_order_acquire)) {
+        std::this_thread::yield();
+    }
+}
+
+void log_set_level(LogChannel channel, LogLevel level) {
+    if (channel < 0 || channel >= LOG_CHANNEL_COUNT) return;
+    s_levels[channel].store((int)level, std::memory_order_relaxed);
+}
+
+LogLevel log_get_level(LogChannel channel) {
+    if (channel < 0 || channel >= LOG_CHANNEL_COUNT) return LOG_LEVEL_OFF;
+    return (LogLevel)s_levels[channel].load(std::memory_order_relaxed);
+}
+
+static int find_name(const char* name, size_t len, const char* const* names, int count) {
+    for (int i = 0; i < count; i++) {
+        if (strlen(names[i]) == len && strncmp(names[i], name, len) == 0) return i;
+    }
+    return -1;
+}
+
+bool log_parse_levels(const char* spec) {
+    if (!spec) return false;
+
+    const int level_count = (int)(sizeof(s_level_names) / sizeof(s_level_names[0]));
+    bool ok = true;
+    const char* p = spec;
+
+    while (*p) {
+        const char* end = strchr(p, ',');
+        size_t len = end ? (size_t)(end - p) : strlen(p);
+        const char* eq = (const char*)memchr(p, '=', len);
+
+        if (eq) {
+            int channel = find_name(p, (size_t)(eq - p), s_channel_names, LOG_CHANNEL_COUNT);
+            int level = find_name(eq + 1, len - (size_t)(eq - p) - 1, s_level_names, level_count);
+            if (channel < 0 || level < 0) {
+                ok = false;
+            } else {
+                log_set_level((LogChannel)channel, (LogLevel)level);
+            }
+        } else {
+            // Bare level applies to every channel
+            int level = find_name(p, len, s_level_names, level_count);
+            if (level < 0) {
+                ok = false;
+            } else {
+                for (int c = 0; c < LOG_CHANNEL_COUNT; c++) {
+                    log_set_level((LogChannel)c, (LogLevel)level);
+                }
+            }
+        }
+
+        if (!end) break;
+        p = end + 1;
+    }
+
+    if (!ok) fprintf(stderr, "[Log] Bad level spec '%s'\n", spec);
+    return ok;
+}
+
+bool log_enabled(LogChannel channel, LogLevel level) {
+    if (channel < 0 || channel >= LOG_CHANNEL_COUNT) return false;
+    return (int)level <= s_levels[channel].load(std::memory_order_relaxed);
+}
+
+void log_write(LogChannel channel, LogLevel level, const char* fmt, ...) {
+    if (!log_enabled(channel, level)) return;
+
+    va_list args;
+    va_start(args, fmt);
+
+    if (!s_running.load(std::memory_order_acquire)) {
+        // No drain thread: write directly
+        char text[LOG_MESSAGE_MAX];
+        vsnprintf(text, sizeof(text), fmt, args);
+        va_end(args);
+        write_line(level, text);
+        return;
+    }
+
+    // Claim a slot
+    LogSlot* slot;
+    uint64_t pos = s_enqueue_pos.load(std::memory_order_relaxed);
+    for (;;) {
+        slot = &s_slots[pos & (LOG_QUEUE_SIZE - 1)];
+        uint64_t seq = slot->sequence.load(std::memory_order_acquire);
+        int64_t diff = (int64_t)seq - (int64_t)pos;
+        if (diff == 0) {
+            if (s_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+        } else if (diff < 0) {
+            // Full: drop rather than block the caller
+            s_dropped.fetch_add(1, std::memory_order_relaxed);
+            va_end(args);
+            return;
+        } else {
+            pos = s_enqueue_pos.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->channel = (uint8_t)channel;
+    slot->level = (uint8_t)level;
+    vsnprintf(slot->text, sizeof(slot->text), fmt, args);
+    va_end(args);
+    slot->sequence.store(pos + 1, std::memory_order_release);
+}
+
+uint64_t log_dropped_count(void) {
+    return s_dropped.load(std::memory_order_relaxed);
+}
+
+} // extern "C"
@@ -0,0 +1,105 @@
+/*
+ * Asynchronous Channel Logger
+ *
+ * Log calls format into a slot of a bounded lock-free queue and return; a
+ * background thread drains the queue to stdout/stderr. A simulation step never
+ * waits on terminal I/O (if the queue is full the message is dropped and
+ * counted instead).
+ *
+ *   LOG_DEBUG(LOG_DRIVETRAIN, "G:%d RPM:%.0f", gear, rpm);
+ *   LOG_INFO(LOG_PHYSICS, "World PAUSED");
+ *
+ * Messages are single lines without a trailing newline. Levels above
+ * ARENA_LOG_COMPILE_LEVEL compile out entirely. CMake sets it (DEBUG only in
+ * Debug builds, or the ARENA_LOG_LEVEL option); other builds drop DEBUG when
+ * NDEBUG is defined. Below that, each channel has a runtime level
+ * (log_set_level / log_parse_levels).
+ */
+
+#ifndef LOG_H
+#define LOG_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef enum {
+    LOG_PHYSICS = 0,    // World stepping, cruise, pause
+    LOG_DRIVETRAIN,     // Engine/transmission/slip, acceleration test
+    LOG_SCRIPT,         // Reflex scripts
+    LOG_MANEUVER,       // Kinematic maneuvers and turns
+    LOG_CHANNEL_COUNT
+} LogChannel;
+
+typedef enum {
+    LOG_LEVEL_OFF = 0,
+    LOG_LEVEL_ERROR,
+    LOG_LEVEL_WARN,
+    LOG_LEVEL_INFO,
+    LOG_LEVEL_DEBUG
+} LogLevel;
+
+#ifndef ARENA_LOG_COMPILE_LEVEL
+#ifdef NDEBUG
+#define ARENA_LOG_COMPILE_LEVEL LOG_LEVEL_INFO
+#else
+#define ARENA_LOG_COMPILE_LEVEL LOG_LEVEL_DEBUG
+#endif
+#endif
+
+// Queue capacity in messages (power of two) and max message length
+#define LOG_QUEUE_SIZE 4096
+#define LOG_MESSAGE_MAX 240
+
+#if defined(__GNUC__) || defined(__clang__)
+#define LOG_PRINTF_FORMAT(fmt_index, args_index) __attribute__((format(printf, fmt_index, args_index)))
+#else
+#define LOG_PRINTF_FORMAT(fmt_index, args_index)
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Start the drain thread. Before this (and after log_shutdown) log calls
+// write synchronously, so early startup messages are never lost.
+void log_init(void);
+
+// Drain everything queued and stop the drain thread.
+// Call after any thread that logs has stopped.
+void log_shutdown(void);
+
+// Block until everything queued so far has been written
+void log_flush(void);
+
+void log_set_level(LogChannel channel, LogLevel level);
+LogLevel log_get_level(LogChannel channel);
+
+// Apply a level spec such as "drivetrain=off,physics=debug" or "info" (all
+// channels). Returns false if any entry was not recognised.
+bool log_parse_levels(const char* spec);
+
+// True if a message at this level on this channel would be written
+bool log_enabled(LogChannel channel, LogLevel level);
+
+// Queue a message (use the LOG_* macros instead)
+void log_write(LogChannel channel, LogLevel level, const char* fmt, ...) LOG_PRINTF_FORMAT(3, 4);
+
+// Messages dropped because the queue was full
+uint64_t log_dropped_count(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#define LOG_ENABLED(channel, level) \
+    ((level) <= ARENA_LOG_COMPILE_LEVEL && log_enabled(channel, level))
+
+#define LOG_AT(channel, level, ...) \
+    do { if (LOG_ENABLED(channel, level)) log_write(channel, level, __VA_ARGS__); } while (0)
+
+#define LOG_ERROR(channel, ...) LOG_AT(channel, LOG_LEVEL_ERROR, __VA_ARGS__)
+#define LOG_WARN(channel, ...)  LOG_AT(channel, LOG_LEVEL_WARN, __VA_ARGS__)
+#define LOG_INFO(channel, ...)  LOG_AT(channel, LOG_LEVEL_INFO, __VA_ARGS__)
+#define LOG_DEBUG(channel, ...) LOG_AT(channel, LOG_LEVEL_DEBUG, __VA_ARGS__)
+
+#endif // LOG_H
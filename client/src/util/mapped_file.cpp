@@ -0,0 +1,130 @@
+/*
+ * Read-Only Mapped Files Implementation
+ */
+
+#include "mapped_file.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+
+static bool map_file(MappedFile* mf, const char* path) {
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    const char* data = mapping ? (const char*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : NULL;
+    if (!data) {
+        if (mapping) CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    mf->data = data;
+    mf->size = (size_t)size.QuadPart;
+    mf->mapping = mapping;
+    mf->file = file;
+    return true;
+}
+
+static void unmap_file(MappedFile* mf) {
+    UnmapViewOfFile(mf->data);
+    CloseHandle((HANDLE)mf->mapping);
+    CloseHandle((HANDLE)mf->file);
+}
+
+#else
+
+static bool map_file(MappedFile* mf, const char* path) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        close(fd);
+        return false;
+    }
+
+    void* data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);  // The mapping keeps the file
+    if (data == MAP_FAILED) return false;
+
+    mf->data = (const char*)data;
+    mf->size = (size_t)st.st_size;
+    mf->mapping = data;
+    return true;
+}
+
+static void unmap_file(MappedFile* mf) {
+    munmap(mf->mapping, mf->size);
+}
+
+#endif
+
+// Fallback for files that cannot be mapped (pipes, some network filesystems)
+static bool read_file(MappedFile* mf, const char* path) {
+    FILE* f = fopen(path, "rb");
+    if (!f) return false;
+
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    if (size <= 0) {
+        fclose(f);
+        return false;
+    }
+
+    char* buffer = (char*)malloc((size_t)size);
+    if (!buffer) {
+        fclose(f);
+        return false;
+    }
+    size_t got = fread(buffer, 1, (size_t)size, f);
+    fclose(f);
+    if (got != (size_t)size) {
+        free(buffer);
+        return false;
+    }
+
+    mf->data = buffer;
+    mf->size = (size_t)size;
+    return true;
+}
+
+extern "C" {
+
+bool mapped_file_open(MappedFile* mf, const char* path) {
+    memset(mf, 0, sizeof(*mf));
+    return map_file(mf, path) || read_file(mf, path);
+}
+
+void mapped_file_close(MappedFile* mf) {
+    if (!mf || !mf->data) return;
+    if (mf->mapping) {
+        unmap_file(mf);
+    } else {
+        free((void*)mf->data);
+    }
+    memset(mf, 0, sizeof(*mf));
+}
+
+} // extern "C"
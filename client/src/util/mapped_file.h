@@ -0,0 +1,40 @@
+/*
+ * Read-Only Mapped Files
+ * Maps a whole file into memory (mmap / MapViewOfFile), falling back to
+ * reading it into a heap buffer where mapping is not possible.
+ *
+ *   MappedFile mf;
+ *   if (mapped_file_open(&mf, path)) {
+ *       use(mf.data, mf.size);
+ *       mapped_file_close(&mf);
+ *   }
+ *
+ * Opening is silent: callers decide whether a missing file is an error.
+ * Empty files fail to open (there is nothing to map).
+ */
+
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* data;
+    size_t size;
+    void* mapping;      // Platform mapping (NULL = data was read into memory)
+    void* file;         // Windows file handle
+} MappedFile;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+bool mapped_file_open(MappedFile* mf, const char* path);
+void mapped_file_close(MappedFile* mf);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MAPPED_FILE_H
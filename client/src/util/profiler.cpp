@@ -0,0 +1,168 @@
+/*
+ * Scoped Hot-Path Profiler Implementation
+ *
+ * Each thread owns a ring buffer it registers on first use. Only the owning
+ * thread writes; it publishes each event by bumping write_index with release
+ * ordering. The dumper reads write_index, copies the events, reads it again
+ * and drops any slot that was overwritten while copying. No locks on the hot
+ * path - the registry mutex is taken once per thread and by the dumper.
+ */
+
+#include "profiler.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+#define PROFILER_MAX_DEPTH 32
+
+typedef struct {
+    const char* name;
+    uint64_t start_ns;
+    uint64_t dur_ns;
+} ProfileEvent;
+
+struct ProfilerThread {
+    ProfileEvent events[PROFILER_RING_SIZE];
+    std::atomic<uint64_t> write_index;
+    int tid;
+    char name[32];
+
+    // Open spans for profiler_begin/profiler_end
+    const char* stack_name[PROFILER_MAX_DEPTH];
+    uint64_t stack_start[PROFILER_MAX_DEPTH];
+    int depth;
+};
+
+// Buffers outlive their threads so spans from finished threads still dump
+static std::mutex s_registry_mutex;
+static std::vector<ProfilerThread*> s_threads;
+static thread_local ProfilerThread* t_thread = nullptr;
+
+static const auto s_epoch = std::chrono::steady_clock::now();
+
+static ProfilerThread* get_thread(void) {
+    if (t_thread) return t_thread;
+
+    ProfilerThread* t = new ProfilerThread();
+    t->write_index.store(0, std::memory_order_relaxed);
+    t->depth = 0;
+
+    std::lock_guard<std::mutex> lock(s_registry_mutex);
+    t->tid = (int)s_threads.size() + 1;
+    snprintf(t->name, sizeof(t->name), "Thread %d", t->tid);
+    s_threads.push_back(t);
+    t_thread = t;
+    return t;
+}
+
+extern "C" {
+
+uint64_t profiler_now_ns(void) {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - s_epoch).count();
+}
+
+void profiler_record(const char* name, uint64_t start_ns, uint64_t end_ns) {
+    ProfilerThread* t = get_thread();
+    uint64_t i = t->write_index.load(std::memory_order_relaxed);
+    ProfileEvent* e = &t->events[i & (PROFILER_RING_SIZE - 1)];
+    e->name = name;
+    e->start_ns = start_ns;
+    e->dur_ns = end_ns - start_ns;
+    t->write_index.store(i + 1, std::memory_order_release);
+}
+
+void profiler_begin(const char* name) {
+    ProfilerThread* t = get_thread();
+    if (t->depth < PROFILER_MAX_DEPTH) {
+        t->stack_name[t->depth] = name;
+        t->stack_start[t->depth] = profiler_now_ns();
+    }
+    t->depth++;
+}
+
+void profiler_end(void) {
+    ProfilerThread* t = get_thread();
+    if (t->depth <= 0) return;
+    t->depth--;
+    if (t->depth < PROFILER_MAX_DEPTH) {
+        profiler_record(t->stack_name[t->depth], t->stack_start[t->depth], profiler_now_ns());
+    }
+}
+
+void profiler_set_thread_name(const char* name) {
+    ProfilerThread* t = get_thread();
+    std::lock_guard<std::mutex> lock(s_registry_mutex);
+    snprintf(t->name, sizeof(t->name), "%s", name);
+}
+
+// Span names are literals, but escape anyway so the JSON is always valid
+static void write_json_string(FILE* f, const char* s) {
+    fputc('"', f);
+    for (; *s; s++) {
+        if (*s == '"' || *s == '\\') fputc('\\', f);
+        if ((unsigned char)*s >= 0x20) fputc(*s, f);
+    }
+    fputc('"', f);
+}
+
+bool profiler_dump_chrome_trace(const char* path) {
+    FILE* f = fopen(path, "w");
+    if (!f) {
+        fprintf(stderr, "[Profiler] Cannot write %s\n", path);
+        return false;
+    }
+
+    std::vector<ProfilerThread*> threads;
+    {
+        std::lock_guard<std::mutex> lock(s_registry_mutex);
+        threads = s_threads;
+    }
+
+    fprintf(f, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    bool first = true;
+    size_t total = 0;
+    std::vector<ProfileEvent> copy;
+
+    for (ProfilerThread* t : threads) {
+        // Thread name metadata
+        fprintf(f, "%s{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":",
+                first ? "" : ",\n", t->tid);
+        write_json_string(f, t->name);
+        fprintf(f, "}}");
+        first = false;
+
+        uint64_t end = t->write_index.load(std::memory_order_acquire);
+        uint64_t begin = end > PROFILER_RING_SIZE ? end - PROFILER_RING_SIZE : 0;
+        copy.resize((size_t)(end - begin));
+        for (uint64_t i = begin; i < end; i++) {
+            copy[(size_t)(i - begin)] = t->events[i & (PROFILER_RING_SIZE - 1)];
+        }
+
+        // The copy races with the owner by design (no lock on the record
+        // path). Slots it lapped while we were copying are torn - skip them,
+        // including slot end_after, which it may be writing right now.
+        uint64_t end_after = t->write_index.load(std::memory_order_acquire);
+        uint64_t valid_from = end_after >= PROFILER_RING_SIZE ? end_after - PROFILER_RING_SIZE + 1 : 0;
+
+        for (uint64_t i = begin < valid_from ? valid_from : begin; i < end; i++) {
+            const ProfileEvent* e = &copy[(size_t)(i - begin)];
+            if (!e->name) continue;
+            fprintf(f, ",\n{\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"name\":", t->tid);
+            write_json_string(f, e->name);
+            fprintf(f, ",\"ts\":%.3f,\"dur\":%.3f}", e->start_ns / 1000.0, e->dur_ns / 1000.0);
+            total++;
+        }
+    }
+
+    fprintf(f, "\n]}\n");
+    bool ok = (fclose(f) == 0);
+    printf("[Profiler] Wrote %zu spans from %zu threads to %s\n", total, threads.size(), path);
+    return ok;
+}
+
+} // extern "C"
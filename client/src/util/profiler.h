@@ -0,0 +1,77 @@
+/*
+ * Scoped Hot-Path Profiler
+ *
+ * Records named time spans into a per-thread lock-free ring buffer and dumps
+ * them as Chrome trace JSON (open in chrome://tracing or ui.perfetto.dev).
+ *
+ *   PROFILE_SCOPE("Physics.JoltUpdate");   // span until end of C++ scope
+ *   PROFILE_BEGIN("UI"); ... PROFILE_END(); // span across non-block code
+ *
+ * Span names must be string literals (only the pointer is stored).
+ * Build with ARENA_PROFILE=0 (CMake: -DARENA_PROFILER=OFF) and every macro
+ * compiles to nothing.
+ */
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifndef ARENA_PROFILE
+#define ARENA_PROFILE 0
+#endif
+
+// Events kept per thread (oldest are overwritten)
+#define PROFILER_RING_SIZE 65536
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Monotonic clock in nanoseconds
+uint64_t profiler_now_ns(void);
+
+// Record a finished span on the calling thread's ring buffer
+void profiler_record(const char* name, uint64_t start_ns, uint64_t end_ns);
+
+// Open/close a span on the calling thread (nesting up to 32 deep)
+void profiler_begin(const char* name);
+void profiler_end(void);
+
+// Label the calling thread in the trace
+void profiler_set_thread_name(const char* name);
+
+// Write every thread's buffered spans as Chrome trace JSON.
+// Safe to call while other threads keep recording. Returns false on I/O error.
+bool profiler_dump_chrome_trace(const char* path);
+
+#ifdef __cplusplus
+}
+
+// RAII span for PROFILE_SCOPE
+struct ProfileScope {
+    const char* name;
+    uint64_t start;
+    explicit ProfileScope(const char* n) : name(n), start(profiler_now_ns()) {}
+    ~ProfileScope() { profiler_record(name, start, profiler_now_ns()); }
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+};
+#endif
+
+#if ARENA_PROFILE
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_SCOPE(name) ProfileScope PROFILE_CONCAT(profile_scope_, __LINE__)(name)
+#define PROFILE_BEGIN(name) profiler_begin(name)
+#define PROFILE_END() profiler_end()
+#define PROFILE_THREAD_NAME(name) profiler_set_thread_name(name)
+#else
+#define PROFILE_SCOPE(name) ((void)0)
+#define PROFILE_BEGIN(name) ((void)0)
+#define PROFILE_END() ((void)0)
+#define PROFILE_THREAD_NAME(name) ((void)0)
+#endif
+
+#endif // PROFILER_H